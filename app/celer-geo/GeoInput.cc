@@ -71,6 +71,29 @@ void from_json(nlohmann::json const& j, TraceSetup& v)
     }
     GI_LOAD_OPTION(volumes);
     GI_LOAD_REQUIRED(bin_file);
+    GI_LOAD_OPTION(preview);
+}
+
+void from_json(nlohmann::json const& j, CheckSetup& v)
+{
+    CELER_VALIDATE(j.is_object(),
+                   << "input JSON for CheckSetup is not an object: '"
+                   << j.dump() << '\'');
+    if (auto iter = j.find("geometry"); iter != j.end() && !iter->is_null())
+    {
+        v.geometry = to_geometry(iter->get<std::string>());
+    }
+    if (auto iter = j.find("reference"); iter != j.end() && !iter->is_null())
+    {
+        v.reference = to_geometry(iter->get<std::string>());
+    }
+    if (auto iter = j.find("memspace"); iter != j.end() && !iter->is_null())
+    {
+        v.memspace = to_memspace(iter->get<std::string>());
+    }
+    GI_LOAD_OPTION(num_points);
+    GI_LOAD_OPTION(seed);
+    GI_LOAD_OPTION(max_mismatches);
 }
 
 void to_json(nlohmann::json& j, ModelSetup const& v)
@@ -86,6 +109,17 @@ void to_json(nlohmann::json& j, TraceSetup const& v)
     j["memspace"] = to_cstring(v.memspace);
     GI_SAVE(volumes);
     GI_SAVE(bin_file);
+    GI_SAVE_NONZERO(preview);
+}
+
+void to_json(nlohmann::json& j, CheckSetup const& v)
+{
+    j["geometry"] = to_cstring(v.geometry);
+    j["reference"] = to_cstring(v.reference);
+    j["memspace"] = to_cstring(v.memspace);
+    GI_SAVE(num_points);
+    GI_SAVE(seed);
+    GI_SAVE(max_mismatches);
 }
 
 #undef GI_LOAD_OPTION
@@ -49,6 +49,39 @@ struct TraceSetup
 
     //! Output filename for binary
     std::string bin_file;
+
+    //! Downsampling factor for a quick preview traced first (0 for none)
+    size_type preview{0};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Input for comparing a geometry against a reference.
+ *
+ * The last image is traced with both geometries and compared pixel by pixel,
+ * and then the given number of points sampled uniformly in the reference
+ * geometry's bounding box are located in both. The reference geometry is
+ * always traced on host.
+ */
+struct CheckSetup
+{
+    //! Geometry to test
+    Geometry geometry{Geometry::orange};
+
+    //! Reference geometry
+    Geometry reference{Geometry::geant4};
+
+    //! Memory space for tracing the tested geometry
+    MemSpace memspace{default_memspace()};
+
+    //! Number of random points to locate
+    size_type num_points{0};
+
+    //! Random number seed for sampling points
+    unsigned int seed{12345};
+
+    //! Maximum number of mismatches to report
+    size_type max_mismatches{100};
 };
 
 //---------------------------------------------------------------------------//
@@ -59,6 +92,9 @@ void from_json(nlohmann::json const& j, ModelSetup& value);
 void to_json(nlohmann::json& j, TraceSetup const& value);
 void from_json(nlohmann::json const& j, TraceSetup& value);
 
+void to_json(nlohmann::json& j, CheckSetup const& value);
+void from_json(nlohmann::json const& j, CheckSetup& value);
+
 //---------------------------------------------------------------------------//
 }  // namespace app
 }  // namespace celeritas
@@ -9,16 +9,22 @@
 
 #include "corecel/Config.hh"
 
+#include "corecel/data/CollectionStateStore.hh"
 #include "corecel/io/StringUtils.hh"
+#include "corecel/math/Algorithms.hh"
 #include "corecel/sys/Device.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/Stopwatch.hh"
 #include "geocel/rasterize/RaytraceImager.hh"
 #include "orange/OrangeParams.hh"
+#include "orange/OrangeTrackView.hh"
 #if CELERITAS_USE_GEANT4
 #    include "geocel/g4/GeantGeoParams.hh"
+#    include "geocel/g4/GeantGeoTrackView.hh"
 #endif
 #if CELERITAS_USE_VECGEOM
 #    include "geocel/vg/VecgeomParams.hh"
+#    include "geocel/vg/VecgeomTrackView.hh"
 #endif
 
 #define CASE_RETURN_FUNC_T(T, FUNC, ...) \
@@ -61,9 +67,7 @@ Runner::Runner(ModelSetup const& input) : input_{input}
 auto Runner::operator()(TraceSetup const& trace,
                         ImageInput const& image_inp) -> SPImage
 {
-    // Create image params
-    last_image_ = std::make_shared<ImageParams>(image_inp);
-
+    this->set_image(image_inp);
     return (*this)(trace);
 }
 
@@ -82,9 +86,69 @@ auto Runner::operator()(TraceSetup const& trace) -> SPImage
     SPImager imager = this->make_imager(trace.geometry);
 
     // Create image
-    SPImage image = this->make_traced_image(trace.memspace, *imager);
+    SPImage image = this->make_traced_image(
+        trace.memspace,
+        last_image_,
+        *imager,
+        imager_name_ + '_' + to_cstring(trace.memspace));
     return image;
 }
+
+//---------------------------------------------------------------------------//
+/*!
+ * Set up the image for subsequent raytraces.
+ */
+void Runner::set_image(ImageInput const& image_inp)
+{
+    last_image_ = std::make_shared<ImageParams>(image_inp);
+    last_input_ = image_inp;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Perform a downsampled raytrace of the last image.
+ *
+ * The vertical resolution is reduced by the trace's preview factor, and the
+ * horizontal resolution follows from the image aspect ratio.
+ */
+auto Runner::preview(TraceSetup const& trace) -> SPImage
+{
+    CELER_VALIDATE(last_image_,
+                   << "first trace input did not specify an image");
+    CELER_EXPECT(trace.preview > 0);
+
+    ImageInput inp = last_input_;
+    inp.vertical_pixels = ceil_div(inp.vertical_pixels, trace.preview);
+    auto params = std::make_shared<ImageParams>(inp);
+
+    SPImager imager = this->make_imager(trace.geometry);
+    return this->make_traced_image(trace.memspace,
+                                   params,
+                                   *imager,
+                                   imager_name_ + "_preview_"
+                                       + to_cstring(trace.memspace));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the number of rays traced per second by each imager.
+ *
+ * Each pixel is a single ray sample, so this is the pixel rate.
+ */
+auto Runner::rays_per_second() const -> MapTimers
+{
+    MapTimers result;
+    for (auto const& [key, count] : num_rays_)
+    {
+        auto iter = timers_.find(key);
+        CELER_ASSERT(iter != timers_.end());
+        if (iter->second > 0)
+        {
+            result[key] = static_cast<double>(count) / iter->second;
+        }
+    }
+    return result;
+}
 //---------------------------------------------------------------------------//
 /*!
  * Get volume names from an already loaded geometry.
@@ -102,8 +166,136 @@ std::vector<std::string> Runner::get_volumes(Geometry g) const&
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Access full volume labels, including uniquifying extensions.
+ */
+std::vector<Label> Runner::get_volume_labels(Geometry g) const&
+{
+    CELER_EXPECT(geo_cache_[g]);
+
+    auto const& geo = *geo_cache_[g];
+    std::vector<Label> result(geo.volumes().size());
+    for (auto i : range<VolumeId::size_type>(result.size()))
+    {
+        result[i] = geo.volumes().at(VolumeId{i});
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load and access a geometry.
+ */
+GeoParamsInterface const& Runner::geometry(Geometry g)
+{
+    switch (g)
+    {
+        case Geometry::orange:
+            this->load_geometry<Geometry::orange>();
+            break;
+        case Geometry::vecgeom:
+            this->load_geometry<Geometry::vecgeom>();
+            break;
+        case Geometry::geant4:
+            this->load_geometry<Geometry::geant4>();
+            break;
+        default:
+            CELER_ASSERT_UNREACHABLE();
+    }
+    CELER_ENSURE(geo_cache_[g]);
+    return *geo_cache_[g];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the volume ID at each point.
+ *
+ * Points outside the geometry have an ID of -1 to match the raytrace image
+ * convention.
+ */
+std::vector<int> Runner::locate(Geometry g, Span<Real3 const> points)
+{
+    switch (g)
+    {
+        CASE_RETURN_FUNC_T(Geometry::orange, locate, points);
+        CASE_RETURN_FUNC_T(Geometry::vecgeom, locate, points);
+        CASE_RETURN_FUNC_T(Geometry::geant4, locate, points);
+        default:
+            CELER_ASSERT_UNREACHABLE();
+    }
+}
+
 //---------------------------------------------------------------------------//
 // HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Find volume IDs with a geometry of a given type.
+ *
+ * Points are located in batches, with one host state per point in the batch,
+ * so that thread-safe geometries can be initialized in parallel.
+ */
+template<Geometry G>
+std::vector<int> Runner::locate(Span<Real3 const> points)
+{
+    using GP = GeoParams_t<G>;
+
+    if constexpr (is_geometry_configured_v<GP>)
+    {
+        using GTraits = GeoTraits<GP>;
+        using GeoTrackView = typename GTraits::TrackView;
+        using StateStore = CollectionStateStore<GTraits::template StateData,
+                                                MemSpace::host>;
+        constexpr size_type max_batch_size = 4096;
+
+        std::vector<int> result(points.size(), -1);
+        if (points.empty())
+        {
+            return result;
+        }
+
+        std::shared_ptr<GP const> geo = this->load_geometry<G>();
+        auto const& params = geo->host_ref();
+        size_type const batch_size
+            = min<size_type>(points.size(), max_batch_size);
+        StateStore states{params, batch_size};
+
+        Stopwatch get_time;
+        for (size_type start = 0; start < points.size(); start += batch_size)
+        {
+            size_type const num_points
+                = min<size_type>(batch_size, points.size() - start);
+            auto locate_point = [&](size_type i) {
+                GeoTrackView track{params, states.ref(), TrackSlotId{i}};
+                track = GeoTrackInitializer{points[start + i], {1, 0, 0}};
+                if (!track.is_outside())
+                {
+                    result[start + i]
+                        = static_cast<int>(track.volume_id().unchecked_get());
+                }
+            };
+
+            MultiExceptionHandler capture_exception;
+#if defined(_OPENMP) && CELERITAS_USE_OPENMP
+#    pragma omp parallel for if (GTraits::host_thread_safe)
+#endif
+            for (size_type i = 0; i < num_points; ++i)
+            {
+                CELER_TRY_HANDLE(locate_point(i), capture_exception);
+            }
+            log_and_rethrow(std::move(capture_exception));
+        }
+        timers_[std::string{"locate_"} + to_cstring(G)] += get_time();
+
+        return result;
+    }
+    else
+    {
+        CELER_DISCARD(points);
+        CELER_NOT_CONFIGURED(to_cstring(G));
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Load a geometry, caching it.
@@ -202,12 +394,16 @@ auto Runner::make_imager() -> SPImager
  * Allocate and perform a raytrace using an enumeration.
  */
 auto Runner::make_traced_image(MemSpace m,
-                               ImagerInterface& generate_image) -> SPImage
+                               SPImageParams const& params,
+                               ImagerInterface& generate_image,
+                               std::string const& key) -> SPImage
 {
     switch (m)
     {
-        CASE_RETURN_FUNC_T(MemSpace::host, make_traced_image, generate_image);
-        CASE_RETURN_FUNC_T(MemSpace::device, make_traced_image, generate_image);
+        CASE_RETURN_FUNC_T(
+            MemSpace::host, make_traced_image, params, generate_image, key);
+        CASE_RETURN_FUNC_T(
+            MemSpace::device, make_traced_image, params, generate_image, key);
         default:
             CELER_ASSERT_UNREACHABLE();
     }
@@ -218,13 +414,16 @@ auto Runner::make_traced_image(MemSpace m,
  * Allocate and perform a raytrace with the given memory/execution space.
  */
 template<MemSpace M>
-auto Runner::make_traced_image(ImagerInterface& generate_image) -> SPImage
+auto Runner::make_traced_image(SPImageParams const& params,
+                               ImagerInterface& generate_image,
+                               std::string const& key) -> SPImage
 {
-    auto image = std::make_shared<Image<M>>(last_image_);
+    auto image = std::make_shared<Image<M>>(params);
 
     Stopwatch get_time;
     generate_image(image.get());
-    timers_[imager_name_ + '_' + to_cstring(M)] += get_time();
+    timers_[key] += get_time();
+    num_rays_[key] += params->num_pixels();
 
     return image;
 }
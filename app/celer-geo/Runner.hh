@@ -9,8 +9,11 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "corecel/cont/EnumArray.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/io/Label.hh"
 #include "geocel/GeoParamsInterface.hh"
 #include "geocel/rasterize/Image.hh"
 
@@ -35,6 +38,14 @@ namespace app
  * that takes \c ImageInput, but subsequent calls will reuse the same image.
  * This is useful for comparing that multiple geometries are rendering the same
  * geometry identically.
+ *
+ * A low-resolution preview of the current image can be traced before the
+ * full image to give quick visual feedback for large renders. The number of
+ * rays (pixels) traced by each imager is recorded along with the timers to
+ * report a navigation throughput for each geometry and memory space.
+ *
+ * For consistency checking, the volumes at arbitrary points can also be
+ * located (in parallel if the geometry supports it) with any geometry.
  */
 class Runner
 {
@@ -43,6 +54,7 @@ class Runner
     //! \name Type aliases
     using SPImage = std::shared_ptr<ImageInterface>;
     using MapTimers = std::map<std::string, double>;
+    using MapCounts = std::map<std::string, size_type>;
     //!@}
 
   public:
@@ -55,12 +67,33 @@ class Runner
     // Perform a raytrace using the last image but a new geometry
     SPImage operator()(TraceSetup const&);
 
+    // Set up the image for subsequent raytraces
+    void set_image(ImageInput const&);
+
+    // Perform a downsampled raytrace of the last image
+    SPImage preview(TraceSetup const&);
+
     //! Access timers
     MapTimers const& timers() const { return timers_; }
 
+    //! Access number of rays traced by each imager
+    MapCounts const& num_rays() const { return num_rays_; }
+
+    // Calculate the number of rays traced per second by each imager
+    MapTimers rays_per_second() const;
+
     //! Access volumes
     std::vector<std::string> get_volumes(Geometry) const&;
 
+    // Access full volume labels
+    std::vector<Label> get_volume_labels(Geometry) const&;
+
+    // Load and access a geometry
+    GeoParamsInterface const& geometry(Geometry);
+
+    // Find the volume ID at each point (-1 if outside)
+    std::vector<int> locate(Geometry, Span<Real3 const> points);
+
   private:
     //// TYPES ////
 
@@ -75,10 +108,12 @@ class Runner
 
     ModelSetup input_;
     GeoArray<SPConstGeometry> geo_cache_;
+    ImageInput last_input_;
     SPImageParams last_image_;
     std::string imager_name_;
     G4VPhysicalVolume const* geant_world_{nullptr};
     MapTimers timers_;
+    MapCounts num_rays_;
 
     //// HELPER FUNCTIONS ////
 
@@ -86,6 +121,10 @@ class Runner
     template<Geometry G>
     std::shared_ptr<GeoParams_t<G> const> load_geometry();
 
+    // Find volume IDs with a geometry of a given type
+    template<Geometry>
+    std::vector<int> locate(Span<Real3 const> points);
+
     // Create a tracer
     SPImager make_imager(Geometry);
 
@@ -94,11 +133,16 @@ class Runner
     SPImager make_imager();
 
     // Allocate and perform a raytrace
-    SPImage make_traced_image(MemSpace, ImagerInterface& generate_image);
+    SPImage make_traced_image(MemSpace,
+                              SPImageParams const&,
+                              ImagerInterface& generate_image,
+                              std::string const& key);
 
     // Allocate and perform a raytrace
     template<MemSpace>
-    SPImage make_traced_image(ImagerInterface& generate_image);
+    SPImage make_traced_image(SPImageParams const&,
+                              ImagerInterface& generate_image,
+                              std::string const& key);
 };
 
 //---------------------------------------------------------------------------//
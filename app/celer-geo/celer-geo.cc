@@ -5,10 +5,12 @@
 //---------------------------------------------------------------------------//
 //! \file celer-geo/celer-geo.cc
 //---------------------------------------------------------------------------//
+#include <cmath>
 #include <csignal>
 #include <cstddef>
 #include <fstream>
 #include <iostream>
+#include <random>
 #include <string>
 #include <vector>
 #include <nlohmann/json.hpp>
@@ -16,18 +18,24 @@
 #include "corecel/Config.hh"
 #include "corecel/Version.hh"
 
+#include "corecel/cont/Range.hh"
 #include "corecel/io/ExceptionOutput.hh"
+#include "corecel/io/Label.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/io/Repr.hh"
 #include "corecel/io/StringUtils.hh"
+#include "corecel/math/ArrayOperators.hh"
+#include "corecel/math/ArrayUtils.hh"
 #include "corecel/sys/Device.hh"
 #include "corecel/sys/DeviceIO.json.hh"
 #include "corecel/sys/KernelRegistry.hh"
 #include "corecel/sys/KernelRegistryIO.json.hh"
 #include "corecel/sys/ScopedMpiInit.hh"
 #include "corecel/sys/ScopedSignalHandler.hh"
+#include "geocel/detail/LengthUnits.hh"
 #include "geocel/rasterize/Image.hh"
 #include "geocel/rasterize/ImageIO.json.hh"
+#include "geocel/rasterize/VolumeComparator.hh"
 
 #include "GeoInput.hh"
 #include "Runner.hh"
@@ -100,38 +108,22 @@ Runner make_runner(json const& input)
 
 //---------------------------------------------------------------------------//
 /*!
- * Execute a single raytrace.
+ * Write a traced image to disk and its metadata to stdout.
  */
-void run_trace(Runner& run_trace,
-               TraceSetup const& trace_setup,
-               ImageInput const& image_setup)
+void write_image(Runner const& runner,
+                 TraceSetup const& trace_setup,
+                 ImageInterface const& image,
+                 bool preview)
 {
-    CELER_LOG(status) << "Tracing " << to_cstring(trace_setup.geometry)
-                      << " image on " << to_cstring(trace_setup.memspace);
-
-    // Run the raytrace
-    auto image = [&] {
-        if (image_setup)
-        {
-            // User specified a new image setup
-            return run_trace(trace_setup, image_setup);
-        }
-        else
-        {
-            // Reuse last image setup
-            return run_trace(trace_setup);
-        }
-    }();
-    CELER_ASSERT(image);
-
-    auto const& img_params = *image->params();
+    auto const& img_params = *image.params();
 
     // Write the output to disk
-    CELER_LOG(info) << "Writing image to '" << trace_setup.bin_file << '\'';
+    CELER_LOG(info) << "Writing " << (preview ? "preview " : "")
+                    << "image to '" << trace_setup.bin_file << '\'';
     {
         std::ofstream image_file(trace_setup.bin_file, std::ios::binary);
         std::vector<int> image_data(img_params.num_pixels());
-        image->copy_to_host(make_span(image_data));
+        image.copy_to_host(make_span(image_data));
         // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
         image_file.write(reinterpret_cast<char const*>(image_data.data()),
                          image_data.size() * sizeof(int));
@@ -142,22 +134,194 @@ void run_trace(Runner& run_trace,
         {"image", img_params},
         {"sizeof_int", sizeof(int)},
     };
+    if (preview)
+    {
+        out["preview"] = true;
+    }
     if (trace_setup.volumes)
     {
         // Get geometry names
-        out["volumes"] = run_trace.get_volumes(trace_setup.geometry);
+        out["volumes"] = runner.get_volumes(trace_setup.geometry);
     }
 
     std::cout << out.dump() << std::endl;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the output filename for a preview image.
+ */
+std::string preview_filename(std::string const& bin_file)
+{
+    std::string_view const ext{".bin"};
+    if (ends_with(bin_file, ext))
+    {
+        return bin_file.substr(0, bin_file.size() - ext.size())
+               + ".preview.bin";
+    }
+    return bin_file + ".preview";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute a single raytrace.
+ *
+ * If a preview is requested, a downsampled image is traced and written
+ * first (with its own output line) for quick feedback.
+ */
+void run_trace(Runner& run_trace,
+               TraceSetup const& trace_setup,
+               ImageInput const& image_setup)
+{
+    if (image_setup)
+    {
+        // User specified a new image setup
+        run_trace.set_image(image_setup);
+    }
+
+    if (trace_setup.preview > 1)
+    {
+        CELER_LOG(status) << "Tracing " << to_cstring(trace_setup.geometry)
+                          << " preview on "
+                          << to_cstring(trace_setup.memspace);
+        auto image = run_trace.preview(trace_setup);
+        CELER_ASSERT(image);
+
+        TraceSetup preview_setup = trace_setup;
+        preview_setup.bin_file = preview_filename(trace_setup.bin_file);
+        preview_setup.volumes = false;
+        write_image(run_trace, preview_setup, *image, /* preview = */ true);
+    }
+
+    CELER_LOG(status) << "Tracing " << to_cstring(trace_setup.geometry)
+                      << " image on " << to_cstring(trace_setup.memspace);
+
+    // Run the raytrace, reusing the last image setup
+    auto image = run_trace(trace_setup);
+    CELER_ASSERT(image);
+
+    write_image(run_trace, trace_setup, *image, /* preview = */ false);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a geometry comparison to JSON, with positions in centimeters.
+ */
+json comparison_to_json(VolumeComparison const& result)
+{
+    json mismatches = json::array();
+    for (auto const& m : result.mismatches)
+    {
+        mismatches.push_back({
+            {"pos", m.pos / lengthunits::centimeter},
+            {"expected", m.expected},
+            {"actual", m.actual},
+        });
+    }
+    return {
+        {"num_samples", result.num_samples},
+        {"num_mismatched", result.num_mismatched},
+        {"mismatches", std::move(mismatches)},
+    };
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compare a geometry against a reference.
+ *
+ * The last image is traced with both geometries and compared pixel by pixel;
+ * then random points in the reference bounding box are located with both.
+ * The first few mismatched volumes are written to stdout with their
+ * coordinates.
+ */
+void run_check(Runner& runner,
+               CheckSetup const& check_setup,
+               ImageInput const& image_setup)
+{
+    if (image_setup)
+    {
+        runner.set_image(image_setup);
+    }
+
+    CELER_LOG(status) << "Checking " << to_cstring(check_setup.geometry)
+                      << " geometry against "
+                      << to_cstring(check_setup.reference);
+
+    // Trace the reference on host since not all geometries support device
+    TraceSetup trace_setup;
+    trace_setup.geometry = check_setup.reference;
+    trace_setup.memspace = MemSpace::host;
+    auto expected_image = runner(trace_setup);
+    trace_setup.geometry = check_setup.geometry;
+    trace_setup.memspace = check_setup.memspace;
+    auto actual_image = runner(trace_setup);
+
+    VolumeComparator compare{runner.get_volume_labels(check_setup.reference),
+                             runner.get_volume_labels(check_setup.geometry),
+                             check_setup.max_mismatches};
+    json unmatched = json::array();
+    for (Label const& label : compare.unmatched())
+    {
+        unmatched.push_back(to_string(label));
+    }
+    if (!unmatched.empty())
+    {
+        CELER_LOG(warning) << unmatched.size()
+                           << " reference volumes have no unique match in "
+                           << to_cstring(check_setup.geometry);
+    }
+    VolumeComparison ray_result;
+    compare(*expected_image, *actual_image, &ray_result);
+
+    VolumeComparison point_result;
+    if (check_setup.num_points > 0)
+    {
+        auto const& bbox = runner.geometry(check_setup.reference).bbox();
+        CELER_VALIDATE(bbox && std::isfinite(norm(bbox.upper() - bbox.lower())),
+                       << "cannot sample points in the unbounded "
+                       << to_cstring(check_setup.reference) << " geometry");
+
+        std::mt19937 rng(check_setup.seed);
+        std::vector<Real3> points(check_setup.num_points);
+        for (Real3& pos : points)
+        {
+            for (auto ax : range(3))
+            {
+                pos[ax] = std::uniform_real_distribution<real_type>(
+                    bbox.lower()[ax], bbox.upper()[ax])(rng);
+            }
+        }
+
+        auto expected = runner.locate(check_setup.reference, make_span(points));
+        auto actual = runner.locate(check_setup.geometry, make_span(points));
+        compare(make_span(points),
+                make_span(expected),
+                make_span(actual),
+                &point_result);
+    }
+
+    CELER_LOG(info) << "Found " << ray_result.num_mismatched << " of "
+                    << ray_result.num_samples << " pixels and "
+                    << point_result.num_mismatched << " of "
+                    << point_result.num_samples
+                    << " points with mismatched volumes";
+
+    std::cout << json{
+        {"check", check_setup},
+        {"unmatched", std::move(unmatched)},
+        {"rays", comparison_to_json(ray_result)},
+        {"points", comparison_to_json(point_result)},
+    } << std::endl;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Run, launch, and output.
  *
  * The input stream is expected to be in "JSON lines" format. The first input
  * \em must be a model setup; the following lines are individual commands to
- * trace an image. Newlines must be sent exactly \em once per input, and the
+ * trace an image (or, if the line has a \c check key, to compare two
+ * geometries). Newlines must be sent exactly \em once per input, and the
  * output \em must be flushed after doing so. (Recall that \em endl sends a
  * newline and flushes the output buffer.)
  */
@@ -188,6 +352,29 @@ void run(std::istream& is)
             break;
         }
 
+        if (auto iter = json_input.find("check"); iter != json_input.end())
+        {
+            try
+            {
+                CheckSetup check_setup;
+                ImageInput image_setup;
+                iter->get_to(check_setup);
+                if (auto img = json_input.find("image");
+                    img != json_input.end())
+                {
+                    img->get_to(image_setup);
+                }
+                run_check(runner, check_setup, image_setup);
+            }
+            catch (std::exception const& e)
+            {
+                CELER_LOG(error) << "Failed geometry check: " << e.what();
+                std::cout << ExceptionOutput{std::current_exception()}
+                          << std::endl;
+            }
+            continue;
+        }
+
         // Load required trace setup (geometry/memspace/output)
         TraceSetup trace_setup;
         ImageInput image_setup;
@@ -226,6 +413,8 @@ void run(std::istream& is)
     // Construct json output (TODO: add build metadata)
     std::cout << json{
         {"timers", runner.timers()},
+        {"num_rays", runner.num_rays()},
+        {"rays_per_second", runner.rays_per_second()},
         {
             "runtime",
             {
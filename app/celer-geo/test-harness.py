@@ -48,6 +48,7 @@ commands = [
         "image": image,
         "volumes": True,
         "bin_file": f"{problem_name}.orange.bin",
+        "preview": 4,
     },
     {
         # Reuse image setup
@@ -58,6 +59,14 @@ commands = [
         "bin_file": f"{problem_name}.vecgeom.bin",
         "geometry": "vecgeom",
     },
+    {
+        # Compare converted geometry against the original
+        "check": {
+            "geometry": "orange",
+            "reference": "geant4",
+            "num_points": 1024,
+        },
+    },
 ]
 
 filename = f"{problem_name}.inp.jsonl"
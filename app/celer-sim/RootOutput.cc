@@ -14,6 +14,7 @@
 #include "corecel/sys/ActionRegistry.hh"
 #include "celeritas/ext/GeantPhysicsOptionsIO.json.hh"
 #include "celeritas/global/CoreParams.hh"
+#include "celeritas/user/MeshCalo.hh"
 
 #include "RunnerInput.hh"
 #include "RunnerInputIO.json.hh"
@@ -77,6 +78,37 @@ void write_to_root(CoreParams const& core_params, RootFileManager* root_manager)
     tree_params->Fill();  // Writing happens at destruction
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Store the mesh energy deposition to the ROOT MC truth output file.
+ *
+ * The mesh is stored as a single entry: the bins are flattened in the same
+ * order as the JSON output, with the last axis varying fastest.
+ */
+void write_to_root(MeshCalo const& mesh_calo, RootFileManager* root_manager)
+{
+    CELER_EXPECT(root_manager);
+
+    auto const& inp = mesh_calo.input();
+    std::string type = to_cstring(inp.type);
+    std::vector<double> origin(inp.origin.begin(), inp.origin.end());
+    std::vector<double> lower(inp.lower.begin(), inp.lower.end());
+    std::vector<double> upper(inp.upper.begin(), inp.upper.end());
+    std::vector<unsigned int> num_bins(inp.num_bins.begin(),
+                                       inp.num_bins.end());
+    auto edep_real = mesh_calo.calc_total_energy_deposition();
+    std::vector<double> edep(edep_real.begin(), edep_real.end());
+
+    auto tree_mesh = root_manager->make_tree("mesh_calo", "mesh_calo");
+    tree_mesh->Branch("type", &type);
+    tree_mesh->Branch("origin", &origin);
+    tree_mesh->Branch("lower", &lower);
+    tree_mesh->Branch("upper", &upper);
+    tree_mesh->Branch("num_bins", &num_bins);
+    tree_mesh->Branch("energy_deposition", &edep);
+    tree_mesh->Fill();  // Writing happens at destruction
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace app
 }  // namespace celeritas
@@ -15,6 +15,7 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 class CoreParams;
+class MeshCalo;
 class RootFileManager;
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -35,6 +36,9 @@ void write_to_root(RunnerInput const& cargs, RootFileManager* root_manager);
 void write_to_root(CoreParams const& core_params,
                    RootFileManager* root_manager);
 
+// Store mesh energy deposition to ROOT file when ROOT is available
+void write_to_root(MeshCalo const& mesh_calo, RootFileManager* root_manager);
+
 //---------------------------------------------------------------------------//
 
 #if !CELERITAS_USE_ROOT
@@ -47,6 +51,11 @@ inline void write_to_root(CoreParams const&, RootFileManager*)
 {
     CELER_NOT_CONFIGURED("ROOT");
 }
+
+inline void write_to_root(MeshCalo const&, RootFileManager*)
+{
+    CELER_NOT_CONFIGURED("ROOT");
+}
 #endif
 
 //---------------------------------------------------------------------------//
@@ -43,6 +43,7 @@
 #include "celeritas/field/UniformFieldData.hh"
 #include "celeritas/geo/GeoMaterialParams.hh"
 #include "celeritas/geo/GeoParams.hh"  // IWYU pragma: keep
+#include "celeritas/global/ActionSequenceOutput.hh"
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/io/EventReader.hh"
 #include "celeritas/io/RootEventReader.hh"
@@ -60,10 +61,12 @@
 #include "celeritas/phys/Process.hh"
 #include "celeritas/phys/ProcessBuilder.hh"
 #include "celeritas/phys/RootEventSampler.hh"
+#include "celeritas/phys/UserLimitsParams.hh"
 #include "celeritas/random/RngParams.hh"
 #include "celeritas/track/SimParams.hh"
 #include "celeritas/track/TrackInitParams.hh"
 #include "celeritas/user/ActionDiagnostic.hh"
+#include "celeritas/user/MeshCalo.hh"
 #include "celeritas/user/RootStepWriter.hh"
 #include "celeritas/user/SimpleCalo.hh"
 #include "celeritas/user/SlotDiagnostic.hh"
@@ -260,6 +263,39 @@ auto Runner::get_action_times() const -> MapStrDouble
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the accumulated action diagnostics summed over all streams.
+ */
+auto Runner::get_action_diagnostics() const
+    -> std::shared_ptr<ActionSequenceOutput>
+{
+    auto result = std::make_shared<ActionSequenceOutput>();
+    for (auto sid : range(StreamId{this->num_streams()}))
+    {
+        if (auto* transport = this->get_transporter_ptr(sid))
+        {
+            transport->accum_action_diagnostics(result.get());
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write end-of-run tallies to the ROOT output file.
+ *
+ * The mesh energy deposition is only available after all events have been
+ * transported.
+ */
+void Runner::finalize()
+{
+    if (root_manager_ && mesh_calo_)
+    {
+        write_to_root(*mesh_calo_, root_manager_.get());
+    }
+}
+
 //---------------------------------------------------------------------------//
 void Runner::setup_globals(RunnerInput const& inp) const
 {
@@ -352,6 +388,7 @@ void Runner::build_core_params(RunnerInput const& inp,
         input.options.lowest_electron_energy = PhysicsParamsOptions::Energy(
             imported.em_params.lowest_electron_energy);
         input.options.spline_eloss_order = inp.spline_eloss_order;
+        input.options.gamma_general = inp.physics_options.gamma_general;
 
         input.processes = [&params, &inp, &imported] {
             std::vector<std::shared_ptr<Process const>> result;
@@ -444,6 +481,12 @@ void Runner::build_core_params(RunnerInput const& inp,
     }();
 
     core_params_ = std::make_shared<CoreParams>(std::move(params));
+
+    // Apply step limits and tracking cuts from Geant4 user limits
+    if (auto input = UserLimitsParams::Input::from_import(imported))
+    {
+        UserLimitsParams::make_and_insert(*core_params_, input);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -464,6 +507,8 @@ void Runner::build_transporter_input(RunnerInput const& inp)
     transporter_input_->store_track_counts = inp.write_track_counts;
     transporter_input_->store_step_times = inp.write_step_times;
     transporter_input_->action_times = inp.action_times;
+    transporter_input_->action_counts = inp.action_counts;
+    transporter_input_->perf_counters = inp.perf_counters;
     transporter_input_->params = core_params_;
 }
 
@@ -574,6 +619,21 @@ void Runner::build_step_collectors(RunnerInput const& inp)
             core_params_->aux_reg().get(),
             core_params_->action_reg().get());
     }
+
+    if (inp.mesh_calo)
+    {
+        mesh_calo_ = std::make_shared<MeshCalo>(inp.mesh_calo,
+                                                core_params_->max_streams());
+        core_params_->output_reg()->insert(mesh_calo_);
+
+        // The mesh records every step, so it can't share a collector with
+        // detector-filtered interfaces
+        mesh_collector_ = std::make_unique<StepCollector>(
+            core_params_->geometry(),
+            StepCollector::VecInterface{mesh_calo_},
+            core_params_->aux_reg().get(),
+            core_params_->action_reg().get());
+    }
 }
 
 //---------------------------------------------------------------------------//
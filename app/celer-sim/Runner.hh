@@ -23,7 +23,9 @@ class G4VPhysicalVolume;  // IWYU pragma: keep
 
 namespace celeritas
 {
+class ActionSequenceOutput;
 class CoreParams;
+class MeshCalo;
 class OpticalCollector;
 class OutputRegistry;
 class ParticleParams;
@@ -75,6 +77,12 @@ class Runner
     // Get the accumulated action times
     MapStrDouble get_action_times() const;
 
+    // Get the accumulated action diagnostics
+    std::shared_ptr<ActionSequenceOutput> get_action_diagnostics() const;
+
+    // Write end-of-run tallies to the ROOT output file
+    void finalize();
+
   private:
     //// TYPES ////
 
@@ -88,6 +96,8 @@ class Runner
     std::shared_ptr<CoreParams> core_params_;
     std::shared_ptr<RootFileManager> root_manager_;
     std::shared_ptr<StepCollector> step_collector_;
+    std::shared_ptr<MeshCalo> mesh_calo_;
+    std::shared_ptr<StepCollector> mesh_collector_;
     std::shared_ptr<OpticalCollector> optical_collector_;
 
     // Transporter inputs and stream-local transporters
@@ -19,6 +19,7 @@
 #include "celeritas/ext/RootFileManager.hh"
 #include "celeritas/field/FieldDriverOptions.hh"
 #include "celeritas/phys/PrimaryGeneratorOptions.hh"
+#include "celeritas/user/MeshCalo.hh"
 #include "celeritas/user/RootStepWriter.hh"
 
 #ifdef _WIN32
@@ -93,6 +94,7 @@ struct RunnerInput
     std::string tracing_file;
     SimpleRootFilterInput mctruth_filter;
     std::vector<Label> simple_calo;
+    MeshCaloInput mesh_calo;  //!< Energy deposition mesh (JSON and ROOT)
     bool action_diagnostic{};
     bool step_diagnostic{};
     int step_diagnostic_bins{1000};
@@ -109,6 +111,8 @@ struct RunnerInput
     real_type secondary_stack_factor{};
     bool use_device{};
     bool action_times{};
+    bool action_counts{};  //!< Count tracks each action applies to
+    bool perf_counters{};  //!< Read CPU hardware counters for each action
     bool merge_events{false};  //!< Run all events at once on a single stream
     bool default_stream{false};  //!< Launch all kernels on the default stream
     bool warm_up{false};  //!< Run a nullop step first
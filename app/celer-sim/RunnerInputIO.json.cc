@@ -22,6 +22,7 @@
 #include "celeritas/ext/GeantPhysicsOptionsIO.json.hh"
 #include "celeritas/field/FieldDriverOptionsIO.json.hh"
 #include "celeritas/phys/PrimaryGeneratorOptionsIO.json.hh"
+#include "celeritas/user/MeshCaloIO.json.hh"
 #include "celeritas/user/RootStepWriterIO.json.hh"
 
 namespace celeritas
@@ -73,6 +74,7 @@ void from_json(nlohmann::json const& j, RunnerInput& v)
     LDIO_LOAD_OPTION(tracing_file);
     LDIO_LOAD_OPTION(mctruth_filter);
     LDIO_LOAD_OPTION(simple_calo);
+    LDIO_LOAD_OPTION(mesh_calo);
     LDIO_LOAD_OPTION(action_diagnostic);
     LDIO_LOAD_OPTION(step_diagnostic);
     LDIO_LOAD_OPTION(step_diagnostic_bins);
@@ -91,6 +93,8 @@ void from_json(nlohmann::json const& j, RunnerInput& v)
     LDIO_LOAD_OPTION(spline_eloss_order);
     LDIO_LOAD_REQUIRED(use_device);
     LDIO_LOAD_OPTION(action_times);
+    LDIO_LOAD_OPTION(action_counts);
+    LDIO_LOAD_OPTION(perf_counters);
     LDIO_LOAD_OPTION(merge_events);
     LDIO_LOAD_OPTION(default_stream);
     if (auto iter = j.find("warm_up"); iter != j.end())
@@ -172,6 +176,7 @@ void to_json(nlohmann::json& j, RunnerInput const& v)
     LDIO_SAVE_WHEN(tracing_file, CELERITAS_USE_PERFETTO);
     LDIO_SAVE_WHEN(mctruth_filter, !v.mctruth_file.empty());
     LDIO_SAVE(simple_calo);
+    LDIO_SAVE_WHEN(mesh_calo, static_cast<bool>(v.mesh_calo));
     LDIO_SAVE(action_diagnostic);
     LDIO_SAVE(step_diagnostic);
     LDIO_SAVE_OPTION(step_diagnostic_bins);
@@ -187,6 +192,8 @@ void to_json(nlohmann::json& j, RunnerInput const& v)
     LDIO_SAVE_OPTION(spline_eloss_order);
     LDIO_SAVE(use_device);
     LDIO_SAVE(action_times);
+    LDIO_SAVE(action_counts);
+    LDIO_SAVE(perf_counters);
     LDIO_SAVE(merge_events);
     LDIO_SAVE(default_stream);
     LDIO_SAVE(warm_up);
@@ -24,6 +24,7 @@
 #include "corecel/sys/ScopedSignalHandler.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/global/ActionSequence.hh"
+#include "celeritas/global/ActionSequenceOutput.hh"
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/global/Stepper.hh"
 #include "celeritas/phys/Model.hh"
@@ -58,6 +59,8 @@ Transporter<M>::Transporter(TransporterInput inp)
     step_input.num_track_slots = inp.num_track_slots;
     step_input.stream_id = inp.stream_id;
     step_input.action_times = inp.action_times;
+    step_input.action_counts = inp.action_counts;
+    step_input.perf_counters = inp.perf_counters;
     stepper_ = std::make_shared<Stepper<M>>(std::move(step_input));
 }
 
@@ -204,6 +207,18 @@ void Transporter<M>::accum_action_times(MapStrDouble* result) const
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate action diagnostics across all threads.
+ */
+template<MemSpace M>
+void Transporter<M>::accum_action_diagnostics(
+    ActionSequenceOutput* result) const
+{
+    CELER_EXPECT(result);
+    result->accumulate(stepper_->actions());
+}
+
 //---------------------------------------------------------------------------//
 // EXPLICIT INSTANTIATION
 //---------------------------------------------------------------------------//
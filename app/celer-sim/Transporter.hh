@@ -21,6 +21,7 @@
 
 namespace celeritas
 {
+class ActionSequenceOutput;
 struct Primary;
 template<MemSpace M>
 class Stepper;
@@ -40,6 +41,8 @@ struct TransporterInput
     size_type num_track_slots{};  //!< AKA max_num_tracks
     bool action_times{false};  //!< Whether to synchronize device between
                                //!< actions for timing
+    bool action_counts{false};  //!< Count applicable tracks per action
+    bool perf_counters{false};  //!< Read CPU hardware counters
 
     // Loop control
     size_type max_steps{};
@@ -112,6 +115,9 @@ class TransporterBase
 
     //! Accumulate action times into the map
     virtual void accum_action_times(MapStrDouble*) const = 0;
+
+    //! Accumulate action diagnostics into the output
+    virtual void accum_action_diagnostics(ActionSequenceOutput*) const = 0;
 };
 
 //---------------------------------------------------------------------------//
@@ -134,6 +140,9 @@ class Transporter final : public TransporterBase
     // Accumulate action times into the map
     void accum_action_times(MapStrDouble*) const final;
 
+    // Accumulate action diagnostics into the output
+    void accum_action_diagnostics(ActionSequenceOutput*) const final;
+
   private:
     std::shared_ptr<Stepper<M>> stepper_;
     size_type max_steps_;
@@ -41,6 +41,7 @@
 #include "corecel/sys/Stopwatch.hh"
 #include "corecel/sys/TracingSession.hh"
 #include "celeritas/Types.hh"
+#include "celeritas/global/ActionSequenceOutput.hh"
 
 #include "Runner.hh"
 #include "RunnerInput.hh"
@@ -138,8 +139,14 @@ void run(std::istream* is, std::shared_ptr<OutputRegistry> output)
         log_and_rethrow(std::move(capture_exception));
     }
     result.action_times = run_stream.get_action_times();
+    if (run_input->action_times || run_input->action_counts
+        || run_input->perf_counters)
+    {
+        output->insert(run_stream.get_action_diagnostics());
+    }
     result.total_time = get_transport_time();
     record_mem = {};
+    run_stream.finalize();
     output->insert(std::make_shared<RunnerOutput>(std::move(result)));
 }
 
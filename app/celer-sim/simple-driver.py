@@ -74,8 +74,17 @@ if core_geo == "orange-json":
     geometry_filename = re.sub(r"\.gdml$", ".org.json", geometry_filename)
 
 simple_calo = []
-if not rootout_filename and "cms" in geometry_filename:
-    simple_calo = ["si_tracker", "em_calorimeter"]
+mesh_calo = None
+if "cms" in geometry_filename:
+    if not rootout_filename:
+        simple_calo = ["si_tracker", "em_calorimeter"]
+    # Score the barrel on a cylindrical mesh alongside the detectors
+    mesh_calo = {
+        'type': 'cylindrical',
+        'lower': [0, -3.141592653589793, -700],
+        'upper': [700, 3.141592653589793, 700],
+        'num_bins': [70, 1, 14],
+    }
 
 num_tracks = 128 * 32 if use_device else 32
 num_primaries = 3 * 15 # assuming test hepmc input
@@ -112,6 +121,7 @@ inp = {
     'step_diagnostic_bins': 200,
     'write_step_times': use_device,
     'simple_calo': simple_calo,
+    'mesh_calo': mesh_calo,
     'action_times': True,
     'merge_events': False,
     'default_stream': False,
@@ -172,4 +182,11 @@ else:
     # Step times disabled on CPU from input
     assert steps is None
 
+if mesh_calo:
+    mesh_edep = j['result']['mesh_calo']['energy_deposition']
+    assert len(mesh_edep) == 70 * 14
+    assert sum(mesh_edep) > 0
+if simple_calo:
+    assert len(j['result']['simple_calo']['energy_deposition']) == 2
+
 print(json.dumps(time, indent=1))
@@ -54,6 +54,7 @@
 #include "celeritas/phys/PhysicsParams.hh"
 #include "celeritas/phys/Process.hh"
 #include "celeritas/phys/ProcessBuilder.hh"
+#include "celeritas/phys/UserLimitsParams.hh"
 #include "celeritas/random/RngParams.hh"
 #include "celeritas/track/SimParams.hh"
 #include "celeritas/track/TrackInitParams.hh"
@@ -609,6 +610,12 @@ void SharedParams::initialize_core(SetupOptions const& options)
     CELER_ASSERT(params);
     params_ = std::make_shared<CoreParams>(std::move(params));
 
+    // Apply step limits and tracking cuts from Geant4 user limits
+    if (auto input = UserLimitsParams::Input::from_import(*imported))
+    {
+        UserLimitsParams::make_and_insert(*params_, input);
+    }
+
     // Construct sensitive detector callback
     if (options.sd)
     {
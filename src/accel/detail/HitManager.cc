@@ -67,6 +67,7 @@ HitManager::HitManager(SPConstGeo geo,
     // Convert setup options to step data
     selection_.particle = setup.track;
     selection_.energy_deposition = setup.energy_deposition;
+    selection_.weight = true;
     update_selection(&selection_.points[StepPoint::pre], setup.pre);
     update_selection(&selection_.points[StepPoint::post], setup.post);
     if (locate_touchable_)
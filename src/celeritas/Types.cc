@@ -53,6 +53,8 @@ char const* to_cstring(TrackOrder value)
     static EnumStringMapper<TrackOrder> const to_cstring_impl{
         "none",
         "init_charge",
+        "init_particle",
+        "init_material",
         "reindex_shuffle",
         "reindex_status",
         "reindex_particle_type",
@@ -26,6 +26,15 @@ namespace celeritas
 // TYPE ALIASES
 //---------------------------------------------------------------------------//
 
+#if CELERITAS_TABLE_REAL_TYPE == CELERITAS_TABLE_REAL_TYPE_DOUBLE
+//! Storage type for tabulated cross section and energy loss values
+using table_real_type = double;
+#elif CELERITAS_TABLE_REAL_TYPE == CELERITAS_TABLE_REAL_TYPE_FLOAT
+using table_real_type = float;
+#else
+using table_real_type = void;
+#endif
+
 //! Opaque index to ElementRecord in the global vector of elements
 using ElementId = OpaqueId<struct ElementRecord>;
 
@@ -54,6 +63,9 @@ using ParticleId = OpaqueId<struct Particle_>;
 //! Opaque index of physics process
 using ProcessId = OpaqueId<struct Process_>;
 
+//! Opaque index of a region with shared cuts and user limits
+using RegionId = OpaqueId<struct Region_>;
+
 //! Unique ID (for an event) of a track among all primaries and secondaries
 using TrackId = OpaqueId<struct Track_>;
 
@@ -139,12 +151,16 @@ enum class StepPoint
  *    track slot. (\c none )
  * 2. The location of new track slots is biased during track initialization:
  *    charged and neutral tracks are inserted at opposite sides of the track
- *    slot vacancies. (\c init_charge )
+ *    slot vacancies (\c init_charge ), or new tracks are sorted into
+ *    vacancies in order of their particle type (\c init_particle ) or their
+ *    parent's material (\c init_material ).
  * 3. Tracks are \em reindexed one or more times per step so that the layout
  *    in memory is unchanged but an additional indirection maps threads onto
  *    different track slots based on particle attributes (\c reindex_status,
  *    \c reindex_particle_type ), actions (\c reindex_along_step_action,
- *    \c reindex_step_limit_action, \c reindex_both_action ).
+ *    \c reindex_step_limit_action, \c reindex_both_action ). When sorting by
+ *    particle type, neutral and charged tracks are grouped separately so that
+ *    each along-step action is launched only over its own range of threads.
  * 4. As a control to measure the cost of indirection, the track slots can be
  *    reindexed randomly at the beginning of execution (\c reindex_shuffle ).
  */
@@ -154,12 +170,14 @@ enum class TrackOrder
     begin_layout_,
     //! Partition data layout of new tracks by charged vs neutral
     init_charge = begin_layout_,
+    init_particle,  //!< Sort new tracks into vacancies by particle type
+    init_material,  //!< Sort new tracks by the material of the parent
     end_layout_,
     begin_reindex_ = end_layout_,
     //!< Shuffle at the start of the simulation
     reindex_shuffle = begin_reindex_,
     reindex_status,  //!< Partition by active/inactive status
-    reindex_particle_type,  //!< Sort by particle type
+    reindex_particle_type,  //!< Sort by charge and particle type
     begin_reindex_action_,
     //! Sort only by the along-step action id
     reindex_along_step_action = begin_reindex_action_,
@@ -219,6 +237,15 @@ CELER_CONSTEXPR_FUNCTION bool is_track_valid(TrackStatus status)
     return status != TrackStatus::inactive && status != TrackStatus::errored;
 }
 
+//---------------------------------------------------------------------------//
+//! Whether new tracks are sorted into vacant track slots when initialized
+CELER_CONSTEXPR_FUNCTION bool is_init_sorted(TrackOrder order)
+{
+    auto to_int = [](TrackOrder v) { return static_cast<int>(v); };
+    return to_int(order) >= to_int(TrackOrder::begin_layout_)
+           && to_int(order) < to_int(TrackOrder::end_layout_);
+}
+
 //---------------------------------------------------------------------------//
 // HELPER FUNCTIONS (HOST)
 //---------------------------------------------------------------------------//
@@ -0,0 +1,112 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/alongstep/AlongStepWoodcockAction.cc
+//---------------------------------------------------------------------------//
+#include "AlongStepWoodcockAction.hh"
+
+#include <algorithm>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "celeritas/geo/GeoMaterialParams.hh"
+#include "celeritas/global/ActionLauncher.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+
+#include "detail/WoodcockApplier.hh"  // IWYU pragma: associated
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with next action ID and regions.
+ */
+AlongStepWoodcockAction::AlongStepWoodcockAction(
+    ActionId id, GeoMaterialParams const& geo_mat, Input const& input)
+    : id_(id)
+{
+    CELER_EXPECT(id_);
+    CELER_VALIDATE(!input.regions.empty(),
+                   << "no Woodcock tracking regions were specified");
+
+    HostVal<WoodcockParamsData> host_data;
+    auto regions = make_builder(&host_data.regions);
+    auto materials = make_builder(&host_data.materials);
+    regions.reserve(input.regions.size());
+    for (auto const& inp : input.regions)
+    {
+        CELER_VALIDATE(inp.bbox,
+                       << "invalid Woodcock tracking region: a bounding box "
+                          "is required");
+
+        // Get the unique materials in the region, or in the whole problem if
+        // no volumes are given
+        std::vector<MaterialId> region_mats;
+        for (VolumeId vol_id : inp.volumes)
+        {
+            CELER_VALIDATE(vol_id < geo_mat.num_volumes(),
+                           << "invalid volume ID " << vol_id.unchecked_get()
+                           << " in Woodcock tracking region");
+            if (MaterialId mat_id = geo_mat.material_id(vol_id))
+            {
+                region_mats.push_back(mat_id);
+            }
+        }
+        if (inp.volumes.empty())
+        {
+            for (auto vol_id : range(VolumeId{geo_mat.num_volumes()}))
+            {
+                if (MaterialId mat_id = geo_mat.material_id(vol_id))
+                {
+                    region_mats.push_back(mat_id);
+                }
+            }
+        }
+        std::sort(region_mats.begin(), region_mats.end());
+        region_mats.erase(std::unique(region_mats.begin(), region_mats.end()),
+                          region_mats.end());
+        CELER_VALIDATE(!region_mats.empty(),
+                       << "Woodcock tracking region has no materials");
+
+        WoodcockRegion region;
+        region.bbox = inp.bbox;
+        region.materials
+            = materials.insert_back(region_mats.begin(), region_mats.end());
+        regions.push_back(region);
+    }
+
+    data_ = CollectionMirror<WoodcockParamsData>{std::move(host_data)};
+    CELER_ENSURE(data_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the along-step action on host.
+ */
+void AlongStepWoodcockAction::step(CoreParams const& params,
+                                   CoreStateHost& state) const
+{
+    auto execute = make_along_step_track_executor(
+        params.ptr<MemSpace::native>(),
+        state.ptr(),
+        this->action_id(),
+        detail::WoodcockApplier{this->host_ref()});
+    return launch_action(*this, params, state, execute);
+}
+
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+void AlongStepWoodcockAction::step(CoreParams const&, CoreStateDevice&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,36 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/alongstep/AlongStepWoodcockAction.cu
+//---------------------------------------------------------------------------//
+#include "AlongStepWoodcockAction.hh"
+
+#include "celeritas/global/ActionLauncher.device.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+
+#include "detail/WoodcockApplier.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the along-step action on device.
+ */
+void AlongStepWoodcockAction::step(CoreParams const& params,
+                                   CoreStateDevice& state) const
+{
+    auto execute = make_along_step_track_executor(
+        params.ptr<MemSpace::native>(),
+        state.ptr(),
+        this->action_id(),
+        detail::WoodcockApplier{this->device_ref()});
+    static ActionLauncher<decltype(execute)> const launch_kernel(*this);
+    launch_kernel(*this, params, state, execute);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
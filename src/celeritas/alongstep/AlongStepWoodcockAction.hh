@@ -0,0 +1,107 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/alongstep/AlongStepWoodcockAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "corecel/data/CollectionMirror.hh"
+#include "corecel/data/ParamsDataInterface.hh"
+#include "geocel/BoundingBox.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/global/ActionInterface.hh"
+
+#include "WoodcockData.hh"
+
+namespace celeritas
+{
+class GeoMaterialParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Along-step kernel for neutral particles with Woodcock tracking.
+ *
+ * In finely segmented geometries such as sampling calorimeters, most steps
+ * taken by photons end at a volume boundary without an interaction. Inside
+ * the given regions, this action instead samples flights using the majorant
+ * cross section over the region's materials and only locates the track at
+ * tentative collision sites (Woodcock or "delta" tracking). Outside the
+ * regions, and for charged particles, it behaves like \c
+ * AlongStepNeutralAction .
+ *
+ * Each region is an axis-aligned box along with the volumes inside it, which
+ * are used to determine the set of materials for the majorant. If no volumes
+ * are given, the majorant is taken over every material in the problem. The
+ * box must be inside the world and the volumes must cover every material in
+ * the box: a track that starts or collides in a material missing from its
+ * region is killed with an error. Woodcock tracking begins with the first
+ * step that starts inside a region.
+ *
+ * To replace the default neutral along-step action, register this action and
+ * pass it as \c CoreParams::Input::along_step_neutral . Since steps inside a
+ * region skip volume boundaries, step-collector data and sensitive detectors
+ * are not notified of boundary crossings there.
+ */
+class AlongStepWoodcockAction final
+    : public CoreStepActionInterface,
+      public ParamsDataInterface<WoodcockParamsData>
+{
+  public:
+    //! A box with the volumes that fill it
+    struct Region
+    {
+        BBox bbox;
+        std::vector<VolumeId> volumes;  //!< Empty for all volumes
+    };
+
+    //! Input for constructing Woodcock regions
+    struct Input
+    {
+        std::vector<Region> regions;
+    };
+
+  public:
+    // Construct with next action ID and regions
+    AlongStepWoodcockAction(ActionId id,
+                            GeoMaterialParams const& geo_mat,
+                            Input const& input);
+
+    // Launch kernel with host data
+    void step(CoreParams const&, CoreStateHost&) const final;
+
+    // Launch kernel with device data
+    void step(CoreParams const&, CoreStateDevice&) const final;
+
+    //! ID of the model
+    ActionId action_id() const final { return id_; }
+
+    //! Short name for the along-step kernel
+    std::string_view label() const final { return "along-step-woodcock"; }
+
+    //! Short description of the action
+    std::string_view description() const final
+    {
+        return "apply along-step for neutral particles with Woodcock "
+               "tracking";
+    }
+
+    //! Dependency ordering of the action
+    StepActionOrder order() const final { return StepActionOrder::along; }
+
+    //! Access data on the host
+    HostRef const& host_ref() const final { return data_.host_ref(); }
+    //! Access data on the device
+    DeviceRef const& device_ref() const final { return data_.device_ref(); }
+
+  private:
+    ActionId id_;
+    CollectionMirror<WoodcockParamsData> data_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
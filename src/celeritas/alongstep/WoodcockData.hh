@@ -0,0 +1,77 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/alongstep/WoodcockData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/data/Collection.hh"
+#include "geocel/BoundingBox.hh"
+#include "celeritas/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Spatial region in which neutral particles use Woodcock tracking.
+ *
+ * The region is an axis-aligned box, and the majorant cross section is the
+ * maximum over the given materials, which must include every material inside
+ * the box.
+ */
+struct WoodcockRegion
+{
+    BoundingBox<real_type> bbox;
+    ItemRange<MaterialId> materials;
+
+    //! Whether the region is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return static_cast<bool>(bbox) && !materials.empty();
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Regions for Woodcock (delta) tracking.
+ */
+template<Ownership W, MemSpace M>
+struct WoodcockParamsData
+{
+    //// TYPES ////
+
+    template<class T>
+    using Items = Collection<T, W, M>;
+
+    //// DATA ////
+
+    //! Non-overlapping tracking regions
+    Items<WoodcockRegion> regions;
+    //! Materials in each region
+    Items<MaterialId> materials;
+
+    //// METHODS ////
+
+    //! Whether the data are assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !regions.empty() && !materials.empty();
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    WoodcockParamsData& operator=(WoodcockParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        regions = other.regions;
+        materials = other.materials;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,341 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/alongstep/detail/WoodcockApplier.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "corecel/math/NumericLimits.hh"
+#include "geocel/BoundingBox.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/phys/PhysicsStepUtils.hh"
+#include "celeritas/random/distribution/ExponentialDistribution.hh"
+#include "celeritas/random/distribution/GenerateCanonical.hh"
+
+#include "AlongStepNeutralImpl.hh"
+#include "LinearPropagatorFactory.hh"
+#include "../AlongStep.hh"
+#include "../WoodcockData.hh"
+
+#if !CELER_DEVICE_COMPILE
+#    include "corecel/io/Logger.hh"
+#endif
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Transport a neutral track with Woodcock tracking inside a region.
+ *
+ * Inside a region, flights are sampled with the majorant cross section (the
+ * maximum total cross section over the region's materials at the track's
+ * energy) and the track is point-located at each tentative collision site.
+ * The collision is real with probability \f$ \Sigma(\vec x) / \Sigma_{maj}
+ * \f$; otherwise it is a "virtual" collision and a new flight is sampled.
+ * Volume boundaries inside the region are never intersected.
+ *
+ * A real collision ends the step with the discrete interaction action. If the
+ * track instead leaves the region, it is located at the exit point and the
+ * step is completed with ordinary linear propagation using the remaining
+ * number of mean free paths. Tracks outside all regions, and charged tracks,
+ * use ordinary neutral propagation.
+ */
+struct WoodcockApplier
+{
+    //// TYPES ////
+
+    using ParamsRef = NativeCRef<WoodcockParamsData>;
+    using Energy = ParticleTrackView::Energy;
+
+    //// DATA ////
+
+    ParamsRef params;
+
+    //// METHODS ////
+
+    inline CELER_FUNCTION void operator()(CoreTrackView& track);
+
+  private:
+    // Find the region containing the track, and the distance to its exit
+    inline CELER_FUNCTION WoodcockRegion const*
+    find_region(Real3 const& pos, Real3 const& dir, real_type* exit) const;
+
+    // Whether a material is one of the region's majorant materials
+    inline CELER_FUNCTION bool
+    has_material(WoodcockRegion const& region, MaterialId mat_id) const;
+
+    // Calculate and save per-process cross sections in a material
+    static inline CELER_FUNCTION real_type
+    calc_total_xs(PhysicsTrackView const& phys,
+                  MaterialView const& mat,
+                  Energy energy,
+                  PhysicsStepView* step);
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Apply Woodcock tracking or fall back to neutral propagation.
+ */
+CELER_FUNCTION void WoodcockApplier::operator()(CoreTrackView& track)
+{
+    auto along_step = AlongStep{NoMsc{}, LinearPropagatorFactory{}, NoELoss{}};
+
+    auto particle = track.make_particle_view();
+    auto geo = track.make_geo_view();
+    real_type exit_dist{0};
+    WoodcockRegion const* region = nullptr;
+    if (particle.charge() == zero_quantity() && !particle.is_stopped())
+    {
+        region = this->find_region(geo.pos(), geo.dir(), &exit_dist);
+    }
+    if (!region)
+    {
+        return along_step(track);
+    }
+
+    auto mat = track.make_material_view();
+    if (CELER_UNLIKELY(!this->has_material(*region, mat.material_id())))
+    {
+#if !CELER_DEVICE_COMPILE
+        CELER_LOG_LOCAL(error) << "Track started in material "
+                               << mat.material_id().unchecked_get()
+                               << " that is missing from its Woodcock "
+                                  "tracking region";
+#endif
+        track.apply_errored();
+        return;
+    }
+
+    // Calculate the majorant cross section at the (constant) track energy
+    real_type maj_xs{0};
+    for (MaterialId mat_id : params.materials[region->materials])
+    {
+        maj_xs = max(maj_xs,
+                     this->calc_total_xs(track.make_physics_view(mat_id),
+                                         track.make_material_view(mat_id),
+                                         particle.energy(),
+                                         nullptr));
+    }
+    if (maj_xs == 0)
+    {
+        return along_step(track);
+    }
+
+    auto phys = track.make_physics_view();
+    auto step = track.make_physics_step_view();
+    auto rng = track.make_rng_engine();
+    Real3 pos = geo.pos();
+    Real3 const dir = geo.dir();
+    real_type distance{0};
+    bool collided{false};
+    do
+    {
+        real_type flight = phys.interaction_mfp() / maj_xs;
+        if (flight >= exit_dist)
+        {
+            // Leave the region with the remaining mean free paths
+            real_type mfp = phys.interaction_mfp() - exit_dist * maj_xs;
+            if (!(mfp > 0))
+            {
+                ExponentialDistribution<real_type> sample_exponential;
+                mfp = sample_exponential(rng);
+            }
+            phys.interaction_mfp(mfp);
+            flight = exit_dist;
+        }
+        else
+        {
+            collided = true;
+        }
+        axpy(flight, dir, &pos);
+        distance += flight;
+        exit_dist -= flight;
+
+        // Locate the tentative collision site (or exit point)
+        geo = GeoTrackInitializer{pos, dir};
+        if (CELER_UNLIKELY(geo.failed() || geo.is_outside()))
+        {
+#if !CELER_DEVICE_COMPILE
+            if (!geo.failed())
+            {
+                CELER_LOG_LOCAL(error) << "Woodcock tracking region extends "
+                                          "outside the geometry";
+            }
+#endif
+            track.apply_errored();
+            return;
+        }
+        MaterialId mat_id
+            = track.make_geo_material_view().material_id(geo.volume_id());
+        if (CELER_UNLIKELY(!mat_id))
+        {
+#if !CELER_DEVICE_COMPILE
+            CELER_LOG_LOCAL(error)
+                << R"(Track entered a volume without an associated material)";
+#endif
+            track.apply_errored();
+            return;
+        }
+        mat = {mat_id};
+
+        if (collided)
+        {
+            if (CELER_UNLIKELY(!this->has_material(*region, mat_id)))
+            {
+                // The majorant does not bound the cross section here
+#if !CELER_DEVICE_COMPILE
+                CELER_LOG_LOCAL(error)
+                    << "Tentative collision in material "
+                    << mat_id.unchecked_get()
+                    << " that is missing from its Woodcock tracking region";
+#endif
+                track.apply_errored();
+                return;
+            }
+
+            // Accept the collision with the ratio of the true cross section
+            real_type xs = this->calc_total_xs(track.make_physics_view(),
+                                               mat.make_material_view(),
+                                               particle.energy(),
+                                               &step);
+            if (generate_canonical(rng) * maj_xs >= xs)
+            {
+                // Virtual collision: sample a new flight
+                ExponentialDistribution<real_type> sample_exponential;
+                phys.interaction_mfp(sample_exponential(rng));
+                collided = false;
+            }
+            else
+            {
+                step.macro_xs(xs);
+            }
+        }
+    } while (!collided && exit_dist > 0);
+
+    auto sim = track.make_sim_view();
+    real_type speed = native_value_from(particle.speed());
+    if (speed > 0)
+    {
+        sim.add_time(distance / speed);
+    }
+
+    if (collided)
+    {
+        // Interact at the current point
+        sim.reset_step_limit({distance, phys.scalars().discrete_action()});
+        TrackUpdater{}(track);
+        return;
+    }
+
+    // Complete the step with ordinary tracking from the exit point
+    {
+        auto exit_phys = track.make_physics_view();
+        sim.reset_step_limit(
+            calc_physics_step_limit(mat, particle, exit_phys, step));
+    }
+    along_step(track);
+    if (sim.status() != TrackStatus::errored)
+    {
+        sim.step_length(sim.step_length() + distance);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the region containing the track, and the distance to its exit.
+ *
+ * Tracks on the surface of a region and heading out of it are not in it.
+ */
+CELER_FUNCTION WoodcockRegion const*
+WoodcockApplier::find_region(Real3 const& pos,
+                             Real3 const& dir,
+                             real_type* exit) const
+{
+    for (auto rid : range(ItemId<WoodcockRegion>{params.regions.size()}))
+    {
+        auto const& bbox = params.regions[rid].bbox;
+        if (!is_inside(bbox, pos))
+        {
+            continue;
+        }
+
+        real_type dist = numeric_limits<real_type>::infinity();
+        for (auto ax : range(3))
+        {
+            if (dir[ax] > 0)
+            {
+                dist = min(dist, (bbox.upper()[ax] - pos[ax]) / dir[ax]);
+            }
+            else if (dir[ax] < 0)
+            {
+                dist = min(dist, (bbox.lower()[ax] - pos[ax]) / dir[ax]);
+            }
+        }
+        if (dist > 0)
+        {
+            *exit = dist;
+            return &params.regions[rid];
+        }
+    }
+    return nullptr;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether a material is one of the region's majorant materials.
+ */
+CELER_FUNCTION bool
+WoodcockApplier::has_material(WoodcockRegion const& region,
+                              MaterialId mat_id) const
+{
+    for (MaterialId m : params.materials[region.materials])
+    {
+        if (m == mat_id)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the total cross section in a material.
+ *
+ * If a step view is given, the per-process cross sections are saved for
+ * selecting the discrete interaction.
+ */
+CELER_FUNCTION real_type
+WoodcockApplier::calc_total_xs(PhysicsTrackView const& phys,
+                               MaterialView const& mat,
+                               Energy energy,
+                               PhysicsStepView* step)
+{
+    real_type result{0};
+    for (auto ppid : range(ParticleProcessId{phys.num_particle_processes()}))
+    {
+        real_type process_xs = phys.calc_xs(ppid, mat, energy);
+        if (step)
+        {
+            step->per_process_xs(ppid) = process_xs;
+        }
+        result += process_xs;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
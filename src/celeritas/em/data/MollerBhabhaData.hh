@@ -9,6 +9,8 @@
 
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/grid/TwodGridData.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/Types.hh"
 
@@ -30,10 +32,61 @@ struct MollerBhabhaIds
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Optional sampling tables for the Moller and Bhabha energy fractions.
+ *
+ * Each 2D grid is:
+ * - x: logarithm of the energy [MeV] of the incident electron or positron
+ * - y: inverse \f$ 1/\epsilon \f$ of the energy fraction transferred to the
+ *   secondary electron
+ * - value: CDF in \f$ 1/\epsilon \f$, normalized to unity at the end of the
+ *   grid
+ *
+ * The CDFs do not depend on the production cut, which only truncates the
+ * upper end of the \f$ 1/\epsilon \f$ range.
+ */
+template<Ownership W, MemSpace M>
+struct MollerBhabhaTableData
+{
+    //// TYPES ////
+
+    template<class T>
+    using Items = Collection<T, W, M>;
+
+    //// MEMBER DATA ////
+
+    TwodGridData moller;
+    TwodGridData bhabha;
+
+    // Backend data
+    Items<real_type> reals;
+
+    //// MEMBER FUNCTIONS ////
+
+    //! Whether the data is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return moller && bhabha && !reals.empty();
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    MollerBhabhaTableData&
+    operator=(MollerBhabhaTableData<W2, M2> const& other)
+    {
+        reals = other.reals;
+        moller = other.moller;
+        bhabha = other.bhabha;
+        return *this;
+    }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Device data for creating an interactor.
  */
+template<Ownership W, MemSpace M>
 struct MollerBhabhaData
 {
     //! Model and particle IDs
@@ -42,6 +95,9 @@ struct MollerBhabhaData
     //! Electron mass * c^2 [MeV]
     units::MevMass electron_mass;
 
+    //! Optional tables for sampling the energy fraction
+    MollerBhabhaTableData<W, M> table;
+
     //! Model's maximum energy limit [MeV]
     static CELER_CONSTEXPR_FUNCTION units::MevEnergy max_valid_energy()
     {
@@ -53,10 +109,18 @@ struct MollerBhabhaData
     {
         return ids && electron_mass > zero_quantity();
     }
-};
 
-using MollerBhabhaHostRef = MollerBhabhaData;
-using MollerBhabhaDeviceRef = MollerBhabhaData;
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    MollerBhabhaData& operator=(MollerBhabhaData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        ids = other.ids;
+        electron_mass = other.electron_mass;
+        table = other.table;
+        return *this;
+    }
+};
 
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
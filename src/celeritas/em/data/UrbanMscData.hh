@@ -150,7 +150,7 @@ struct UrbanMscData
     Items<XsGridData> xs;  //!< [mat][particle]
 
     // Backend storage
-    Items<real_type> reals;
+    Items<table_real_type> reals;
 
     //// METHODS ////
 
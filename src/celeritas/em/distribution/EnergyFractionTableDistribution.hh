@@ -0,0 +1,150 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/distribution/EnergyFractionTableDistribution.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/grid/NonuniformGrid.hh"
+#include "corecel/grid/TwodGridCalculator.hh"
+#include "corecel/grid/TwodGridData.hh"
+#include "corecel/grid/TwodSubgridCalculator.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/grid/InverseCdfFinder.hh"
+#include "celeritas/random/distribution/GenerateCanonical.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a secondary energy fraction from a tabulated CDF in its inverse.
+ *
+ * The Moller and Bhabha energy fractions \f$ \epsilon \f$ are sampled by
+ * rejection (see \c MollerEnergyDistribution and \c BhabhaEnergyDistribution
+ * ) from a proposal distribution that is uniform in \f$ t = 1/\epsilon \f$.
+ * This instead uses inverse transform sampling on a CDF in \f$ t \f$
+ * tabulated as a function of the log of the incident energy, so that each
+ * sample uses a single random number.
+ *
+ * The lower bound of \f$ t \f$ is the first grid point, and the upper bound
+ * \f$ E / E_\text{min} \f$ is applied by scaling the sampled CDF value by the
+ * CDF at that point.
+ */
+class EnergyFractionTableDistribution
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Energy = units::MevEnergy;
+    using Values
+        = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+    //!@}
+
+  public:
+    // Whether the table covers the incident and minimum secondary energies
+    static inline CELER_FUNCTION bool in_range(TwodGridData const& grid,
+                                               Values const& reals,
+                                               Energy min_valid_energy,
+                                               Energy inc_energy);
+
+    // Construct from the table and incident data
+    inline CELER_FUNCTION
+    EnergyFractionTableDistribution(TwodGridData const& grid,
+                                    Values const& reals,
+                                    Energy min_valid_energy,
+                                    Energy inc_energy);
+
+    // Sample the exiting energy fraction
+    template<class Engine>
+    inline CELER_FUNCTION real_type operator()(Engine& rng) const;
+
+  private:
+    //// DATA ////
+
+    // CDF grid and values
+    TwodGridData const& grid_;
+    Values const& reals_;
+    // CDF interpolated at the incident energy
+    TwodSubgridCalculator calc_cdf_;
+    // CDF at the maximum inverse energy fraction
+    real_type max_cdf_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Whether the table covers the incident and minimum secondary energies.
+ */
+CELER_FUNCTION bool
+EnergyFractionTableDistribution::in_range(TwodGridData const& grid,
+                                          Values const& reals,
+                                          Energy min_valid_energy,
+                                          Energy inc_energy)
+{
+    CELER_EXPECT(grid);
+    CELER_EXPECT(min_valid_energy > zero_quantity());
+
+    NonuniformGrid<real_type> const x_grid{grid.x, reals};
+    NonuniformGrid<real_type> const y_grid{grid.y, reals};
+    real_type log_energy = std::log(value_as<Energy>(inc_energy));
+    return log_energy >= x_grid.front() && log_energy < x_grid.back()
+           && value_as<Energy>(inc_energy) / value_as<Energy>(min_valid_energy)
+                  < y_grid.back();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from the table and incident data.
+ *
+ * The incident energy and the ratio of the incident to minimum secondary
+ * energy *must* be within the bounds of the table.
+ */
+CELER_FUNCTION
+EnergyFractionTableDistribution::EnergyFractionTableDistribution(
+    TwodGridData const& grid,
+    Values const& reals,
+    Energy min_valid_energy,
+    Energy inc_energy)
+    : grid_(grid)
+    , reals_(reals)
+    , calc_cdf_(TwodGridCalculator(grid_, reals_)(
+          std::log(value_as<Energy>(inc_energy))))
+{
+    CELER_EXPECT(in_range(grid, reals, min_valid_energy, inc_energy));
+
+    real_type max_inv_fraction = value_as<Energy>(inc_energy)
+                                 / value_as<Energy>(min_valid_energy);
+    CELER_ASSERT(max_inv_fraction > NonuniformGrid<real_type>(grid_.y, reals_)
+                                        .front());
+    max_cdf_ = calc_cdf_(max_inv_fraction);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the exiting energy fraction.
+ */
+template<class Engine>
+CELER_FUNCTION real_type
+EnergyFractionTableDistribution::operator()(Engine& rng) const
+{
+    // Sample the CDF below the maximum inverse fraction
+    real_type cdf = generate_canonical(rng) * max_cdf_;
+
+    // Find the inverse energy fraction corresponding to the CDF value
+    real_type inv_fraction = InverseCdfFinder(
+        NonuniformGrid<real_type>(grid_.y, reals_),
+        TwodSubgridCalculator{calc_cdf_})(cdf);
+    return 1 / inv_fraction;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
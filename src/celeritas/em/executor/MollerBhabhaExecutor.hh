@@ -22,7 +22,7 @@ struct MollerBhabhaExecutor
     inline CELER_FUNCTION Interaction
     operator()(celeritas::CoreTrackView const& track);
 
-    MollerBhabhaData params;
+    NativeCRef<MollerBhabhaData> params;
 };
 
 //---------------------------------------------------------------------------//
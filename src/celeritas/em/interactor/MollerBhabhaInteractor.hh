@@ -18,6 +18,7 @@
 #include "celeritas/Quantities.hh"
 #include "celeritas/em/data/MollerBhabhaData.hh"
 #include "celeritas/em/distribution/BhabhaEnergyDistribution.hh"
+#include "celeritas/em/distribution/EnergyFractionTableDistribution.hh"
 #include "celeritas/em/distribution/MollerEnergyDistribution.hh"
 #include "celeritas/phys/CutoffView.hh"
 #include "celeritas/phys/Interaction.hh"
@@ -38,6 +39,10 @@ namespace celeritas
  * \note This performs the same sampling routine as in Geant4's
  * G4MollerBhabhaModel class, as documented in section 10.1.4 of the Geant4
  * Physics Reference (release 10.6).
+ *
+ * If the model has sampling tables that cover the incident energy and
+ * production cut, the secondary energy fraction is instead sampled from the
+ * tabulated CDF with \c EnergyFractionTableDistribution .
  */
 class MollerBhabhaInteractor
 {
@@ -52,7 +57,7 @@ class MollerBhabhaInteractor
   public:
     //! Construct with shared and state data
     inline CELER_FUNCTION
-    MollerBhabhaInteractor(MollerBhabhaData const& shared,
+    MollerBhabhaInteractor(NativeCRef<MollerBhabhaData> const& shared,
                            ParticleTrackView const& particle,
                            CutoffView const& cutoffs,
                            Real3 const& inc_direction,
@@ -64,7 +69,7 @@ class MollerBhabhaInteractor
 
   private:
     // Shared constant physics properties
-    MollerBhabhaData const& shared_;
+    NativeCRef<MollerBhabhaData> const& shared_;
     // Incident energy [MeV]
     Energy inc_energy_;
     // Incident momentum [MeV]
@@ -89,7 +94,7 @@ class MollerBhabhaInteractor
  * must be handled in code *before* the interactor is constructed.
  */
 CELER_FUNCTION MollerBhabhaInteractor::MollerBhabhaInteractor(
-    MollerBhabhaData const& shared,
+    NativeCRef<MollerBhabhaData> const& shared,
     ParticleTrackView const& particle,
     CutoffView const& cutoffs,
     Real3 const& inc_direction,
@@ -129,6 +134,19 @@ CELER_FUNCTION Interaction MollerBhabhaInteractor::operator()(Engine& rng)
 
     // Sample secondary electron energy
     Energy secondary_energy = inc_energy_ * [this, &rng] {
+        if (shared_.table)
+        {
+            TwodGridData const& grid = inc_particle_is_electron_
+                                           ? shared_.table.moller
+                                           : shared_.table.bhabha;
+            if (EnergyFractionTableDistribution::in_range(
+                    grid, shared_.table.reals, electron_cutoff_, inc_energy_))
+            {
+                return EnergyFractionTableDistribution(
+                    grid, shared_.table.reals, electron_cutoff_, inc_energy_)(
+                    rng);
+            }
+        }
         if (inc_particle_is_electron_)
         {
             return MollerEnergyDistribution(
@@ -7,6 +7,14 @@
 //---------------------------------------------------------------------------//
 #include "MollerBhabhaModel.hh"
 
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/grid/VectorUtils.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/sys/ScopedMem.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/em/data/MollerBhabhaData.hh"
 #include "celeritas/em/executor/MollerBhabhaExecutor.hh"
@@ -14,6 +22,7 @@
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/global/CoreState.hh"
 #include "celeritas/global/TrackExecutor.hh"
+#include "celeritas/grid/TwodGridBuilder.hh"
 #include "celeritas/phys/InteractionApplier.hh"
 #include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"
@@ -21,25 +30,109 @@
 
 namespace celeritas
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+// Number of table points per decade in the incident energy
+constexpr size_type num_energy_per_decade = 8;
+// Number of table points per decade in the inverse energy fraction
+constexpr size_type num_fraction_per_decade = 16;
+// Lowest tabulated incident energy [MeV]
+constexpr double min_table_energy = 1e-3;
+// Largest tabulated ratio of incident energy to production cut
+constexpr double max_inv_fraction = 1e11;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Integral of the Moller rejection function in the inverse energy fraction.
+ *
+ * With \f$ t = 1/\epsilon \f$ and \f$ c = (2\gamma - 1)/\gamma^2 \f$, the
+ * rejection function in \c MollerEnergyDistribution integrates to
+ * \f[
+ *   G(t) = t - \frac{1 - c}{t} - \frac{1}{t - 1} - c \ln(t - 1) \,.
+ * \f]
+ */
+double integrate_moller(double gamma, double t)
+{
+    double c = (2 * gamma - 1) / ipow<2>(gamma);
+    return t - (1 - c) / t - 1 / (t - 1) - c * std::log(t - 1);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Integral of the Bhabha rejection function in the inverse energy fraction.
+ *
+ * With \f$ t = 1/\epsilon \f$ and the coefficients \f$ b_i \f$ of
+ * \c BhabhaEnergyDistribution, the rejection function integrates to
+ * \f[
+ *   G(t) = t + \beta^2 \left( -\frac{b_4}{3 t^3} + \frac{b_3}{2 t^2}
+ *          - \frac{b_2}{t} - b_1 \ln t \right) \,.
+ * \f]
+ */
+double integrate_bhabha(double gamma, double t)
+{
+    double y = 1 / (1 + gamma);
+    double y_sq = ipow<2>(y);
+    double one_minus_2y = 1 - 2 * y;
+
+    double b1 = 2 - y_sq;
+    double b2 = one_minus_2y * (3 + y_sq);
+    double b4 = ipow<3>(one_minus_2y);
+    double b3 = ipow<2>(one_minus_2y) + b4;
+    double beta_sq = 1 - 1 / ipow<2>(gamma);
+
+    return t
+           + beta_sq
+                 * (-b4 / (3 * ipow<3>(t)) + b3 / (2 * ipow<2>(t)) - b2 / t
+                    - b1 * std::log(t));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct from model ID and other necessary data.
  */
 MollerBhabhaModel::MollerBhabhaModel(ActionId id,
                                      ParticleParams const& particles)
+    : MollerBhabhaModel(id, particles, Options{})
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with options.
+ */
+MollerBhabhaModel::MollerBhabhaModel(ActionId id,
+                                     ParticleParams const& particles,
+                                     Options const& options)
     : StaticConcreteAction(
           id, "ioni-moller-bhabha", "interact by Moller+Bhabha ionization")
 {
     CELER_EXPECT(id);
-    data_.ids.electron = particles.find(pdg::electron());
-    data_.ids.positron = particles.find(pdg::positron());
+
+    ScopedMem record_mem("MollerBhabhaModel.construct");
+
+    HostVal<MollerBhabhaData> host_data;
+    host_data.ids.electron = particles.find(pdg::electron());
+    host_data.ids.positron = particles.find(pdg::positron());
 
     CELER_VALIDATE(
-        data_.ids.electron && data_.ids.positron,
+        host_data.ids.electron && host_data.ids.positron,
         << R"(missing electron and/or positron particles (required for )"
         << this->description() << ")");
 
-    data_.electron_mass = particles.get(data_.ids.electron).mass();
+    host_data.electron_mass = particles.get(host_data.ids.electron).mass();
+
+    if (options.tabulated)
+    {
+        MollerBhabhaModel::build_table(host_data.electron_mass,
+                                       &host_data.table);
+    }
+
+    // Move to mirrored data, copying to device
+    data_ = CollectionMirror<MollerBhabhaData>{std::move(host_data)};
 
     CELER_ENSURE(data_);
 }
@@ -58,11 +151,13 @@ auto MollerBhabhaModel::applicability() const -> SetApplicability
 
     Applicability electron_applic, positron_applic;
 
-    electron_applic.particle = data_.ids.electron;
+    auto const& data = this->host_ref();
+
+    electron_applic.particle = data.ids.electron;
     electron_applic.lower = zero_quantity();
-    electron_applic.upper = units::MevEnergy{data_.max_valid_energy()};
+    electron_applic.upper = units::MevEnergy{data.max_valid_energy()};
 
-    positron_applic.particle = data_.ids.positron;
+    positron_applic.particle = data.ids.positron;
     positron_applic.lower = zero_quantity();
     positron_applic.upper = electron_applic.upper;
 
@@ -103,5 +198,71 @@ void MollerBhabhaModel::step(CoreParams const&, CoreStateDevice&) const
 }
 #endif
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the energy fraction sampling tables.
+ *
+ * The CDFs in the inverse energy fraction are integrated analytically, so the
+ * only approximation is the bilinear interpolation between grid points. The
+ * inverse fraction grid is logarithmic since the Moller and Bhabha densities
+ * become uniform in \f$ 1/\epsilon \f$ as the energy fraction decreases.
+ */
+void MollerBhabhaModel::build_table(units::MevMass electron_mass,
+                                    HostTable* table)
+{
+    CELER_EXPECT(electron_mass > zero_quantity());
+    CELER_EXPECT(table);
+
+    auto num_points = [](double lower, double upper, size_type per_decade) {
+        return static_cast<size_type>(
+                   std::ceil(per_decade * std::log10(upper / lower)))
+               + 1;
+    };
+
+    // Incident energy grid
+    double const max_energy = value_as<units::MevEnergy>(
+        HostVal<MollerBhabhaData>::max_valid_energy());
+    std::vector<double> const log_energy = linspace(
+        std::log(min_table_energy),
+        std::log(max_energy),
+        num_points(min_table_energy, max_energy, num_energy_per_decade));
+
+    TwodGridBuilder build_grid{&table->reals};
+    auto build = [&](double min_inv_fraction, auto&& integrate) {
+        std::vector<double> const inv_fraction = logspace(
+            min_inv_fraction,
+            max_inv_fraction,
+            num_points(
+                min_inv_fraction, max_inv_fraction, num_fraction_per_decade));
+
+        std::vector<double> cdf;
+        cdf.reserve(log_energy.size() * inv_fraction.size());
+        for (double x : log_energy)
+        {
+            double gamma = 1
+                           + std::exp(x)
+                                 / value_as<units::MevMass>(electron_mass);
+            double lower = integrate(gamma, inv_fraction.front());
+            double norm = 1 / (integrate(gamma, inv_fraction.back()) - lower);
+            cdf.push_back(0);
+            for (auto j : range(std::size_t{1}, inv_fraction.size() - 1))
+            {
+                cdf.push_back((integrate(gamma, inv_fraction[j]) - lower)
+                              * norm);
+            }
+            cdf.push_back(1);
+        }
+        return build_grid(make_span(log_energy),
+                          make_span(inv_fraction),
+                          make_span(std::as_const(cdf)));
+    };
+
+    // Moller energy fraction is at most 1/2, Bhabha at most 1
+    table->moller = build(2, integrate_moller);
+    table->bhabha = build(1, integrate_bhabha);
+
+    CELER_ENSURE(*table);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "corecel/data/CollectionMirror.hh"
 #include "celeritas/em/data/MollerBhabhaData.hh"
 #include "celeritas/phys/Model.hh"
 
@@ -17,13 +18,38 @@ class ParticleParams;
 //---------------------------------------------------------------------------//
 /*!
  * Set up and launch the Moller-Bhabha model interaction.
+ *
+ * If \c Options::tabulated is set, the CDFs of the inverse secondary energy
+ * fraction are calculated analytically and tabulated at construction, and the
+ * interactor samples from them with a single random number rather than by
+ * rejection. Incident energies or production cuts outside the tables fall back
+ * to rejection sampling.
  */
 class MollerBhabhaModel final : public Model, public StaticConcreteAction
 {
+  public:
+    //!@{
+    //! \name Type aliases
+    using HostRef = HostCRef<MollerBhabhaData>;
+    using DeviceRef = DeviceCRef<MollerBhabhaData>;
+    //!@}
+
+    //! Optional model configuration
+    struct Options
+    {
+        //! Sample the energy fraction from tabulated CDFs
+        bool tabulated{false};
+    };
+
   public:
     // Construct from model ID and other necessary data
     MollerBhabhaModel(ActionId id, ParticleParams const& particles);
 
+    // Construct with options
+    MollerBhabhaModel(ActionId id,
+                      ParticleParams const& particles,
+                      Options const& options);
+
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
 
@@ -38,12 +64,15 @@ class MollerBhabhaModel final : public Model, public StaticConcreteAction
 
     //!@{
     //! Access model data
-    MollerBhabhaData const& host_ref() const { return data_; }
-    MollerBhabhaData const& device_ref() const { return data_; }
+    HostRef const& host_ref() const { return data_.host_ref(); }
+    DeviceRef const& device_ref() const { return data_.device_ref(); }
     //!@}
 
   private:
-    MollerBhabhaData data_;
+    CollectionMirror<MollerBhabhaData> data_;
+
+    using HostTable = HostVal<MollerBhabhaTableData>;
+    static void build_table(units::MevMass electron_mass, HostTable* table);
 };
 
 //---------------------------------------------------------------------------//
@@ -36,7 +36,8 @@ class MscParamsHelper
     using EnergyBounds = Array<Energy, 2>;
     using VecImportMscModel = std::vector<ImportMscModel>;
     using XsValues = Collection<XsGridData, Ownership::value, MemSpace::host>;
-    using Values = Collection<real_type, Ownership::value, MemSpace::host>;
+    using Values
+        = Collection<table_real_type, Ownership::value, MemSpace::host>;
     //!@}
 
     MscParamsHelper(ParticleParams const&,
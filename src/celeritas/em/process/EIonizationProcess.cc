@@ -40,7 +40,10 @@ EIonizationProcess::EIonizationProcess(SPConstParticles particles,
  */
 auto EIonizationProcess::build_models(ActionIdIter start_id) const -> VecModel
 {
-    return {std::make_shared<MollerBhabhaModel>(*start_id++, *particles_)};
+    MollerBhabhaModel::Options model_options;
+    model_options.tabulated = options_.tabulated_sampling;
+    return {std::make_shared<MollerBhabhaModel>(
+        *start_id++, *particles_, model_options)};
 }
 
 //---------------------------------------------------------------------------//
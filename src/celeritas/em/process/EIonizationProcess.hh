@@ -34,6 +34,8 @@ class EIonizationProcess : public Process
     {
         bool use_integral_xs{true};  //!> Use integral method for sampling
                                      //! discrete interaction length
+        bool tabulated_sampling{false};  //!> Sample secondary energies from
+                                         //! tabulated CDFs
     };
 
   public:
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
@@ -50,9 +51,11 @@
 #include <G4Region.hh>
 #include <G4RegionStore.hh>
 #include <G4String.hh>
+#include <G4Track.hh>
 #include <G4Transportation.hh>
 #include <G4TransportationManager.hh>
 #include <G4Types.hh>
+#include <G4UserLimits.hh>
 #include <G4VEnergyLossProcess.hh>
 #include <G4VMultipleScattering.hh>
 #include <G4VPhysicalVolume.hh>
@@ -317,6 +320,30 @@ to_form_factor_type(G4NuclearFormfactorType const& form_factor_type)
     CELER_ASSERT_UNREACHABLE();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Convert step limits and tracking cuts of a logical volume.
+ *
+ * The limits are evaluated for a default track, so user limits that depend on
+ * the particle type or state are not supported. Geant4 uses the largest
+ * representable value for an unset maximum.
+ */
+ImportUserLimits import_user_limits(G4UserLimits& g4limits)
+{
+    double const len_scale = native_value_from_clhep(ImportUnits::len);
+    double const time_scale = native_value_from_clhep(ImportUnits::time);
+    auto from_max = [](double value, double scale) {
+        return value < std::numeric_limits<double>::max() ? value * scale : 0;
+    };
+
+    G4Track const track;
+    ImportUserLimits result;
+    result.max_step = from_max(g4limits.GetMaxAllowedStep(track), len_scale);
+    result.max_time = from_max(g4limits.GetUserMaxTime(track), time_scale);
+    result.min_energy = g4limits.GetUserMinEkine(track) * mev_scale;
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Return a populated \c ImportParticle vector.
@@ -1287,6 +1314,10 @@ GeantImporter::import_volumes(bool unique_volumes) const
             }
             volume.name = lv.GetName();
             volume.solid_name = lv.GetSolid()->GetName();
+            if (auto* limits = lv.GetUserLimits())
+            {
+                volume.user_limits = import_user_limits(*limits);
+            }
 
             if (volume.name.empty())
             {
@@ -47,6 +47,7 @@
 #pragma link C++ class celeritas::ImportScintComponent+;
 #pragma link C++ class celeritas::ImportScintData+;
 #pragma link C++ class celeritas::ImportTransParameters+;
+#pragma link C++ class celeritas::ImportUserLimits+;
 #pragma link C++ class celeritas::ImportVolume+;
 #pragma link C++ class celeritas::ImportWavelengthShift+;
 
@@ -24,11 +24,13 @@ struct GeoMaterialParamsData
     using VolumeItems = celeritas::Collection<T, W, M, VolumeId>;
 
     VolumeItems<MaterialId> materials;
+    VolumeItems<RegionId> regions;  //!< Optional
 
     //! True if assigned
     explicit CELER_FUNCTION operator bool() const
     {
-        return !materials.empty();
+        return !materials.empty()
+               && (regions.empty() || regions.size() == materials.size());
     }
 
     //! Assign from another set of data
@@ -37,6 +39,7 @@ struct GeoMaterialParamsData
     {
         CELER_EXPECT(other);
         materials = other.materials;
+        regions = other.regions;
         return *this;
     }
 };
@@ -31,26 +31,24 @@ namespace celeritas
 namespace
 {
 //---------------------------------------------------------------------------//
-using MapLabelMatId = std::unordered_map<Label, MaterialId>;
+template<class IdT>
+using MapLabelId = std::unordered_map<Label, IdT>;
+using MapLabelMatId = MapLabelId<MaterialId>;
 
 //---------------------------------------------------------------------------//
 /*!
- * Construct a label -> material map from the input.
+ * Construct a label -> material (or region) map from the input.
  *
  * The input is effectively an "unzipped" unordered list of (volume label,
  * material id) pairs.
  */
-MapLabelMatId build_label_map(MaterialParams const& mat_params,
-                              std::vector<Label>&& labels,
-                              std::vector<MaterialId> const& materials)
+template<class IdT>
+MapLabelId<IdT>
+build_label_map(std::vector<Label>&& labels, std::vector<IdT> const& materials)
 {
     CELER_EXPECT(materials.size() == labels.size());
-    CELER_EXPECT(std::all_of(
-        materials.begin(), materials.end(), [&mat_params](MaterialId m) {
-            return !m || m < mat_params.num_materials();
-        }));
 
-    std::unordered_map<Label, MaterialId> lab_to_id;
+    MapLabelId<IdT> lab_to_id;
     std::set<Label> duplicates;
 
     // Remap materials to volume IDs using given volume names:
@@ -80,17 +78,20 @@ MapLabelMatId build_label_map(MaterialParams const& mat_params,
 
 //---------------------------------------------------------------------------//
 /*!
- * Find a material ID from a volume ID.
+ * Find a material (or region) ID from a volume ID.
  */
-class MaterialFinder
+template<class IdT>
+class VolumeIdFinder
 {
   public:
-    MaterialFinder(GeoParams const& geo, MapLabelMatId const& materials)
-        : geo_{geo}, materials_{materials}
+    VolumeIdFinder(GeoParams const& geo,
+                   MapLabelId<IdT> const& materials,
+                   char const* what)
+        : geo_{geo}, materials_{materials}, what_{what}
     {
     }
 
-    MaterialId operator()(VolumeId const& volume_id)
+    IdT operator()(VolumeId const& volume_id)
     {
         Label const& vol_label = geo_.volumes().at(volume_id);
 
@@ -117,7 +118,7 @@ class MaterialFinder
             return {};
         }
 
-        std::set<MaterialId> found_mat;
+        std::set<IdT> found_mat;
         for (auto iter = start; iter != stop; ++iter)
         {
             found_mat.insert(iter->second.second);
@@ -127,7 +128,7 @@ class MaterialFinder
         if (found_mat.size() > 1)
         {
             CELER_LOG(warning)
-                << "Multiple materials match the volume '" << vol_label
+                << "Multiple " << what_ << " match the volume '" << vol_label
                 << "': "
                 << join_stream(
                        start, stop, ", ", [](std::ostream& os, auto&& mliter) {
@@ -140,9 +141,10 @@ class MaterialFinder
 
   private:
     GeoParams const& geo_;
-    MapLabelMatId const& materials_;
+    MapLabelId<IdT> const& materials_;
+    char const* what_;
 
-    using PairExtMatid = std::pair<std::string, MaterialId>;
+    using PairExtMatid = std::pair<std::string, IdT>;
     std::multimap<std::string, PairExtMatid> mat_labels_;
 
     void build_mat_labels()
@@ -182,7 +184,7 @@ build_vol_to_mat(GeoParams const& geo, MapLabelMatId const& materials)
     VolumeId::size_type num_missing{0};
 
     // Map volume names to material names
-    MaterialFinder find_matid{geo, materials};
+    VolumeIdFinder<MaterialId> find_matid{geo, materials, "materials"};
     for (auto volume_id : range(VolumeId{vols.size()}))
     {
         if (auto matid = find_matid(volume_id))
@@ -238,6 +240,24 @@ build_vol_to_mat(GeoParams const& geo, MapLabelMatId const& materials)
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a volume -> region map from the label map.
+ */
+std::vector<RegionId>
+build_vol_to_region(GeoParams const& geo, MapLabelId<RegionId> const& regions)
+{
+    auto const& vols = geo.volumes();
+    std::vector<RegionId> result(vols.size(), RegionId{});
+
+    VolumeIdFinder<RegionId> find_region{geo, regions, "regions"};
+    for (auto volume_id : range(VolumeId{vols.size()}))
+    {
+        result[volume_id.unchecked_get()] = find_region(volume_id);
+    }
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace
 
@@ -255,6 +275,7 @@ GeoMaterialParams::from_import(ImportData const& data,
     input.materials = std::move(material_params);
 
     input.volume_to_mat.resize(data.volumes.size());
+    input.volume_to_region.resize(data.volumes.size());
     for (auto volume_idx :
          range<VolumeId::size_type>(input.volume_to_mat.size()))
     {
@@ -263,6 +284,22 @@ GeoMaterialParams::from_import(ImportData const& data,
 
         input.volume_to_mat[volume_idx]
             = MaterialId(data.volumes[volume_idx].phys_material_id);
+        if (auto region_idx = data.volumes[volume_idx].region_id;
+            region_idx != ImportVolume::unspecified)
+        {
+            input.volume_to_region[volume_idx] = RegionId(region_idx);
+        }
+    }
+
+    // Save region names
+    input.region_labels.reserve(data.regions.size());
+    for (auto const& region : data.regions)
+    {
+        input.region_labels.push_back(Label::from_geant(region.name));
+    }
+    if (input.region_labels.empty())
+    {
+        input.volume_to_region.clear();
     }
 
     // Assume that since Geant4 is using internal geometry and
@@ -298,15 +335,45 @@ GeoMaterialParams::GeoMaterialParams(Input input)
         (input.volume_labels.empty()
          && input.volume_to_mat.size() == input.geometry->volumes().size())
         || input.volume_to_mat.size() == input.volume_labels.size());
+    CELER_EXPECT(std::all_of(
+        input.volume_to_mat.begin(),
+        input.volume_to_mat.end(),
+        [num_mats = input.materials->num_materials()](MaterialId m) {
+            return !m || m < num_mats;
+        }));
+    CELER_EXPECT(input.volume_to_region.empty()
+                 || input.volume_to_region.size()
+                        == input.volume_to_mat.size());
 
     ScopedMem record_mem("GeoMaterialParams.construct");
 
+    if (!input.volume_to_region.empty())
+    {
+        auto num_regions = input.region_labels.size();
+        for (RegionId r : input.volume_to_region)
+        {
+            CELER_VALIDATE(!r || r < num_regions,
+                           << "region ID " << r.unchecked_get()
+                           << " is out of range: " << num_regions
+                           << " regions are defined");
+        }
+        regions_ = RegionMap{"region", std::move(input.region_labels)};
+    }
+
     if (!input.volume_labels.empty())
     {
         // User didn't provide an exact map of volume -> matid (typical case?)
         // Remap based on labels
-        auto lab_to_id = build_label_map(*input.materials,
-                                         std::move(input.volume_labels),
+        if (!input.volume_to_region.empty())
+        {
+            auto lab_to_region
+                = build_label_map(std::vector<Label>(input.volume_labels),
+                                  input.volume_to_region);
+            input.volume_to_region
+                = build_vol_to_region(*input.geometry, lab_to_region);
+        }
+
+        auto lab_to_id = build_label_map(std::move(input.volume_labels),
                                          input.volume_to_mat);
 
         // Reconstruct volume-to-material mapping from label map and geometry
@@ -320,6 +387,9 @@ GeoMaterialParams::GeoMaterialParams(Input input)
     auto materials = make_builder(&host_data.materials);
     materials.insert_back(input.volume_to_mat.begin(),
                           input.volume_to_mat.end());
+    make_builder(&host_data.regions)
+        .insert_back(input.volume_to_region.begin(),
+                     input.volume_to_region.end());
 
     // Move to mirrored data, copying to device
     data_ = CollectionMirror<GeoMaterialParamsData>{std::move(host_data)};
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "corecel/Types.hh"
+#include "corecel/cont/LabelIdMultiMap.hh"
 #include "corecel/data/CollectionMirror.hh"
 #include "corecel/data/ParamsDataInterface.hh"
 #include "corecel/io/Label.hh"
@@ -41,6 +42,13 @@ struct ImportData;
  * the corresponding volume name is empty (corresponding perhaps to a "parallel
  * world" or otherwise unused volume) or is enclosed with braces (used for
  * virtual volumes such as `[EXTERIOR]` or temporary boolean/reflected volumes.
+ *
+ * Volumes can optionally be assigned to named regions (the Geant4 \c G4Region
+ * concept) which are used for region-dependent cuts. Production cuts are
+ * already region-dependent through the material ID (a "material cuts
+ * couple"), but regions that share the default production cuts may still need
+ * different tracking cuts. The region mapping uses the same volume labels as
+ * the material mapping.
  */
 class GeoMaterialParams final
     : public ParamsDataInterface<GeoMaterialParamsData>
@@ -50,6 +58,7 @@ class GeoMaterialParams final
     //! \name Type aliases
     using SPConstGeo = std::shared_ptr<GeoParams const>;
     using SPConstMaterial = std::shared_ptr<MaterialParams const>;
+    using RegionMap = LabelIdMultiMap<RegionId>;
     //!@}
 
     //! Input parameters
@@ -59,6 +68,8 @@ class GeoMaterialParams final
         SPConstMaterial materials;
         std::vector<MaterialId> volume_to_mat;
         std::vector<Label> volume_labels;  // Optional
+        std::vector<RegionId> volume_to_region;  // Optional
+        std::vector<Label> region_labels;  // Required if regions are used
     };
 
   public:
@@ -83,8 +94,15 @@ class GeoMaterialParams final
     // Get the material ID corresponding to a volume ID
     inline MaterialId material_id(VolumeId v) const;
 
+    //! Region names (empty if regions are not used)
+    RegionMap const& regions() const { return regions_; }
+
+    // Get the region ID corresponding to a volume ID
+    inline RegionId region_id(VolumeId v) const;
+
   private:
     CollectionMirror<GeoMaterialParamsData> data_;
+    RegionMap regions_;
 
     using HostValue = HostVal<GeoMaterialParamsData>;
 };
@@ -113,5 +131,19 @@ MaterialId GeoMaterialParams::material_id(VolumeId v) const
     return this->host_ref().materials[v];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the region ID corresponding to a volume ID.
+ *
+ * The result is null if regions are not used or the volume has no region.
+ */
+RegionId GeoMaterialParams::region_id(VolumeId v) const
+{
+    CELER_EXPECT(v < this->num_volumes());
+
+    auto const& regions = this->host_ref().regions;
+    return regions.empty() ? RegionId{} : regions[v];
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
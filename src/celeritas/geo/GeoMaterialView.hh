@@ -30,6 +30,9 @@ class GeoMaterialView
     // Return material for the given volume
     inline CELER_FUNCTION MaterialId material_id(VolumeId volume) const;
 
+    // Return the region for the given volume, if regions are defined
+    inline CELER_FUNCTION RegionId region_id(VolumeId volume) const;
+
   private:
     GeoMaterialData const& params_;
 };
@@ -59,5 +62,22 @@ CELER_FUNCTION MaterialId GeoMaterialView::material_id(VolumeId volume) const
     return params_.materials[volume];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Return the region for the given volume, if regions are defined.
+ *
+ * The result is null if no regions were specified or the volume is not
+ * assigned to a region.
+ */
+CELER_FUNCTION RegionId GeoMaterialView::region_id(VolumeId volume) const
+{
+    if (params_.regions.empty())
+    {
+        return {};
+    }
+    CELER_EXPECT(volume < params_.regions.size());
+    return params_.regions[volume];
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -66,7 +66,8 @@ is_action_sorted(StepActionOrder aorder, TrackOrder torder)
     return (aorder == StepActionOrder::post
             && torder == TrackOrder::reindex_step_limit_action)
            || (aorder == StepActionOrder::along
-               && torder == TrackOrder::reindex_along_step_action)
+               && (torder == TrackOrder::reindex_along_step_action
+                   || torder == TrackOrder::reindex_particle_type))
            || (torder == TrackOrder::reindex_both_action
                && (aorder == StepActionOrder::post
                    || aorder == StepActionOrder::along));
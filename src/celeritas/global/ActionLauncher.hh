@@ -13,8 +13,10 @@
 
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
+#include "celeritas/track/TrackInitParams.hh"
 
 #include "ActionInterface.hh"
 #include "CoreParams.hh"
@@ -25,42 +27,66 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Helper function to run an executor in parallel on CPU.
- *
- * Example:
- * \code
- void FooHelper::step(CoreParams const& params,
-                         CoreStateHost& state) const
- {
-    launch_core(params, state, "foo-helper", make_blah_executor(blah));
- }
- * \endcode
+ * Helper function to run an executor in parallel on CPU over some threads.
  */
 template<class F>
 void launch_core(std::string_view label,
                  celeritas::CoreParams const& params,
                  celeritas::CoreState<MemSpace::host>& state,
+                 Range<ThreadId> threads,
                  F&& execute_thread)
 {
     MultiExceptionHandler capture_exception;
-    size_type const size = state.size();
+    size_type const offset = threads.begin()->unchecked_get();
+    size_type const size = threads.size();
 #if defined(_OPENMP) && CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
 #    pragma omp parallel for
 #endif
     for (size_type i = 0; i < size; ++i)
     {
+        ThreadId const tid{offset + i};
         CELER_TRY_HANDLE_CONTEXT(
-            execute_thread(ThreadId{i}),
+            execute_thread(tid),
             capture_exception,
             KernelContextException(
-                params.ref<MemSpace::host>(), state.ref(), ThreadId{i}, label));
+                params.ref<MemSpace::host>(), state.ref(), tid, label));
     }
     log_and_rethrow(std::move(capture_exception));
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Helper function to run an action in parallel on CPU over all states.
+ * Helper function to run an executor in parallel on CPU over all states.
+ *
+ * Example:
+ * \code
+ void FooHelper::step(CoreParams const& params,
+                         CoreStateHost& state) const
+ {
+    launch_core(params, state, "foo-helper", make_blah_executor(blah));
+ }
+ * \endcode
+ */
+template<class F>
+void launch_core(std::string_view label,
+                 celeritas::CoreParams const& params,
+                 celeritas::CoreState<MemSpace::host>& state,
+                 F&& execute_thread)
+{
+    return launch_core(label,
+                       params,
+                       state,
+                       range(ThreadId{state.size()}),
+                       std::forward<F>(execute_thread));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Helper function to run an action in parallel on CPU.
+ *
+ * If tracks are sorted for this action, only the range of threads assigned to
+ * the action is executed. These arguments should be consistent with those in
+ * \c ActionLauncher.device.hh .
  *
  * Example:
  * \code
@@ -77,6 +103,16 @@ void launch_action(CoreStepActionInterface const& action,
                    celeritas::CoreState<MemSpace::host>& state,
                    F&& execute_thread)
 {
+    if (state.has_action_range()
+        && is_action_sorted(action.order(), params.init()->track_order()))
+    {
+        // Launch on a subset of threads
+        return launch_core(action.label(),
+                           params,
+                           state,
+                           state.get_action_range(action.action_id()),
+                           std::forward<F>(execute_thread));
+    }
     return launch_core(
         action.label(), params, state, std::forward<F>(execute_thread));
 }
@@ -18,9 +18,11 @@
 #include "corecel/cont/Range.hh"
 #include "corecel/sys/ActionRegistry.hh"
 #include "corecel/sys/Device.hh"
+#include "corecel/sys/PerfEventCounters.hh"
 #include "corecel/sys/ScopedProfiling.hh"
 #include "corecel/sys/Stopwatch.hh"
 #include "corecel/sys/Stream.hh"
+#include "corecel/sys/TraceCounter.hh"
 #include "celeritas/track/StatusChecker.hh"
 
 #include "ActionInterface.hh"
@@ -28,8 +30,35 @@
 #include "CoreState.hh"
 #include "Debug.hh"
 
+#include "detail/ActionTrackCounter.hh"
+
 namespace celeritas
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Whether an inapplicable post-step action can be skipped.
+ *
+ * When running a single track slot on host, we can preemptively skip
+ * inapplicable post-step actions.
+ */
+template<MemSpace M>
+bool skip_post_action(CoreState<M> const& state,
+                      CoreStepActionInterface const& action)
+{
+    if constexpr (M != MemSpace::host)
+    {
+        return false;
+    }
+    return state.size() == 1 && action.order() == StepActionOrder::post
+           && action.action_id()
+                  != state.ref().sim.post_step_action[TrackSlotId{0}];
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct from an action registry and sequence options.
@@ -37,8 +66,31 @@ namespace celeritas
 ActionSequence::ActionSequence(ActionRegistry const& reg, Options options)
     : actions_{reg}, options_{std::move(options)}
 {
-    // Initialize timing
+    // Initialize timing and counters
     accum_time_.resize(actions_.step().size());
+    if (options_.action_counts)
+    {
+        accum_tracks_.resize(actions_.step().size());
+        for (auto const& sp_action : actions_.step())
+        {
+            std::string label{sp_action->label()};
+            counter_labels_.push_back(label + "-tracks");
+            counter_labels_.push_back(label + "-ns-per-track");
+        }
+    }
+    if (options_.perf_counters)
+    {
+        perf_ = std::make_unique<PerfEventCounters>();
+        if (*perf_)
+        {
+            accum_cycles_.resize(actions_.step().size());
+            accum_cache_misses_.resize(actions_.step().size());
+        }
+        else
+        {
+            perf_.reset();
+        }
+    }
 
     // Get status checker if available
     for (auto const& brun_sp : actions_.begin_run())
@@ -56,6 +108,10 @@ ActionSequence::ActionSequence(ActionRegistry const& reg, Options options)
     CELER_ENSURE(actions_.step().size() == accum_time_.size());
 }
 
+//---------------------------------------------------------------------------//
+//! Default destructor
+ActionSequence::~ActionSequence() = default;
+
 //---------------------------------------------------------------------------//
 /*!
  * Initialize actions and states.
@@ -76,6 +132,36 @@ void ActionSequence::begin_run(CoreParams const& params, CoreState<M>& state)
  */
 template<MemSpace M>
 void ActionSequence::step(CoreParams const& params, CoreState<M>& state)
+{
+    if ((options_.action_times || options_.action_counts || perf_)
+        && !state.warming_up())
+    {
+        this->step_instrumented(params, state);
+        return;
+    }
+
+    // Just loop over the actions
+    for (auto const& sp_action : actions_.step())
+    {
+        if (auto const& action = *sp_action; !skip_post_action(state, action))
+        {
+            ScopedProfiling profile_this{action.label()};
+            action.step(params, state);
+            if (CELER_UNLIKELY(status_checker_))
+            {
+                status_checker_->step(action.action_id(), params, state);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Call all explicit actions and accumulate diagnostics.
+ */
+template<MemSpace M>
+void ActionSequence::step_instrumented(CoreParams const& params,
+                                       CoreState<M>& state)
 {
     [[maybe_unused]] Stream::StreamT stream = nullptr;
     if (M == MemSpace::device && options_.action_times)
@@ -83,57 +169,64 @@ void ActionSequence::step(CoreParams const& params, CoreState<M>& state)
         stream = celeritas::device().stream(state.stream_id()).get();
     }
 
-    // When running a single track slot on host, we can preemptively skip
-    // inapplicable post-step actions
-    auto const skip_post_action = [&](auto const& action) {
-        if constexpr (M != MemSpace::host)
+    auto step_actions = make_span(actions_.step());
+    for (auto i : range(step_actions.size()))
+    {
+        auto const& action = *step_actions[i];
+        if (skip_post_action(state, action))
         {
-            return false;
+            continue;
         }
-        return state.size() == 1 && action.order() == StepActionOrder::post
-               && action.action_id()
-                      != state.ref().sim.post_step_action[TrackSlotId{0}];
-    };
 
-    auto step_actions = make_span(actions_.step());
-    if (options_.action_times && !state.warming_up())
-    {
-        // Execute all actions and record the time elapsed
-        for (auto i : range(step_actions.size()))
+        size_type num_tracks{0};
+        if (options_.action_counts)
+        {
+            // Count before launching since the action may change the state
+            num_tracks = detail::count_action_tracks(state.ref().sim,
+                                                     state.stream_id(),
+                                                     action.order(),
+                                                     action.action_id());
+        }
+
+        ScopedProfiling profile_this{action.label()};
+        if (perf_)
         {
-            if (auto const& action = *step_actions[i];
-                !skip_post_action(action))
+            perf_->start();
+        }
+        Stopwatch get_time;
+        action.step(params, state);
+        if constexpr (M == MemSpace::device)
+        {
+            if (options_.action_times)
             {
-                ScopedProfiling profile_this{action.label()};
-                Stopwatch get_time;
-                action.step(params, state);
-                if constexpr (M == MemSpace::device)
-                {
-                    CELER_DEVICE_CALL_PREFIX(StreamSynchronize(stream));
-                }
-                accum_time_[i] += get_time();
-                if (CELER_UNLIKELY(status_checker_))
-                {
-                    status_checker_->step(action.action_id(), params, state);
-                }
+                CELER_DEVICE_CALL_PREFIX(StreamSynchronize(stream));
             }
         }
-    }
-    else
-    {
-        // Just loop over the actions
-        for (auto const& sp_action : actions_.step())
+        double const elapsed = get_time();
+        if (perf_)
+        {
+            auto counts = perf_->stop();
+            accum_cycles_[i] += counts.cycles;
+            accum_cache_misses_[i] += counts.cache_misses;
+        }
+        if (options_.action_times)
         {
-            if (auto const& action = *sp_action; !skip_post_action(action))
+            accum_time_[i] += elapsed;
+        }
+        if (options_.action_counts)
+        {
+            accum_tracks_[i] += num_tracks;
+            trace_counter(counter_labels_[2 * i].c_str(), num_tracks);
+            if (options_.action_times && num_tracks > 0)
             {
-                ScopedProfiling profile_this{action.label()};
-                action.step(params, state);
-                if (CELER_UNLIKELY(status_checker_))
-                {
-                    status_checker_->step(action.action_id(), params, state);
-                }
+                trace_counter(counter_labels_[2 * i + 1].c_str(),
+                              1e9 * elapsed / num_tracks);
             }
         }
+        if (CELER_UNLIKELY(status_checker_))
+        {
+            status_checker_->step(action.action_id(), params, state);
+        }
     }
 }
 
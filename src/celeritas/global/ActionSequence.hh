@@ -7,7 +7,9 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -20,12 +22,27 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 class ActionRegistry;
+class PerfEventCounters;
 class StatusChecker;
 
 //---------------------------------------------------------------------------//
 /*!
  * Sequence of step actions to invoke as part of a single step.
  *
+ * Optional instrumentation accumulates, for each step action:
+ * - wall time (\c action_times), which synchronizes the device after each
+ *   action;
+ * - the number of tracks the action applies to (\c action_counts): active
+ *   tracks for most actions, and tracks that selected the action for
+ *   along-step and post-step actions; counting on device synchronizes the
+ *   stream before each action; and
+ * - CPU cycles and cache misses (\c perf_counters) from Linux hardware
+ *   counters, summed over the constructing thread and its OpenMP workers.
+ *
+ * When counting is enabled, the per-step values are also written as trace
+ * counters named \c {action}-tracks (plus \c {action}-ns-per-track if timing)
+ * for display in a Perfetto timeline.
+ *
  * TODO accessors here are used by diagnostic output from celer-sim etc.;
  * perhaps make this public or add a diagnostic output for it?
  *
@@ -40,6 +57,7 @@ class ActionSequence
     //! \name Type aliases
     using ActionGroupsT = ActionGroups<CoreParams, CoreState>;
     using VecDouble = std::vector<double>;
+    using VecCount = std::vector<std::size_t>;
     //!@}
 
   public:
@@ -47,12 +65,17 @@ class ActionSequence
     struct Options
     {
         bool action_times{false};  //!< Call DeviceSynchronize and add timer
+        bool action_counts{false};  //!< Count applicable tracks
+        bool perf_counters{false};  //!< Read CPU hardware counters
     };
 
   public:
     // Construct from an action registry and sequence options
     ActionSequence(ActionRegistry const&, Options options);
 
+    // Default destructor
+    ~ActionSequence();
+
     //// INVOCATION ////
 
     // Call beginning-of-run actions.
@@ -74,11 +97,34 @@ class ActionSequence
     //! Get the corresponding accumulated time, if 'sync' or host called
     VecDouble const& accum_time() const { return accum_time_; }
 
+    //! Whether applicable tracks are being counted
+    bool action_counts() const { return options_.action_counts; }
+
+    //! Get the accumulated number of tracks each action applied to
+    VecCount const& accum_tracks() const { return accum_tracks_; }
+
+    //! Whether hardware counters are being read
+    bool perf_counters() const { return static_cast<bool>(perf_); }
+
+    //! Get the accumulated CPU cycles for each action
+    VecCount const& accum_cycles() const { return accum_cycles_; }
+
+    //! Get the accumulated cache misses for each action
+    VecCount const& accum_cache_misses() const { return accum_cache_misses_; }
+
   private:
     ActionGroupsT actions_;
     Options options_;
     VecDouble accum_time_;
+    VecCount accum_tracks_;
+    VecCount accum_cycles_;
+    VecCount accum_cache_misses_;
+    std::vector<std::string> counter_labels_;
     std::shared_ptr<StatusChecker const> status_checker_;
+    std::unique_ptr<PerfEventCounters> perf_;
+
+    template<MemSpace M>
+    void step_instrumented(CoreParams const&, CoreState<M>& state);
 };
 
 //---------------------------------------------------------------------------//
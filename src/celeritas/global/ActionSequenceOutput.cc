@@ -0,0 +1,102 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/ActionSequenceOutput.cc
+//---------------------------------------------------------------------------//
+#include "ActionSequenceOutput.hh"
+
+#include <utility>
+#include <nlohmann/json.hpp>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/io/JsonPimpl.hh"
+
+#include "ActionSequence.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Add diagnostics from a stepping loop.
+ */
+void ActionSequenceOutput::accumulate(ActionSequence const& actions)
+{
+    auto const& step = actions.actions().step();
+    for (auto i : range(step.size()))
+    {
+        auto& diag = diagnostics_[std::string{step[i]->label()}];
+        if (actions.action_times())
+        {
+            diag.time += actions.accum_time()[i];
+        }
+        if (actions.action_counts())
+        {
+            diag.tracks += actions.accum_tracks()[i];
+        }
+        if (actions.perf_counters())
+        {
+            diag.cycles += actions.accum_cycles()[i];
+            diag.cache_misses += actions.accum_cache_misses()[i];
+        }
+    }
+    action_times_ = action_times_ || actions.action_times();
+    action_counts_ = action_counts_ || actions.action_counts();
+    perf_counters_ = perf_counters_ || actions.perf_counters();
+    ++num_sequences_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write output to the given JSON object.
+ */
+void ActionSequenceOutput::output(JsonPimpl* j) const
+{
+    using json = nlohmann::json;
+
+    auto label = json::array();
+    auto time = json::array();
+    auto tracks = json::array();
+    auto time_per_track = json::array();
+    auto cycles = json::array();
+    auto cache_misses = json::array();
+
+    for (auto const& [action, diag] : diagnostics_)
+    {
+        label.push_back(action);
+        time.push_back(diag.time);
+        tracks.push_back(diag.tracks);
+        time_per_track.push_back(
+            diag.tracks > 0 ? diag.time / static_cast<double>(diag.tracks)
+                            : 0.0);
+        cycles.push_back(diag.cycles);
+        cache_misses.push_back(diag.cache_misses);
+    }
+
+    auto obj = json::object({
+        {"label", std::move(label)},
+        {"num_streams", num_sequences_},
+    });
+    if (action_times_)
+    {
+        obj["time"] = std::move(time);
+    }
+    if (action_counts_)
+    {
+        obj["tracks"] = std::move(tracks);
+        if (action_times_)
+        {
+            obj["time_per_track"] = std::move(time_per_track);
+        }
+    }
+    if (perf_counters_)
+    {
+        obj["cycles"] = std::move(cycles);
+        obj["cache_misses"] = std::move(cache_misses);
+    }
+    j->obj = std::move(obj);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,61 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/ActionSequenceOutput.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+#include "corecel/Types.hh"
+#include "corecel/io/OutputInterface.hh"
+
+namespace celeritas
+{
+class ActionSequence;
+//---------------------------------------------------------------------------//
+/*!
+ * Save per-action timing and throughput diagnostics.
+ *
+ * Diagnostics from one or more action sequences (one per stream) are summed
+ * by action label. The time per track is derived from the summed wall time
+ * and number of applicable tracks, and it is only written if both were
+ * recorded.
+ */
+class ActionSequenceOutput final : public OutputInterface
+{
+  public:
+    // Add diagnostics from a stepping loop
+    void accumulate(ActionSequence const& actions);
+
+    //! Category of data to write
+    Category category() const final { return Category::result; }
+
+    //! Name of the entry inside the category.
+    std::string_view label() const final { return "action-diagnostics"; }
+
+    // Write output to the given JSON object
+    void output(JsonPimpl*) const final;
+
+  private:
+    struct Diagnostics
+    {
+        double time{0};
+        std::size_t tracks{0};
+        std::size_t cycles{0};
+        std::size_t cache_misses{0};
+    };
+
+    std::map<std::string, Diagnostics> diagnostics_;
+    size_type num_sequences_{0};
+    bool action_times_{false};
+    bool action_counts_{false};
+    bool perf_counters_{false};
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
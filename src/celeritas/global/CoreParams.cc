@@ -101,7 +101,7 @@ build_params_refs(CoreParams::Input const& p, CoreScalars const& scalars)
 
 //---------------------------------------------------------------------------//
 
-ActionId find_along_step_id(ActionRegistry const& reg)
+ActionId find_along_step_id(ActionRegistry const& reg, ActionId neutral)
 {
     for (auto aidx : range(reg.num_actions()))
     {
@@ -110,7 +110,8 @@ ActionId find_along_step_id(ActionRegistry const& reg)
         if (auto expl
             = std::dynamic_pointer_cast<CoreStepActionInterface const>(base))
         {
-            if (expl->order() == StepActionOrder::along)
+            if (expl->order() == StepActionOrder::along
+                && expl->action_id() != neutral)
             {
                 return expl->action_id();
             }
@@ -135,8 +136,12 @@ class PropagationLimitAction final : public StaticConcreteAction
 //---------------------------------------------------------------------------//
 /*!
  * Construct always-required actions and set IDs.
+ *
+ * If a neutral along-step action is given, it must already be registered.
  */
-CoreScalars build_actions(ActionRegistry* reg)
+CoreScalars
+build_actions(ActionRegistry* reg,
+              std::shared_ptr<CoreStepActionInterface const> along_step_neutral)
 {
     using std::make_shared;
 
@@ -151,9 +156,21 @@ CoreScalars build_actions(ActionRegistry* reg)
     //// ALONG-STEP ACTIONS ////
 
     // Define neutral and user-provided along-step actions
-    std::shared_ptr<AlongStepNeutralAction const> along_step_neutral;
-    scalars.along_step_user_action = find_along_step_id(*reg);
-    if (scalars.along_step_user_action)
+    if (along_step_neutral)
+    {
+        ActionId const id = along_step_neutral->action_id();
+        CELER_VALIDATE(along_step_neutral->order() == StepActionOrder::along
+                           && id < reg->num_actions()
+                           && reg->action(id).get() == along_step_neutral.get(),
+                       << "neutral along-step action '"
+                       << along_step_neutral->label()
+                       << "' must be an along-step action registered before "
+                          "the core params are constructed");
+    }
+    scalars.along_step_user_action = find_along_step_id(
+        *reg,
+        along_step_neutral ? along_step_neutral->action_id() : ActionId{});
+    if (!along_step_neutral && scalars.along_step_user_action)
     {
         // Test whether user-provided action is neutral
         along_step_neutral
@@ -254,7 +271,8 @@ CoreParams::CoreParams(Input input) : input_(std::move(input))
     CELER_ASSERT(primaries);
 
     // Construct always-on actions and save their IDs
-    CoreScalars scalars = build_actions(input_.action_reg.get());
+    CoreScalars scalars = build_actions(input_.action_reg.get(),
+                                        input_.along_step_neutral);
 
     // Construct optional track-sorting actions
     auto insert_sort_tracks_action = [this](TrackOrder const track_order) {
@@ -265,6 +283,8 @@ CoreParams::CoreParams(Input input) : input_(std::move(input))
     {
         case TrackOrder::none:
         case TrackOrder::init_charge:
+        case TrackOrder::init_particle:
+        case TrackOrder::init_material:
         case TrackOrder::reindex_shuffle:
             break;
         case TrackOrder::reindex_status:
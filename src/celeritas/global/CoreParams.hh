@@ -58,6 +58,7 @@ class CoreParams final : public ParamsDataInterface<CoreParamsData>
     using SPActionRegistry = std::shared_ptr<ActionRegistry>;
     using SPOutputRegistry = std::shared_ptr<OutputRegistry>;
     using SPUserRegistry = std::shared_ptr<AuxParamsRegistry>;
+    using SPConstStepAction = std::shared_ptr<CoreStepActionInterface const>;
 
     template<MemSpace M>
     using ConstRef = CoreParamsData<Ownership::const_reference, M>;
@@ -83,6 +84,9 @@ class CoreParams final : public ParamsDataInterface<CoreParamsData>
         SPUserRegistry aux_reg;  //!< Optional, empty default
         SPConstMpiCommunicator mpi_comm;  //!< Optional, world_comm default
 
+        //! Optional registered action that replaces the neutral along-step
+        SPConstStepAction along_step_neutral;
+
         //! Maximum number of simultaneous threads/tasks per process
         StreamId::size_type max_streams{1};
 
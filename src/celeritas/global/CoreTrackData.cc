@@ -45,7 +45,7 @@ void resize(CoreStateData<Ownership::value, M>* state,
     state->stream_id = stream_id;
 
     if (params.init.track_order != TrackOrder::none
-        && params.init.track_order != TrackOrder::init_charge)
+        && !is_init_sorted(params.init.track_order))
     {
         resize(&state->track_slots, size);
         fill_sequence(&state->track_slots, stream_id);
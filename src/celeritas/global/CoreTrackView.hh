@@ -62,6 +62,9 @@ class CoreTrackView
     // Return a material view
     inline CELER_FUNCTION MaterialTrackView make_material_view() const;
 
+    // Return a material view of another material
+    inline CELER_FUNCTION MaterialView make_material_view(MaterialId) const;
+
     // Return a particle view
     inline CELER_FUNCTION ParticleTrackView make_particle_view() const;
 
@@ -74,6 +77,9 @@ class CoreTrackView
     // Return a physics view
     inline CELER_FUNCTION PhysicsTrackView make_physics_view() const;
 
+    // Return a physics view as if the track were in another material
+    inline CELER_FUNCTION PhysicsTrackView make_physics_view(MaterialId) const;
+
     // Return a view to temporary physics data
     inline CELER_FUNCTION PhysicsStepView make_physics_step_view() const;
 
@@ -186,6 +192,16 @@ CoreTrackView::make_material_view() const -> MaterialTrackView
         params_.materials, states_.materials, this->track_slot_id()};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Return a material view of another material.
+ */
+CELER_FUNCTION auto
+CoreTrackView::make_material_view(MaterialId mat_id) const -> MaterialView
+{
+    return MaterialView{params_.materials, mat_id};
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Return a particle view.
@@ -232,6 +248,23 @@ CELER_FUNCTION auto CoreTrackView::make_physics_view() const -> PhysicsTrackView
         params_.physics, states_.physics, par_id, mat_id, this->track_slot_id()};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Return a physics view as if the track were in another material.
+ *
+ * This is used to evaluate cross sections at a point that the track has not
+ * yet been moved to.
+ */
+CELER_FUNCTION auto
+CoreTrackView::make_physics_view(MaterialId mat_id) const -> PhysicsTrackView
+{
+    CELER_EXPECT(mat_id);
+    ParticleId par_id = this->make_particle_view().particle_id();
+    CELER_ASSERT(par_id);
+    return PhysicsTrackView{
+        params_.physics, states_.physics, par_id, mat_id, this->track_slot_id()};
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Return a physics view.
@@ -67,6 +67,8 @@ Stepper<M>::Stepper(Input input)
     : params_(std::move(input.params)), actions_{[&] {
         ActionSequenceT::Options opts;
         opts.action_times = input.action_times;
+        opts.action_counts = input.action_counts;
+        opts.perf_counters = input.perf_counters;
         return std::make_shared<ActionSequenceT>(*params_->action_reg(), opts);
     }()}
 {
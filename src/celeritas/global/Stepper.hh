@@ -39,6 +39,8 @@ class ActionSequence;
  * - \c num_track_slots : Maximum number of threads to run in parallel on GPU
  *   \c stream_id : Unique (thread/task) ID for this process
  * - \c action_times : Whether to synchronize device between actions for timing
+ * - \c action_counts : Whether to count track slots processed by each action
+ * - \c perf_counters : Whether to read CPU hardware counters for each action
  */
 struct StepperInput
 {
@@ -46,6 +48,8 @@ struct StepperInput
     StreamId stream_id{};
     size_type num_track_slots{};
     bool action_times{false};
+    bool action_counts{false};
+    bool perf_counters{false};
 
     //! True if defined
     explicit operator bool() const
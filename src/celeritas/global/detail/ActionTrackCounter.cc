@@ -0,0 +1,39 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/detail/ActionTrackCounter.cc
+//---------------------------------------------------------------------------//
+#include "ActionTrackCounter.hh"
+
+#include "corecel/cont/Range.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Count the tracks a step action applies to.
+ */
+size_type count_action_tracks(HostRef<SimStateData> const& sim,
+                              StreamId,
+                              StepActionOrder order,
+                              ActionId action)
+{
+    auto is_applicable = make_action_applicable(sim, order, action);
+    size_type result{0};
+    for (auto slot : range(sim.size()))
+    {
+        if (is_applicable(slot))
+        {
+            ++result;
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,42 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/detail/ActionTrackCounter.cu
+//---------------------------------------------------------------------------//
+#include "ActionTrackCounter.hh"
+
+#include <thrust/count.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include "corecel/sys/Thrust.device.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Count the tracks a step action applies to.
+ *
+ * This synchronizes the stream to return the result to the host.
+ */
+size_type count_action_tracks(DeviceRef<SimStateData> const& sim,
+                              StreamId stream,
+                              StepActionOrder order,
+                              ActionId action)
+{
+    auto result = thrust::count_if(
+        thrust_execute_on(stream),
+        thrust::make_counting_iterator<size_type>(0),
+        thrust::make_counting_iterator<size_type>(sim.size()),
+        make_action_applicable(sim, order, action));
+    CELER_DEVICE_CHECK_ERROR();
+    return static_cast<size_type>(result);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
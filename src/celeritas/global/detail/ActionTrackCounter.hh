@@ -0,0 +1,101 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/detail/ActionTrackCounter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/sys/ActionInterface.hh"
+#include "corecel/sys/ThreadId.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/track/SimData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Whether a step action applies to the track in a given slot.
+ *
+ * Along-step and post-step actions apply only to tracks that selected them;
+ * all other step actions apply to every active track. This mirrors the
+ * conditions used by \c make_along_step_track_executor and
+ * \c make_action_track_executor .
+ */
+struct IsActionApplicable
+{
+    TrackStatus const* status{nullptr};
+    ActionId const* action_ids{nullptr};
+    ActionId action;
+
+    CELER_FUNCTION bool operator()(size_type slot) const
+    {
+        if (action_ids)
+        {
+            return action_ids[slot] == action;
+        }
+        return status[slot] != TrackStatus::inactive;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the applicability predicate for an action.
+ */
+template<MemSpace M>
+inline IsActionApplicable
+make_action_applicable(SimStateData<Ownership::reference, M> const& sim,
+                       StepActionOrder order,
+                       ActionId action)
+{
+    CELER_EXPECT(sim);
+    CELER_EXPECT(action);
+
+    IsActionApplicable result;
+    result.status = sim.status.data().get();
+    result.action = action;
+    if (order == StepActionOrder::along)
+    {
+        result.action_ids = sim.along_step_action.data().get();
+    }
+    else if (order == StepActionOrder::pre_post
+             || order == StepActionOrder::post)
+    {
+        result.action_ids = sim.post_step_action.data().get();
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// Count the tracks a step action applies to
+size_type count_action_tracks(HostRef<SimStateData> const&,
+                              StreamId,
+                              StepActionOrder,
+                              ActionId);
+size_type count_action_tracks(DeviceRef<SimStateData> const&,
+                              StreamId,
+                              StepActionOrder,
+                              ActionId);
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+inline size_type count_action_tracks(DeviceRef<SimStateData> const&,
+                                     StreamId,
+                                     StepActionOrder,
+                                     ActionId)
+{
+    CELER_NOT_CONFIGURED("CUDA or HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
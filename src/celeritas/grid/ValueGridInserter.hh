@@ -43,7 +43,7 @@ class ValueGridInserter
     //!@{
     //! \name Type aliases
     using RealCollection
-        = Collection<real_type, Ownership::value, MemSpace::host>;
+        = Collection<table_real_type, Ownership::value, MemSpace::host>;
     using XsGridCollection
         = Collection<XsGridData, Ownership::value, MemSpace::host>;
     using SpanConstDbl = Span<double const>;
@@ -63,7 +63,7 @@ class ValueGridInserter
     XsIndex operator()(UniformGridData const& log_grid, SpanConstDbl values);
 
   private:
-    CollectionBuilder<real_type, MemSpace::host, ItemId<real_type>> values_;
+    CollectionBuilder<table_real_type, MemSpace::host> values_;
     CollectionBuilder<XsGridData, MemSpace::host, ItemId<XsGridData>> xs_grids_;
 };
 
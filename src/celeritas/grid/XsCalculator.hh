@@ -48,8 +48,9 @@ class XsCalculator
     //!@{
     //! \name Type aliases
     using Energy = Quantity<XsGridData::EnergyUnits>;
-    using Values
-        = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+    using Values = Collection<table_real_type,
+                              Ownership::const_reference,
+                              MemSpace::native>;
     //!@}
 
   public:
@@ -38,7 +38,7 @@ struct XsGridData
 
     UniformGridData log_energy;
     size_type prime_index{no_scaling()};
-    ItemRange<real_type> value;
+    ItemRange<table_real_type> value;
 
     //! Whether the interface is initialized and valid
     explicit CELER_FUNCTION operator bool() const
@@ -23,6 +23,27 @@ struct ImportRegion
     bool user_limits{false};
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Store step limits and tracking cuts attached to a logical volume.
+ *
+ * These correspond to the \c G4UserLimits used by \c G4StepLimiter and \c
+ * G4UserSpecialCuts . Values are in the native unit system, and a zero value
+ * means the limit is not set.
+ */
+struct ImportUserLimits
+{
+    double max_step{0};  //!< Maximum step length [len]
+    double max_time{0};  //!< Maximum lab-frame time [time]
+    double min_energy{0};  //!< Minimum kinetic energy [MeV]
+
+    //! Whether any limit is set
+    explicit operator bool() const
+    {
+        return max_step > 0 || max_time > 0 || min_energy > 0;
+    }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Store logical volume properties.
@@ -49,6 +70,7 @@ struct ImportVolume
     Index phys_material_id{unspecified};  //!< Material modified by physics
     std::string name;
     std::string solid_name;
+    ImportUserLimits user_limits;  //!< Optional step limits and cuts
 
     //! Whether this represents a physical volume or is just a placeholder
     explicit operator bool() const { return geo_material_id != unspecified; }
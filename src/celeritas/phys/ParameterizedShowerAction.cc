@@ -0,0 +1,191 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/ParameterizedShowerAction.cc
+//---------------------------------------------------------------------------//
+#include "ParameterizedShowerAction.hh"
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/sys/ActionRegistry.hh"  // IWYU pragma: keep
+#include "celeritas/geo/GeoMaterialParams.hh"
+#include "celeritas/global/ActionLauncher.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+#include "celeritas/mat/MaterialParams.hh"
+#include "celeritas/user/MeshCalo.hh"
+#include "celeritas/user/detail/StepGatherUtils.hh"
+
+#include "ParticleParams.hh"
+
+#include "detail/ParameterizedShowerExecutor.hh"  // IWYU pragma: associated
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the shower properties of a material.
+ *
+ * The critical energy uses the PDG fits for solids/liquids and gases, and the
+ * Moliere radius uses the scale energy \f$ E_s = 21.2 \f$ MeV.
+ */
+ShowerMaterial make_shower_material(MaterialView const& mat)
+{
+    ShowerMaterial result;
+    if (!(mat.density() > 0) || !std::isfinite(mat.radiation_length()))
+    {
+        return result;
+    }
+
+    real_type const z = mat.zeff();
+    real_type const ec
+        = mat.matter_state() == MatterState::gas ? 710 / (z + 0.92)
+                                                  : 610 / (z + 1.24);
+    result.radiation_length = mat.radiation_length();
+    result.critical_energy = units::MevEnergy{ec};
+    result.moliere_radius = real_type(21.2052) * result.radiation_length / ec;
+    result.zeff = z;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct and add to core params.
+ */
+std::shared_ptr<ParameterizedShowerAction>
+ParameterizedShowerAction::make_and_insert(CoreParams const& core,
+                                           Input const& input)
+{
+    ActionRegistry& actions = *core.action_reg();
+    auto result
+        = std::make_shared<ParameterizedShowerAction>(actions.next_id(),
+                                                      *core.geomaterial(),
+                                                      *core.material(),
+                                                      *core.particle(),
+                                                      input);
+    detail::validate_before_step_gather(actions, result->label());
+    actions.insert(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with action ID, problem definition, and options.
+ */
+ParameterizedShowerAction::ParameterizedShowerAction(
+    ActionId id,
+    GeoMaterialParams const& geo_mat,
+    MaterialParams const& materials,
+    ParticleParams const& particles,
+    Input const& input)
+    : id_(id), mesh_(input.mesh)
+{
+    CELER_EXPECT(id_);
+    CELER_VALIDATE(!input.regions.empty(),
+                   << "no regions for parameterized showers were specified");
+    CELER_VALIDATE(!input.particles.empty(),
+                   << "no particles for parameterized showers were "
+                      "specified");
+    CELER_VALIDATE(input.min_energy > zero_quantity()
+                       && input.max_energy > input.min_energy,
+                   << "invalid parameterized shower energy range ["
+                   << input.min_energy.value() << ", "
+                   << input.max_energy.value() << ")");
+    CELER_VALIDATE(input.max_spots > 0,
+                   << "invalid maximum number of shower spots "
+                   << input.max_spots);
+    auto const& regions = geo_mat.regions();
+    CELER_VALIDATE(regions.size() > 0,
+                   << "parameterized showers require geometry regions, but "
+                      "none are defined");
+
+    auto const num_particles = particles.size();
+    std::vector<Energy> thresholds(regions.size() * num_particles, Energy{0});
+    for (auto const& name : input.regions)
+    {
+        RegionId region = regions.find_unique(name);
+        CELER_VALIDATE(region, << "no region named '" << name << "' exists");
+        for (PDGNumber pdg : input.particles)
+        {
+            ParticleId pid = particles.find(pdg);
+            CELER_VALIDATE(pid,
+                           << "particle with PDG " << pdg.get()
+                           << " for parameterized showers is not defined");
+            thresholds[region.get() * num_particles + pid.get()]
+                = input.min_energy;
+        }
+    }
+
+    HostVal<ParameterizedShowerParamsData> host_data;
+    make_builder(&host_data.min_energy)
+        .insert_back(thresholds.begin(), thresholds.end());
+    auto shower_mat = make_builder(&host_data.materials);
+    shower_mat.reserve(materials.size());
+    for (auto mat_id : range(MaterialId{materials.size()}))
+    {
+        shower_mat.push_back(make_shower_material(materials.get(mat_id)));
+    }
+    host_data.max_energy = input.max_energy;
+    host_data.num_regions = regions.size();
+    host_data.num_particles = num_particles;
+    host_data.max_spots = input.max_spots;
+    host_data.profile = input.profile;
+
+    data_ = CollectionMirror<ParameterizedShowerParamsData>{
+        std::move(host_data)};
+    CELER_ENSURE(data_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a long description of the action.
+ */
+std::string_view ParameterizedShowerAction::description() const
+{
+    return "replace electromagnetic showers with a parameterization";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the shower parameterization with host data.
+ */
+void ParameterizedShowerAction::step(CoreParams const& params,
+                                     CoreStateHost& state) const
+{
+    detail::ParameterizedShowerExecutor execute_shower{
+        this->host_ref(), {}, {}};
+    if (mesh_)
+    {
+        execute_shower.mesh_params = mesh_->params_ref<MemSpace::host>();
+        execute_shower.mesh_state = mesh_->state_ref<MemSpace::host>(
+            state.stream_id(), state.size());
+    }
+    auto execute = make_active_track_executor(
+        params.ptr<MemSpace::native>(), state.ptr(), execute_shower);
+    launch_action(*this, params, state, execute);
+}
+
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+void ParameterizedShowerAction::step(CoreParams const&,
+                                     CoreStateDevice&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,42 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/ParameterizedShowerAction.cu
+//---------------------------------------------------------------------------//
+#include "ParameterizedShowerAction.hh"
+
+#include "celeritas/global/ActionLauncher.device.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+#include "celeritas/user/MeshCalo.hh"
+
+#include "detail/ParameterizedShowerExecutor.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the shower parameterization with device data.
+ */
+void ParameterizedShowerAction::step(CoreParams const& params,
+                                     CoreStateDevice& state) const
+{
+    detail::ParameterizedShowerExecutor execute_shower{
+        this->device_ref(), {}, {}};
+    if (mesh_)
+    {
+        execute_shower.mesh_params = mesh_->params_ref<MemSpace::device>();
+        execute_shower.mesh_state = mesh_->state_ref<MemSpace::device>(
+            state.stream_id(), state.size());
+    }
+    auto execute = make_active_track_executor(
+        params.ptr<MemSpace::native>(), state.ptr(), execute_shower);
+    static ActionLauncher<decltype(execute)> const launch_kernel(*this);
+    launch_kernel(state, execute);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
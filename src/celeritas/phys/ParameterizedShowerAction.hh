@@ -0,0 +1,127 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/ParameterizedShowerAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "corecel/data/CollectionMirror.hh"
+#include "corecel/data/ParamsDataInterface.hh"
+#include "corecel/math/NumericLimits.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/global/ActionInterface.hh"
+
+#include "PDGNumber.hh"
+#include "ParameterizedShowerData.hh"
+
+namespace celeritas
+{
+class GeoMaterialParams;
+class MaterialParams;
+class MeshCalo;
+class ParticleParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Replace electromagnetic showers with a parameterization in some regions.
+ *
+ * This is an in-loop fast simulation in the style of GFlash. At the end of
+ * each step, an electron, positron, or photon above an energy threshold in one
+ * of the selected regions is killed and its energy is distributed among
+ * "spots" sampled from the average longitudinal and lateral shower profiles of
+ * the current material (see \c ShowerProfileParameters ). The shower is
+ * assumed to be contained in a homogeneous medium, so the regions should
+ * enclose large calorimeter volumes.
+ *
+ * The spots are scored directly on an optional \c MeshCalo (whose
+ * thread-private tallies are summed by \c MeshCalo::reduce rather than after
+ * each step). Without a mesh, the shower energy is deposited at the end of
+ * the step, which is sufficient for scoring the total energy in a detector
+ * volume with \c SimpleCalo . To score the deposited energy, this action must
+ * be created before any step collector.
+ *
+ * Since the shower only starts when a step ends inside a volume, a photon
+ * entering a region is parameterized after its first interaction there.
+ */
+class ParameterizedShowerAction final
+    : public CoreStepActionInterface,
+      public ParamsDataInterface<ParameterizedShowerParamsData>
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Energy = units::MevEnergy;
+    using SPMeshCalo = std::shared_ptr<MeshCalo>;
+    //!@}
+
+    //! Regions, particle types, and shower parameters
+    struct Input
+    {
+        //! Names of regions in which showers are parameterized
+        std::vector<std::string> regions;
+        //! Particle types that start a shower
+        std::vector<PDGNumber> particles{
+            pdg::electron(), pdg::positron(), pdg::gamma()};
+        //! Minimum energy for a parameterized shower
+        Energy min_energy{100};
+        //! Tracks at or above this energy are transported normally
+        Energy max_energy{numeric_limits<real_type>::infinity()};
+        //! Maximum number of energy spots per shower
+        size_type max_spots{1000};
+        //! Profile coefficients (default: GFlash homogeneous media)
+        ShowerProfileParameters profile;
+        //! Optional mesh on which to score the showers
+        SPMeshCalo mesh;
+    };
+
+  public:
+    // Construct and add to core params
+    static std::shared_ptr<ParameterizedShowerAction>
+    make_and_insert(CoreParams const& core, Input const& input);
+
+    // Construct with action ID, problem definition, and options
+    ParameterizedShowerAction(ActionId id,
+                              GeoMaterialParams const& geo_mat,
+                              MaterialParams const& materials,
+                              ParticleParams const& particles,
+                              Input const& input);
+
+    //!@{
+    //! \name Action interface
+    //! ID of the action
+    ActionId action_id() const final { return id_; }
+    //! Short name for the action
+    std::string_view label() const final { return "parameterized-shower"; }
+    // Description of the action for user interaction
+    std::string_view description() const final;
+    //! Dependency ordering of the action
+    StepActionOrder order() const final { return StepActionOrder::user_post; }
+    //!@}
+
+    //!@{
+    //! \name StepAction interface
+    // Launch kernel with host data
+    void step(CoreParams const&, CoreStateHost&) const final;
+    // Launch kernel with device data
+    void step(CoreParams const&, CoreStateDevice&) const final;
+    //!@}
+
+    //! Access data on the host
+    HostRef const& host_ref() const final { return data_.host_ref(); }
+    //! Access data on the device
+    DeviceRef const& device_ref() const final { return data_.device_ref(); }
+
+  private:
+    ActionId id_;
+    CollectionMirror<ParameterizedShowerParamsData> data_;
+    SPMeshCalo mesh_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,133 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/ParameterizedShowerData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/data/Collection.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Coefficients of the electromagnetic shower parameterization.
+ *
+ * These are the coefficients of the GFlash parameterization of homogeneous
+ * media [Grindhammer and Peters, arXiv:hep-ex/0001020], where \em y is the
+ * energy in units of the critical energy, \em E is the energy in GeV, \em Z
+ * is the effective atomic number, and \f$ \tau = t / T \f$ is the depth
+ * relative to the shower maximum. The defaults are the published values and
+ * can be replaced with values fitted to full simulation of a detector.
+ */
+struct ShowerProfileParameters
+{
+    //! Depth of the maximum \f$ T = \ln y + t_0 \f$ [X0]
+    real_type t0{-0.858};
+    //! Additional depth of the maximum for photon showers [X0]
+    real_type photon_t0{1};
+    //! Shape \f$ \alpha = a_0 + (a_1 + a_2 / Z) \ln y \f$
+    Array<real_type, 3> alpha{0.21, 0.492, 2.38};
+    //! Core radius \f$ (r_0 + r_1 \ln E) + (r_2 + r_3 Z) \tau \f$ [R_M]
+    Array<real_type, 4> core_radius{0.0251, 0.00319, 0.1162, -0.000381};
+    //! Tail radius coefficients \f$ k_1 \ldots k_4 \f$ [R_M]
+    Array<real_type, 6> tail_radius{
+        0.659, -0.00309, 0.645, -2.59, 0.3585, 0.0421};
+    //! Core probability coefficients \f$ p_1 \ldots p_3 \f$
+    Array<real_type, 6> core_prob{
+        2.632, -0.00094, 0.401, 0.00187, 1.313, -0.0686};
+    //! Number of spots \f$ N = n_0 \ln Z E^{n_1} \f$
+    Array<real_type, 2> num_spots{93.0, 0.876};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Material properties that scale the shower profile.
+ */
+struct ShowerMaterial
+{
+    real_type radiation_length{};  //!< [len]
+    real_type moliere_radius{};  //!< [len]
+    units::MevEnergy critical_energy;
+    real_type zeff{};
+
+    //! Whether a shower can be parameterized in this material
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return radiation_length > 0 && moliere_radius > 0
+               && critical_energy > zero_quantity() && zeff > 1;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Regions, particles, and materials for parameterized showers.
+ *
+ * The energy thresholds are stored as a flattened [region][particle] array
+ * over all regions and particle types in the problem; a zero threshold
+ * disables the parameterization. Materials that cannot support a shower (such
+ * as vacuum) have a null \c ShowerMaterial .
+ */
+template<Ownership W, MemSpace M>
+struct ParameterizedShowerParamsData
+{
+    //// TYPES ////
+
+    template<class T>
+    using Items = Collection<T, W, M>;
+    using Energy = units::MevEnergy;
+
+    //// DATA ////
+
+    //! Minimum energy for each [region][particle]
+    Items<Energy> min_energy;
+    //! Shower properties for each material
+    Collection<ShowerMaterial, W, M, MaterialId> materials;
+    //! Tracks at or above this energy are transported normally
+    Energy max_energy;
+    //! Number of regions
+    RegionId::size_type num_regions{0};
+    //! Number of particle types
+    ParticleId::size_type num_particles{0};
+    //! Maximum number of energy spots per shower
+    size_type max_spots{0};
+
+    ShowerProfileParameters profile;
+
+    //// METHODS ////
+
+    //! Whether the data are assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return num_regions > 0 && num_particles > 0
+               && min_energy.size() == num_regions * num_particles
+               && !materials.empty() && max_energy > zero_quantity()
+               && max_spots > 0;
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    ParameterizedShowerParamsData&
+    operator=(ParameterizedShowerParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        min_energy = other.min_energy;
+        materials = other.materials;
+        max_energy = other.max_energy;
+        num_regions = other.num_regions;
+        num_particles = other.num_particles;
+        max_spots = other.max_spots;
+        profile = other.profile;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -122,9 +122,16 @@ struct IntegralXsProcess
  * \c range are the process-integrated dE/dx and range for the particle.  \c
  * integral_xs will only be assigned if the integral approach is used and the
  * particle has continuous-discrete processes.
+ *
+ * If the "general process" option is enabled for photons, \c general_xs is
+ * the total macroscopic cross section of all processes, and \c
+ * general_cdf is the cumulative fraction of the total for each process. These
+ * replace the per-process cross sections above \c general_lower .
  */
 struct ProcessGroup
 {
+    using Energy = units::MevEnergy;
+
     ItemRange<ProcessId> processes;  //!< Processes that apply [ppid]
     ItemRange<ModelGroup> models;  //!< Model applicability [ppid]
     ItemRange<IntegralXsProcess> integral_xs;  //!< [ppid]
@@ -133,6 +140,10 @@ struct ProcessGroup
     ValueTableId range;  //!< Process-integrated range
     bool has_at_rest{};  //!< Whether the particle type has an at-rest process
 
+    ValueTableId general_xs;  //!< Total macro xs (optional)
+    ItemRange<ValueTable> general_cdf;  //!< Cumulative fraction [ppid]
+    Energy general_lower;  //!< Lowest energy of the total xs tables
+
     //! True if assigned and valid
     explicit CELER_FUNCTION operator bool() const
     {
@@ -331,6 +342,7 @@ struct PhysicsParamsData
 
     // Backend storage
     Items<real_type> reals;
+    Items<table_real_type> table_values;
     Items<ParticleModelId> pmodel_ids;
     Items<ValueGrid> value_grids;
     Items<ValueGridId> value_grid_ids;
@@ -364,6 +376,7 @@ struct PhysicsParamsData
         CELER_EXPECT(other);
 
         reals = other.reals;
+        table_values = other.table_values;
         pmodel_ids = other.pmodel_ids;
         value_grids = other.value_grids;
         value_grid_ids = other.value_grid_ids;
@@ -499,7 +512,8 @@ inline void resize(PhysicsStateData<Ownership::value, M>* state,
     resize(&state->relaxation, params.hardwired.relaxation_data, size);
     resize(
         &state->secondaries,
-        static_cast<size_type>(size * params.scalars.secondary_stack_factor));
+        static_cast<size_type>(size * params.scalars.secondary_stack_factor),
+        num_stack_allocator_threads());
 }
 
 //---------------------------------------------------------------------------//
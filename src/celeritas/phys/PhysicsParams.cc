@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <map>
 #include <set>
 #include <string_view>
@@ -47,6 +48,7 @@
 #include "celeritas/neutron/model/ChipsNeutronElasticModel.hh"
 
 #include "Model.hh"
+#include "PDGNumber.hh"
 #include "ParticleParams.hh"
 #include "PhysicsData.hh"
 #include "Process.hh"
@@ -148,6 +150,10 @@ PhysicsParams::PhysicsParams(Input inp)
     this->build_ids(*inp.particles, &host_data);
     this->build_xs(inp.options, *inp.materials, &host_data);
     this->build_model_xs(*inp.materials, &host_data);
+    if (inp.options.gamma_general)
+    {
+        this->build_general_xs(*inp.particles, &host_data);
+    }
 
     // Add step limiter if being used (TODO: remove this hack from physics)
     if (inp.options.fixed_step_limiter > 0)
@@ -456,7 +462,7 @@ void PhysicsParams::build_xs(Options const& opts,
     using Energy = Applicability::Energy;
     using VGT = ValueGridType;
 
-    ValueGridInserter insert_grid(&data->reals, &data->value_grids);
+    ValueGridInserter insert_grid(&data->table_values, &data->value_grids);
     auto value_tables = make_builder(&data->value_tables);
     auto integral_xs = make_builder(&data->integral_xs);
     auto value_grid_ids = make_builder(&data->value_grid_ids);
@@ -552,7 +558,8 @@ void PhysicsParams::build_xs(Options const& opts,
                     auto const& grid_data = data->value_grids[grid_id];
                     auto data_ref = make_const_ref(*data);
                     UniformGrid const loge_grid(grid_data.log_energy);
-                    XsCalculator const calc_xs(grid_data, data_ref.reals);
+                    XsCalculator const calc_xs(grid_data,
+                                               data_ref.table_values);
 
                     // Check if the particle can have a discrete interaction at
                     // rest
@@ -641,7 +648,7 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
 {
     CELER_EXPECT(*data);
 
-    ValueGridInserter insert_grid(&data->reals, &data->value_grids);
+    ValueGridInserter insert_grid(&data->table_values, &data->value_grids);
 
     // Micro xs grid IDs for each model and applicable particle, each material,
     // and each element in the material
@@ -721,10 +728,11 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
             }
 
             // Get the xs value for the given element and bin
-            auto get_value = [&](size_type elcomp, size_type bin) -> real_type& {
+            auto get_value
+                = [&](size_type elcomp, size_type bin) -> table_real_type& {
                 XsGridData& grid = data->value_grids[grid_ids[elcomp]];
                 CELER_ASSERT(bin < grid.value.size());
-                return data->reals[grid.value[bin]];
+                return data->table_values[grid.value[bin]];
             };
 
             // Get the number of grid points: the energy grids are the
@@ -738,7 +746,7 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
                 real_type cum_xs{0};
                 for (auto elcomp_idx : range(elements.size()))
                 {
-                    real_type& xs = get_value(elcomp_idx, bin_idx);
+                    table_real_type& xs = get_value(elcomp_idx, bin_idx);
                     cum_xs += xs * elements[elcomp_idx].fraction;
                     xs = cum_xs;
                 }
@@ -748,7 +756,7 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
                 {
                     for (auto elcomp_idx : range(elements.size()))
                     {
-                        real_type& xs = get_value(elcomp_idx, bin_idx);
+                        table_real_type& xs = get_value(elcomp_idx, bin_idx);
                         xs /= cum_xs;
                     }
                 }
@@ -767,5 +775,186 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct combined cross section tables for photons.
+ *
+ * The total macroscopic cross section and the cumulative fraction of each
+ * process are tabulated on a single log energy grid for each material. The
+ * grid spans all the process cross section grids, with the finest resolution
+ * of any of them. Below the threshold for on-the-fly photoelectric cross
+ * sections, the tables are not used and the cross sections are calculated
+ * per process.
+ */
+void PhysicsParams::build_general_xs(ParticleParams const& particles,
+                                     HostValue* data) const
+{
+    CELER_EXPECT(*data);
+
+    ParticleId const gamma = particles.find(pdg::gamma());
+    if (!gamma || !data->process_groups[gamma])
+    {
+        CELER_LOG(warning) << "Ignoring gamma general process option: "
+                              "photons have no processes";
+        return;
+    }
+
+    ProcessGroup& group = data->process_groups[gamma];
+    CELER_VALIDATE(!data->value_tables[group.energy_loss],
+                   << "gamma general process cannot be used with photon "
+                      "energy loss");
+
+    Span<ProcessId const> processes = data->process_ids[group.processes];
+    Span<IntegralXsProcess const> integral_xs
+        = data->integral_xs[group.integral_xs];
+    Span<ValueTable const> xs_tables = data->value_tables[group.macro_xs];
+    auto const num_processes = processes.size();
+
+    // Find the combined energy grid bounds and resolution
+    real_type lower = std::numeric_limits<real_type>::infinity();
+    real_type upper = -lower;
+    real_type bins_per_decade = 0;
+    size_type num_mats = 0;
+    for (auto pp_idx : range(num_processes))
+    {
+        ProcessId const pid = processes[pp_idx];
+        CELER_VALIDATE(pid != data->hardwired.positron_annihilation
+                           && pid != data->hardwired.neutron_elastic
+                           && !integral_xs[pp_idx],
+                       << "process '" << this->process(pid)->label()
+                       << "' cannot be combined in the gamma general process");
+        if (!xs_tables[pp_idx])
+        {
+            continue;
+        }
+        num_mats = xs_tables[pp_idx].grids.size();
+        for (auto grid_ref : xs_tables[pp_idx].grids)
+        {
+            if (auto grid_id = data->value_grid_ids[grid_ref])
+            {
+                UniformGridData const& loge
+                    = data->value_grids[grid_id].log_energy;
+                lower = std::min(lower, loge.front);
+                upper = std::max(upper, loge.back);
+                bins_per_decade = std::max(
+                    bins_per_decade,
+                    std::log(real_type{10}) / loge.delta);
+            }
+        }
+    }
+    if (data->hardwired.photoelectric)
+    {
+        lower = std::max(
+            lower,
+            std::log(data->hardwired.photoelectric_table_thresh.value()));
+    }
+    if (!(lower < upper))
+    {
+        CELER_LOG(warning) << "Ignoring gamma general process option: "
+                              "photons have no tabulated cross sections";
+        return;
+    }
+    auto const loge_grid = UniformGridData::from_bounds(
+        lower,
+        upper,
+        static_cast<size_type>(
+            std::ceil((upper - lower) / std::log(real_type{10})
+                      * bins_per_decade))
+            + 1);
+
+    // Calculate the total and cumulative cross sections before inserting any
+    // grids, since insertion invalidates the data references
+    std::vector<std::vector<double>> total_xs(num_mats);
+    std::vector<std::vector<std::vector<double>>> cum_xs(num_mats);
+    {
+        auto data_ref = make_const_ref(*data);
+        UniformGrid const grid(loge_grid);
+        for (auto mat_idx : range(num_mats))
+        {
+            auto& total = total_xs[mat_idx];
+            auto& cumulative = cum_xs[mat_idx];
+            total.assign(grid.size(), 0);
+            cumulative.assign(num_processes, total);
+            bool has_grid{false};
+            for (auto pp_idx : range(num_processes))
+            {
+                ValueGridId grid_id;
+                if (xs_tables[pp_idx])
+                {
+                    grid_id = data->value_grid_ids
+                                  [xs_tables[pp_idx].grids[mat_idx]];
+                }
+                if (grid_id)
+                {
+                    has_grid = true;
+                    XsCalculator const calc_xs(data->value_grids[grid_id],
+                                               data_ref.table_values);
+                    for (auto i : range(grid.size()))
+                    {
+                        total[i] += calc_xs(
+                            units::MevEnergy{std::exp(grid[i])});
+                    }
+                }
+                cumulative[pp_idx] = total;
+            }
+            if (!has_grid)
+            {
+                total.clear();
+            }
+        }
+    }
+
+    ValueGridInserter insert_grid(&data->table_values, &data->value_grids);
+    auto value_grid_ids = make_builder(&data->value_grid_ids);
+    auto value_tables = make_builder(&data->value_tables);
+
+    // Construct the total cross section table
+    std::vector<ValueGridId> grid_ids(num_mats);
+    for (auto mat_idx : range(num_mats))
+    {
+        if (!total_xs[mat_idx].empty())
+        {
+            grid_ids[mat_idx]
+                = insert_grid(loge_grid, make_span(total_xs[mat_idx]));
+        }
+    }
+    ValueTable total_table;
+    total_table.grids
+        = value_grid_ids.insert_back(grid_ids.begin(), grid_ids.end());
+
+    // Construct the cumulative fraction tables for each process
+    std::vector<ValueTable> cdf_tables(num_processes);
+    for (auto pp_idx : range(num_processes))
+    {
+        for (auto mat_idx : range(num_mats))
+        {
+            auto const& total = total_xs[mat_idx];
+            grid_ids[mat_idx] = {};
+            if (total.empty())
+            {
+                continue;
+            }
+            std::vector<double> cdf = cum_xs[mat_idx][pp_idx];
+            for (auto i : range(cdf.size()))
+            {
+                cdf[i] = total[i] > 0 ? cdf[i] / total[i] : 1;
+            }
+            grid_ids[mat_idx] = insert_grid(loge_grid, make_span(cdf));
+        }
+        cdf_tables[pp_idx].grids
+            = value_grid_ids.insert_back(grid_ids.begin(), grid_ids.end());
+    }
+
+    group.general_xs = value_tables.push_back(total_table);
+    group.general_cdf
+        = value_tables.insert_back(cdf_tables.begin(), cdf_tables.end());
+    group.general_lower = units::MevEnergy{std::exp(lower)};
+
+    CELER_LOG(debug) << "Built gamma general process tables with "
+                     << loge_grid.size << " points from "
+                     << group.general_lower.value() << " to "
+                     << std::exp(upper) << " MeV";
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -73,6 +73,10 @@ class ParticleParams;
  *   spline interpolation. If it is 1, then the existing linear interpolation
  *   is used. If it is 2+, the spline interpolation is used for energy loss
  *   using the specified order. Default value is 1
+ * - \c gamma_general: for photons, tabulate a single total cross section and
+ *   the cumulative fraction of each process (like Geant4's \c
+ *   G4GammaGeneralProcess ) so that the step limit requires a single
+ *   interpolation rather than one per process.
  *
  * NOTE: min_range/max_step_over_range are not accessible through Geant4, and
  * they can also be set to be different for electrons, mu/hadrons, and ions
@@ -108,6 +112,7 @@ struct PhysicsParamsOptions
     bool disable_integral_xs = false;
 
     size_type spline_eloss_order = 1;
+    bool gamma_general = false;
 };
 
 //---------------------------------------------------------------------------//
@@ -229,6 +234,8 @@ class PhysicsParams final : public ParamsDataInterface<PhysicsParamsData>
                   MaterialParams const& mats,
                   HostValue* data) const;
     void build_model_xs(MaterialParams const& mats, HostValue* data) const;
+    void build_general_xs(ParticleParams const& particles,
+                          HostValue* data) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -97,6 +97,7 @@ void PhysicsParamsOutput::output(JsonPimpl* j) const
         auto sizes = json::object();
 #define PPO_SAVE_SIZE(NAME) sizes[#NAME] = data.NAME.size()
         PPO_SAVE_SIZE(reals);
+        PPO_SAVE_SIZE(table_values);
         PPO_SAVE_SIZE(model_ids);
         PPO_SAVE_SIZE(value_grids);
         PPO_SAVE_SIZE(value_grid_ids);
@@ -49,29 +49,43 @@ calc_physics_step_limit(MaterialTrackView const& material,
      * step, we can reuse the previously calculated cross section.
      */
 
-    // Loop over all processes that apply to this track (based on particle
-    // type) and calculate cross section and particle range.
     real_type total_macro_xs = 0;
-    for (auto ppid : range(ParticleProcessId{physics.num_particle_processes()}))
+    if (auto grid_id = physics.general_xs_grid(particle.energy()))
     {
-        real_type process_xs = 0;
-        if (auto const& process = physics.integral_xs_process(ppid))
-        {
-            // If the integral approach is used and this particle has an energy
-            // loss process, estimate the maximum cross section over the step
-            process_xs = physics.calc_max_xs(
-                process, ppid, material.make_material_view(), particle.energy());
-        }
-        else
+        // Interpolate the combined cross section of all processes: the
+        // process is sampled from the tabulated fractions after the step
+        auto calc_xs = physics.make_calculator<XsCalculator>(grid_id);
+        total_macro_xs = calc_xs(particle.energy());
+    }
+    else
+    {
+        // Loop over all processes that apply to this track (based on
+        // particle type) and calculate cross section and particle range.
+        auto const num_processes = physics.num_particle_processes();
+        for (auto ppid : range(ParticleProcessId{num_processes}))
         {
-            // Calculate the macroscopic cross section for this process
-            process_xs = physics.calc_xs(
-                ppid, material.make_material_view(), particle.energy());
+            real_type process_xs = 0;
+            if (auto const& process = physics.integral_xs_process(ppid))
+            {
+                // If the integral approach is used and this particle has an
+                // energy loss process, estimate the maximum cross section
+                // over the step
+                process_xs = physics.calc_max_xs(process,
+                                                 ppid,
+                                                 material.make_material_view(),
+                                                 particle.energy());
+            }
+            else
+            {
+                // Calculate the macroscopic cross section for this process
+                process_xs = physics.calc_xs(
+                    ppid, material.make_material_view(), particle.energy());
+            }
+            // Accumulate process cross section into the total cross section
+            // and save it for later
+            total_macro_xs += process_xs;
+            pstep.per_process_xs(ppid) = process_xs;
         }
-        // Accumulate process cross section into the total cross section and
-        // save it for later
-        total_macro_xs += process_xs;
-        pstep.per_process_xs(ppid) = process_xs;
     }
     pstep.macro_xs(total_macro_xs);
     CELER_ASSERT(total_macro_xs > 0 || !particle.is_stopped());
@@ -269,11 +283,32 @@ select_discrete_interaction(MaterialView const& material,
     CELER_EXPECT(physics.interaction_mfp() <= 0);
     CELER_EXPECT(pstep.macro_xs() > 0);
 
-    // Sample ParticleProcessId from physics.per_process_xs()
-    ParticleProcessId ppid = celeritas::make_selector(
-        [&pstep](ParticleProcessId ppid) { return pstep.per_process_xs(ppid); },
-        ParticleProcessId{physics.num_particle_processes()},
-        pstep.macro_xs())(rng);
+    ParticleProcessId ppid;
+    if (physics.general_xs_grid(particle.energy()))
+    {
+        // Sample ParticleProcessId from the tabulated cumulative fractions of
+        // the total cross section
+        real_type xi = generate_canonical(rng);
+        ppid = ParticleProcessId{physics.num_particle_processes() - 1};
+        for (auto i : range(ppid))
+        {
+            if (xi < physics.calc_general_cdf(i, particle.energy()))
+            {
+                ppid = i;
+                break;
+            }
+        }
+    }
+    else
+    {
+        // Sample ParticleProcessId from physics.per_process_xs()
+        ppid = celeritas::make_selector(
+            [&pstep](ParticleProcessId ppid) {
+                return pstep.per_process_xs(ppid);
+            },
+            ParticleProcessId{physics.num_particle_processes()},
+            pstep.macro_xs())(rng);
+    }
 
     // Determine if the discrete interaction occurs for particles with energy
     // loss processes
@@ -87,6 +87,9 @@ class PhysicsStepView
     // Access local energy deposition
     inline CELER_FUNCTION Energy energy_deposition() const;
 
+    // Mutable access to secondaries (e.g., for variance reduction)
+    inline CELER_FUNCTION Span<Secondary> secondaries();
+
     // Access secondaries created by an interaction
     inline CELER_FUNCTION Span<Secondary const> secondaries() const;
 
@@ -252,6 +255,15 @@ CELER_FUNCTION auto PhysicsStepView::energy_deposition() const -> Energy
     return Energy{result};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Mutable access to secondaries created by a discrete interaction.
+ */
+CELER_FUNCTION Span<Secondary> PhysicsStepView::secondaries()
+{
+    return this->state().secondaries;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Access secondaries created by a discrete interaction.
@@ -119,6 +119,13 @@ class PhysicsTrackView
                                                 MaterialView const& material,
                                                 Energy energy) const;
 
+    // Get the total macro xs grid if the general process applies
+    inline CELER_FUNCTION ValueGridId general_xs_grid(Energy energy) const;
+
+    // Calculate the cumulative fraction of the total macro xs
+    inline CELER_FUNCTION real_type
+    calc_general_cdf(ParticleProcessId ppid, Energy energy) const;
+
     // Models that apply to the given process ID
     inline CELER_FUNCTION
         ModelFinder make_model_finder(ParticleProcessId) const;
@@ -498,6 +505,45 @@ CELER_FUNCTION ModelId PhysicsTrackView::hardwired_model(ParticleProcessId ppid,
     return {};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the total macro xs grid if the general process applies.
+ *
+ * The combined table of all processes is only constructed for photons when
+ * the general process option is enabled. It is not used below the lowest
+ * tabulated energy, where some cross sections are calculated on the fly.
+ */
+CELER_FUNCTION auto
+PhysicsTrackView::general_xs_grid(Energy energy) const -> ValueGridId
+{
+    ProcessGroup const& group = this->process_group();
+    if (!group.general_xs || energy < group.general_lower)
+    {
+        return {};
+    }
+    return this->value_grid(group.general_xs);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the cumulative fraction of the total macro xs.
+ *
+ * This is the probability of selecting any process up to and including the
+ * given one, and is only valid if \c general_xs_grid is present.
+ */
+CELER_FUNCTION real_type
+PhysicsTrackView::calc_general_cdf(ParticleProcessId ppid, Energy energy) const
+{
+    CELER_EXPECT(ppid < this->num_particle_processes());
+    ProcessGroup const& group = this->process_group();
+    CELER_EXPECT(group.general_xs);
+
+    auto grid_id = this->value_grid(group.general_cdf[ppid.get()]);
+    CELER_ASSERT(grid_id);
+    auto calc_cdf = this->make_calculator<XsCalculator>(grid_id);
+    return calc_cdf(energy);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Models that apply to the given process ID.
@@ -552,7 +598,7 @@ PhysicsTrackView::make_element_selector(ValueTableId table_id,
     return TabulatedElementSelector{table,
                                     params_.value_grids,
                                     params_.value_grid_ids,
-                                    params_.reals,
+                                    params_.table_values,
                                     energy};
 }
 
@@ -664,7 +710,7 @@ template<class T>
 CELER_FUNCTION T PhysicsTrackView::make_calculator(ValueGridId id) const
 {
     CELER_EXPECT(id < params_.value_grids.size());
-    return T{params_.value_grids[id], params_.reals};
+    return T{params_.value_grids[id], params_.table_values};
 }
 
 //---------------------------------------------------------------------------//
@@ -679,7 +725,7 @@ CELER_FUNCTION T PhysicsTrackView::make_calculator(ValueGridId id,
                                                    size_type order) const
 {
     CELER_EXPECT(id < params_.value_grids.size());
-    return T{params_.value_grids[id], params_.reals, order};
+    return T{params_.value_grids[id], params_.table_values, order};
 }
 
 //---------------------------------------------------------------------------//
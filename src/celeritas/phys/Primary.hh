@@ -28,6 +28,7 @@ struct Primary
     Real3 direction{0, 0, 0};
     real_type time{};
     EventId event_id;
+    real_type weight{1};
 };
 
 //---------------------------------------------------------------------------//
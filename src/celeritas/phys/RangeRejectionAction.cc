@@ -0,0 +1,127 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/RangeRejectionAction.cc
+//---------------------------------------------------------------------------//
+#include "RangeRejectionAction.hh"
+
+#include <utility>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/sys/ActionRegistry.hh"  // IWYU pragma: keep
+#include "celeritas/geo/GeoMaterialParams.hh"
+#include "celeritas/global/ActionLauncher.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+#include "celeritas/user/detail/StepGatherUtils.hh"
+
+#include "ParticleParams.hh"
+
+#include "detail/RangeRejectionExecutor.hh"  // IWYU pragma: associated
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct and add to core params.
+ */
+std::shared_ptr<RangeRejectionAction>
+RangeRejectionAction::make_and_insert(CoreParams const& core,
+                                      Input const& input)
+{
+    ActionRegistry& actions = *core.action_reg();
+    auto result = std::make_shared<RangeRejectionAction>(
+        actions.next_id(), *core.geomaterial(), *core.particle(), input);
+    detail::validate_before_step_gather(actions, result->label());
+    actions.insert(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with action ID, regions, particles, and options.
+ */
+RangeRejectionAction::RangeRejectionAction(ActionId id,
+                                           GeoMaterialParams const& geo_mat,
+                                           ParticleParams const& particles,
+                                           Input const& input)
+    : id_(id)
+{
+    CELER_EXPECT(id_);
+    CELER_VALIDATE(!input.regions.empty(),
+                   << "no regions for range rejection were specified");
+    CELER_VALIDATE(!input.particles.empty(),
+                   << "no particles for range rejection were specified");
+    CELER_VALIDATE(input.max_energy > zero_quantity(),
+                   << "invalid maximum range rejection energy "
+                   << input.max_energy.value());
+    auto const& regions = geo_mat.regions();
+    CELER_VALIDATE(regions.size() > 0,
+                   << "range rejection requires geometry regions, but none "
+                      "are defined");
+
+    auto const num_particles = particles.size();
+    std::vector<Energy> limits(regions.size() * num_particles, Energy{0});
+    for (auto const& name : input.regions)
+    {
+        RegionId region = regions.find_unique(name);
+        CELER_VALIDATE(region, << "no region named '" << name << "' exists");
+        for (PDGNumber pdg : input.particles)
+        {
+            ParticleId pid = particles.find(pdg);
+            CELER_VALIDATE(pid,
+                           << "particle with PDG " << pdg.get()
+                           << " for range rejection is not defined");
+            limits[region.get() * num_particles + pid.get()]
+                = input.max_energy;
+        }
+    }
+
+    HostVal<RangeRejectionParamsData> host_data;
+    make_builder(&host_data.max_energy)
+        .insert_back(limits.begin(), limits.end());
+    host_data.num_regions = regions.size();
+    host_data.num_particles = num_particles;
+
+    data_ = CollectionMirror<RangeRejectionParamsData>{std::move(host_data)};
+    CELER_ENSURE(data_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a long description of the action.
+ */
+std::string_view RangeRejectionAction::description() const
+{
+    return "kill charged tracks that cannot leave their volume";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the range rejection with host data.
+ */
+void RangeRejectionAction::step(CoreParams const& params,
+                                CoreStateHost& state) const
+{
+    auto execute = make_active_track_executor(
+        params.ptr<MemSpace::native>(),
+        state.ptr(),
+        detail::RangeRejectionExecutor{this->host_ref()});
+    launch_action(*this, params, state, execute);
+}
+
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+void RangeRejectionAction::step(CoreParams const&, CoreStateDevice&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,113 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/RangeRejectionAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "corecel/data/CollectionMirror.hh"
+#include "corecel/data/ParamsDataInterface.hh"
+#include "corecel/math/NumericLimits.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/global/ActionInterface.hh"
+
+#include "PDGNumber.hh"
+#include "RangeRejectionData.hh"
+
+namespace celeritas
+{
+class GeoMaterialParams;
+class ParticleParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Kill charged tracks whose residual range is less than the safety distance.
+ *
+ * In selected regions, a charged track that cannot physically reach the
+ * boundary of its current volume is killed at the end of the step and its
+ * energy is deposited locally. This removes the many small steps of
+ * low-energy electrons deep inside dense, non-sensitive absorbers. The
+ * residual range is calculated from the tabulated range at the post-step
+ * energy, so the check is conservative with respect to multiple scattering:
+ * the straight-line distance traveled is always less than the path length.
+ *
+ * The rejection is only applied below an energy limit to avoid calculating the
+ * safety distance for energetic tracks that are unlikely to be rejected, and
+ * by default only for electrons, since annihilation photons from a killed
+ * positron would escape the volume.
+ *
+ * To score the deposited energy, this action must be created before any step
+ * collector. Rejection only applies inside a volume, so it should not be
+ * enabled for regions with sensitive volumes that score only part of the
+ * track.
+ */
+class RangeRejectionAction final
+    : public CoreStepActionInterface,
+      public ParamsDataInterface<RangeRejectionParamsData>
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Energy = units::MevEnergy;
+    //!@}
+
+    //! Regions and particle types to reject
+    struct Input
+    {
+        //! Names of regions in which rejection is enabled
+        std::vector<std::string> regions;
+        //! Particle types to reject
+        std::vector<PDGNumber> particles{pdg::electron()};
+        //! Only reject tracks below this energy
+        Energy max_energy{numeric_limits<real_type>::infinity()};
+    };
+
+  public:
+    // Construct and add to core params
+    static std::shared_ptr<RangeRejectionAction>
+    make_and_insert(CoreParams const& core, Input const& input);
+
+    // Construct with action ID, regions, particles, and options
+    RangeRejectionAction(ActionId id,
+                         GeoMaterialParams const& geo_mat,
+                         ParticleParams const& particles,
+                         Input const& input);
+
+    //!@{
+    //! \name Action interface
+    //! ID of the action
+    ActionId action_id() const final { return id_; }
+    //! Short name for the action
+    std::string_view label() const final { return "range-rejection"; }
+    // Description of the action for user interaction
+    std::string_view description() const final;
+    //! Dependency ordering of the action
+    StepActionOrder order() const final { return StepActionOrder::user_post; }
+    //!@}
+
+    //!@{
+    //! \name StepAction interface
+    // Launch kernel with host data
+    void step(CoreParams const&, CoreStateHost&) const final;
+    // Launch kernel with device data
+    void step(CoreParams const&, CoreStateDevice&) const final;
+    //!@}
+
+    //! Access data on the host
+    HostRef const& host_ref() const final { return data_.host_ref(); }
+    //! Access data on the device
+    DeviceRef const& device_ref() const final { return data_.device_ref(); }
+
+  private:
+    ActionId id_;
+    CollectionMirror<RangeRejectionParamsData> data_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
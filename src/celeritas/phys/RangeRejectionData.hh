@@ -0,0 +1,66 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/RangeRejectionData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/data/Collection.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Energy limits for range rejection as a function of region and particle.
+ *
+ * The limits are stored as a flattened [region][particle] array over all
+ * regions and particle types in the problem. Tracks with kinetic energy at or
+ * above the limit are never rejected, so a zero limit disables rejection.
+ */
+template<Ownership W, MemSpace M>
+struct RangeRejectionParamsData
+{
+    //// TYPES ////
+
+    template<class T>
+    using Items = Collection<T, W, M>;
+
+    //// DATA ////
+
+    //! Maximum energy for rejection for each [region][particle]
+    Items<units::MevEnergy> max_energy;
+    //! Number of regions
+    RegionId::size_type num_regions{0};
+    //! Number of particle types
+    ParticleId::size_type num_particles{0};
+
+    //// METHODS ////
+
+    //! Whether the data are assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return num_regions > 0 && num_particles > 0
+               && max_energy.size() == num_regions * num_particles;
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    RangeRejectionParamsData&
+    operator=(RangeRejectionParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        max_energy = other.max_energy;
+        num_regions = other.num_regions;
+        num_particles = other.num_particles;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
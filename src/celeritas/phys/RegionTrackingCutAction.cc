@@ -0,0 +1,154 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/RegionTrackingCutAction.cc
+//---------------------------------------------------------------------------//
+#include "RegionTrackingCutAction.hh"
+
+#include <utility>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/sys/ActionRegistry.hh"  // IWYU pragma: keep
+#include "celeritas/geo/GeoMaterialParams.hh"
+#include "celeritas/global/ActionLauncher.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+#include "celeritas/user/detail/StepGatherUtils.hh"
+
+#include "ParticleParams.hh"
+
+#include "detail/RegionTrackingCutExecutor.hh"  // IWYU pragma: associated
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct and add to core params.
+ */
+std::shared_ptr<RegionTrackingCutAction>
+RegionTrackingCutAction::make_and_insert(CoreParams const& core,
+                                         Input const& input)
+{
+    ActionRegistry& actions = *core.action_reg();
+    auto result = std::make_shared<RegionTrackingCutAction>(
+        actions.next_id(), *core.geomaterial(), *core.particle(), input);
+    detail::validate_before_step_gather(actions, result->label());
+    actions.insert(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with action ID, regions, particles, and cuts.
+ */
+RegionTrackingCutAction::RegionTrackingCutAction(
+    ActionId id,
+    GeoMaterialParams const& geo_mat,
+    ParticleParams const& particles,
+    Input const& input)
+    : id_(id)
+{
+    CELER_EXPECT(id_);
+    CELER_VALIDATE(input,
+                   << "no regions or volumes with tracking cuts were "
+                      "specified");
+
+    HostVal<RegionTrackingCutParamsData> host_data;
+    if (!input.regions.empty())
+    {
+        auto const& regions = geo_mat.regions();
+        CELER_VALIDATE(regions.size() > 0,
+                       << "region tracking cuts require geometry regions, but "
+                          "none are defined");
+
+        auto const num_particles = particles.size();
+        std::vector<TrackingCutLimits> cuts(regions.size() * num_particles);
+        for (auto const& [name, pdg_cuts] : input.regions)
+        {
+            RegionId region = regions.find_unique(name);
+            CELER_VALIDATE(region,
+                           << "no region named '" << name << "' exists");
+            for (auto const& [pdg, limits] : pdg_cuts)
+            {
+                ParticleId pid = particles.find(pdg);
+                CELER_VALIDATE(pid,
+                               << "particle with PDG " << pdg.get()
+                               << " in tracking cuts for region '" << name
+                               << "' is not defined");
+                CELER_VALIDATE(limits,
+                               << "invalid tracking cut (min energy "
+                               << limits.min_energy.value() << ", max time "
+                               << limits.max_time << ") for particle "
+                               << particles.id_to_label(pid) << " in region '"
+                               << name << "'");
+                cuts[region.get() * num_particles + pid.get()] = limits;
+            }
+        }
+        make_builder(&host_data.region_cuts)
+            .insert_back(cuts.begin(), cuts.end());
+        host_data.num_regions = regions.size();
+        host_data.num_particles = num_particles;
+    }
+
+    if (!input.volumes.empty())
+    {
+        std::vector<TrackingCutLimits> cuts(geo_mat.num_volumes());
+        for (auto const& [vol_id, limits] : input.volumes)
+        {
+            CELER_VALIDATE(vol_id < geo_mat.num_volumes(),
+                           << "invalid volume ID " << vol_id.unchecked_get()
+                           << " in tracking cuts");
+            CELER_VALIDATE(limits,
+                           << "invalid tracking cut (min energy "
+                           << limits.min_energy.value() << ", max time "
+                           << limits.max_time << ") for volume "
+                           << vol_id.get());
+            cuts[vol_id.get()] = limits;
+        }
+        make_builder(&host_data.volume_cuts)
+            .insert_back(cuts.begin(), cuts.end());
+    }
+
+    data_ = CollectionMirror<RegionTrackingCutParamsData>{std::move(host_data)};
+    CELER_ENSURE(data_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a long description of the action.
+ */
+std::string_view RegionTrackingCutAction::description() const
+{
+    return "kill tracks that violate the tracking cuts of their region or "
+           "volume";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the tracking cut with host data.
+ */
+void RegionTrackingCutAction::step(CoreParams const& params,
+                                   CoreStateHost& state) const
+{
+    auto execute = make_active_track_executor(
+        params.ptr<MemSpace::native>(),
+        state.ptr(),
+        detail::RegionTrackingCutExecutor{this->host_ref()});
+    launch_action(*this, params, state, execute);
+}
+
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+void RegionTrackingCutAction::step(CoreParams const&, CoreStateDevice&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,35 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/RegionTrackingCutAction.cu
+//---------------------------------------------------------------------------//
+#include "RegionTrackingCutAction.hh"
+
+#include "celeritas/global/ActionLauncher.device.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+
+#include "detail/RegionTrackingCutExecutor.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the tracking cut with device data.
+ */
+void RegionTrackingCutAction::step(CoreParams const& params,
+                                   CoreStateDevice& state) const
+{
+    auto execute = make_active_track_executor(
+        params.ptr<MemSpace::native>(),
+        state.ptr(),
+        detail::RegionTrackingCutExecutor{this->device_ref()});
+    static ActionLauncher<decltype(execute)> const launch_kernel(*this);
+    launch_kernel(state, execute);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
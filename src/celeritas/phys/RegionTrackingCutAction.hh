@@ -0,0 +1,113 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/RegionTrackingCutAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "corecel/data/CollectionMirror.hh"
+#include "corecel/data/ParamsDataInterface.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/global/ActionInterface.hh"
+
+#include "PDGNumber.hh"
+#include "RegionTrackingCutData.hh"
+
+namespace celeritas
+{
+class GeoMaterialParams;
+class ParticleParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Kill tracks whose kinetic energy or time violates a region or volume cut.
+ *
+ * This is equivalent to the Geant4 minimum kinetic energy and maximum time
+ * user limits (\c G4UserSpecialCuts ): at the end of each step, a track
+ * below the minimum energy or past the maximum lab-frame time of its volume,
+ * or of its region for its particle type, is killed and its energy is
+ * deposited locally. This allows expensive low-energy particles to be
+ * discarded in passive regions such as absorbers and support structures while
+ * keeping full precision in active layers.
+ *
+ * Regions are taken from the geometry/material mapping, and are imported with
+ * the volumes from Geant4. Production cuts are region-dependent through the
+ * material cuts couples (\c MaterialId). Per-volume cuts are created from the
+ * user limits by \c UserLimitsParams::make_and_insert , so only one set of
+ * tracking cuts can be defined: region cuts must be added to the same input.
+ *
+ * To score the deposited energy, this action must be created before any step
+ * collector.
+ */
+class RegionTrackingCutAction final
+    : public CoreStepActionInterface,
+      public ParamsDataInterface<RegionTrackingCutParamsData>
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using MapPdgLimits = std::map<PDGNumber, TrackingCutLimits>;
+    //!@}
+
+    //! Tracking cuts for particle types in each named region, and volumes
+    struct Input
+    {
+        std::map<std::string, MapPdgLimits> regions;
+        std::map<VolumeId, TrackingCutLimits> volumes;
+
+        //! Whether any cuts are specified
+        explicit operator bool() const
+        {
+            return !regions.empty() || !volumes.empty();
+        }
+    };
+
+  public:
+    // Construct and add to core params
+    static std::shared_ptr<RegionTrackingCutAction>
+    make_and_insert(CoreParams const& core, Input const& input);
+
+    // Construct with action ID, regions, particles, and cuts
+    RegionTrackingCutAction(ActionId id,
+                            GeoMaterialParams const& geo_mat,
+                            ParticleParams const& particles,
+                            Input const& input);
+
+    //!@{
+    //! \name Action interface
+    //! ID of the action
+    ActionId action_id() const final { return id_; }
+    //! Short name for the action
+    std::string_view label() const final { return "region-tracking-cut"; }
+    // Description of the action for user interaction
+    std::string_view description() const final;
+    //! Dependency ordering of the action
+    StepActionOrder order() const final { return StepActionOrder::user_post; }
+    //!@}
+
+    //!@{
+    //! \name StepAction interface
+    // Launch kernel with host data
+    void step(CoreParams const&, CoreStateHost&) const final;
+    // Launch kernel with device data
+    void step(CoreParams const&, CoreStateDevice&) const final;
+    //!@}
+
+    //! Access data on the host
+    HostRef const& host_ref() const final { return data_.host_ref(); }
+    //! Access data on the device
+    DeviceRef const& device_ref() const final { return data_.device_ref(); }
+
+  private:
+    ActionId id_;
+    CollectionMirror<RegionTrackingCutParamsData> data_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,98 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/RegionTrackingCutData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/math/NumericLimits.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Minimum kinetic energy and maximum lab-frame time for a track.
+ *
+ * The default values do not cut the track.
+ */
+struct TrackingCutLimits
+{
+    //! Minimum kinetic energy
+    units::MevEnergy min_energy{0};
+    //! Maximum lab-frame time [time]
+    real_type max_time{numeric_limits<real_type>::infinity()};
+
+    //! Whether a time or energy cut is applied
+    CELER_FUNCTION bool has_cuts() const
+    {
+        return max_time != numeric_limits<real_type>::infinity()
+               || min_energy > zero_quantity();
+    }
+
+    //! Whether the limits are valid
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return max_time > 0 && min_energy >= zero_quantity();
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tracking cuts as a function of region and particle type, and of volume.
+ *
+ * The region cuts are stored as a flattened [region][particle] array over all
+ * regions and particle types in the problem, and the volume cuts (from
+ * per-volume user limits) apply to all particle types. Either may be empty.
+ */
+template<Ownership W, MemSpace M>
+struct RegionTrackingCutParamsData
+{
+    //// TYPES ////
+
+    template<class T>
+    using Items = Collection<T, W, M>;
+
+    //// DATA ////
+
+    //! Tracking cuts for each [region][particle]
+    Items<TrackingCutLimits> region_cuts;
+    //! Number of regions
+    RegionId::size_type num_regions{0};
+    //! Number of particle types
+    ParticleId::size_type num_particles{0};
+
+    //! Tracking cuts for each volume
+    Collection<TrackingCutLimits, W, M, VolumeId> volume_cuts;
+
+    //// METHODS ////
+
+    //! Whether the data are assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return region_cuts.size() == num_regions * num_particles
+               && !(region_cuts.empty() && volume_cuts.empty());
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    RegionTrackingCutParamsData&
+    operator=(RegionTrackingCutParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        region_cuts = other.region_cuts;
+        num_regions = other.num_regions;
+        num_particles = other.num_particles;
+        volume_cuts = other.volume_cuts;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
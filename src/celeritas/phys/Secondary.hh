@@ -18,13 +18,16 @@ namespace celeritas
  * New particle created via an Interaction.
  *
  * It will be converted into a "track initializer" using the parent track's
- * information.
+ * information. The statistical weight is only set if variance reduction
+ * changes the weight of the parent after the interaction: otherwise it's zero
+ * and the secondary inherits the parent's weight.
  */
 struct Secondary
 {
     ParticleId particle_id;  //!< New particle type
     units::MevEnergy energy;  //!< New kinetic energy
     Real3 direction;  //!< New direction
+    real_type weight{0};  //!< Statistical weight, if different from parent
 
     //! Whether the secondary survived cutoffs
     explicit CELER_FUNCTION operator bool() const
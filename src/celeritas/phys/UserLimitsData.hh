@@ -0,0 +1,91 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/UserLimitsData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/math/NumericLimits.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Step limit and tracking cuts for a single volume.
+ *
+ * The default values do not limit the track.
+ */
+struct VolumeUserLimits
+{
+    //! Maximum step length for charged particles [len]
+    real_type max_step{numeric_limits<real_type>::infinity()};
+    //! Maximum lab-frame time [time]
+    real_type max_time{numeric_limits<real_type>::infinity()};
+    //! Minimum kinetic energy
+    units::MevEnergy min_energy{0};
+
+    //! Whether the step length is limited
+    CELER_FUNCTION bool has_step_limit() const
+    {
+        return max_step != numeric_limits<real_type>::infinity();
+    }
+
+    //! Whether a time or energy cut is applied
+    CELER_FUNCTION bool has_cuts() const
+    {
+        return max_time != numeric_limits<real_type>::infinity()
+               || min_energy > zero_quantity();
+    }
+
+    //! Whether the limits are valid
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return max_step > 0 && max_time > 0 && min_energy >= zero_quantity();
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Per-volume step limits and tracking cuts.
+ *
+ * The limits are stored for every volume in the geometry. Steps limited by
+ * the maximum step length are labeled with an implicit action.
+ */
+template<Ownership W, MemSpace M>
+struct UserLimitsParamsData
+{
+    //// DATA ////
+
+    //! Limits for each volume
+    Collection<VolumeUserLimits, W, M, VolumeId> volumes;
+    //! Post-step action for the maximum step length
+    ActionId step_limit_action;
+
+    //// METHODS ////
+
+    //! Whether the data are assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !volumes.empty() && step_limit_action;
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    UserLimitsParamsData& operator=(UserLimitsParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        volumes = other.volumes;
+        step_limit_action = other.step_limit_action;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,215 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/UserLimitsParams.cc
+//---------------------------------------------------------------------------//
+#include "UserLimitsParams.hh"
+
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/io/Join.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/sys/ActionRegistry.hh"
+#include "geocel/GeoParamsInterface.hh"
+#include "celeritas/geo/GeoParams.hh"  // IWYU pragma: keep
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/io/ImportData.hh"
+
+#include "RegionTrackingCutAction.hh"
+#include "UserStepLimitAction.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+class ImplicitUserLimitsAction final : public StaticConcreteAction
+{
+  public:
+    // Construct with ID and label
+    using StaticConcreteAction::StaticConcreteAction;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from the user limits of imported volumes.
+ *
+ * Imported limits use zero to denote an unset value.
+ */
+auto UserLimitsParams::Input::from_import(ImportData const& data) -> Input
+{
+    Input result;
+    for (ImportVolume const& volume : data.volumes)
+    {
+        if (!volume || !volume.user_limits)
+        {
+            continue;
+        }
+
+        ImportUserLimits const& imported = volume.user_limits;
+        VolumeUserLimits limits;
+        if (imported.max_step > 0)
+        {
+            limits.max_step = imported.max_step;
+        }
+        if (imported.max_time > 0)
+        {
+            limits.max_time = imported.max_time;
+        }
+        limits.min_energy = units::MevEnergy(imported.min_energy);
+        result.volumes.emplace(Label::from_geant(volume.name), limits);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct params and add the required actions to core params.
+ */
+std::shared_ptr<UserLimitsParams>
+UserLimitsParams::make_and_insert(CoreParams const& core, Input const& input)
+{
+    ActionRegistry& actions = *core.action_reg();
+
+    // Validate the input before adding the implicit step limit action
+    ActionId const step_limit_id = actions.next_id();
+    auto result = std::make_shared<UserLimitsParams>(
+        *core.geometry(), step_limit_id, input);
+    actions.insert(std::make_shared<ImplicitUserLimitsAction>(
+        step_limit_id,
+        "user-max-step",
+        "maximum step length from per-volume user limits"));
+
+    if (result->has_step_limit())
+    {
+        actions.insert(std::make_shared<UserStepLimitAction>(
+            actions.next_id(), result));
+    }
+    if (result->has_cuts())
+    {
+        // Apply the energy and time cuts with the region tracking cuts
+        RegionTrackingCutAction::Input cut_input;
+        auto const& volumes = result->host_ref().volumes;
+        for (auto vol_id : range(VolumeId{volumes.size()}))
+        {
+            VolumeUserLimits const& limits = volumes[vol_id];
+            if (limits.has_cuts())
+            {
+                cut_input.volumes[vol_id] = {limits.min_energy,
+                                             limits.max_time};
+            }
+        }
+        RegionTrackingCutAction::make_and_insert(core, cut_input);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from geometry and per-volume limits.
+ */
+UserLimitsParams::UserLimitsParams(GeoParams const& geo,
+                                   ActionId step_limit_action,
+                                   Input const& input)
+{
+    CELER_EXPECT(step_limit_action);
+    CELER_VALIDATE(input, << "no volumes with user limits were specified");
+
+    // Map volume names to input labels, or null if the name is duplicated
+    std::map<std::string, Label const*> name_to_label;
+    for (auto const& [label, limits] : input.volumes)
+    {
+        CELER_VALIDATE(limits,
+                       << "invalid user limits for volume '" << label
+                       << "': max step " << limits.max_step << ", max time "
+                       << limits.max_time << ", min energy "
+                       << limits.min_energy.value());
+        auto [iter, inserted] = name_to_label.insert({label.name, &label});
+        if (!inserted)
+        {
+            iter->second = nullptr;
+        }
+    }
+
+    auto const& volumes = geo.volumes();
+    std::vector<VolumeUserLimits> limits(volumes.size());
+    std::set<Label const*> used;
+    std::set<std::string> ambiguous;
+    for (auto vol_id : range(VolumeId{volumes.size()}))
+    {
+        Label const& vol_label = volumes.at(vol_id);
+        VolumeUserLimits& vol_limits = limits[vol_id.get()];
+        Label const* found = nullptr;
+        if (auto iter = input.volumes.find(vol_label);
+            iter != input.volumes.end())
+        {
+            // Labels match exactly
+            found = &iter->first;
+        }
+        else if (auto iter = name_to_label.find(vol_label.name);
+                 iter != name_to_label.end())
+        {
+            // Extensions differ, e.g. Geant4 pointers and ORANGE universes:
+            // fall back to the name only if it is unique on both sides
+            if (iter->second && volumes.find_all(vol_label.name).size() == 1)
+            {
+                found = iter->second;
+            }
+            else
+            {
+                ambiguous.insert(vol_label.name);
+            }
+        }
+        if (found)
+        {
+            vol_limits = input.volumes.at(*found);
+            used.insert(found);
+        }
+        has_step_limit_ = has_step_limit_ || vol_limits.has_step_limit();
+        has_cuts_ = has_cuts_ || vol_limits.has_cuts();
+    }
+
+    if (!ambiguous.empty())
+    {
+        CELER_LOG(warning) << "Ignoring user limits for volume names that "
+                              "occur more than once without an exact label "
+                              "match: "
+                           << join(ambiguous.begin(), ambiguous.end(), ", ");
+    }
+    if (used.size() != input.volumes.size())
+    {
+        std::vector<Label> missing;
+        for (auto const& label_limits : input.volumes)
+        {
+            if (!used.count(&label_limits.first))
+            {
+                missing.push_back(label_limits.first);
+            }
+        }
+        CELER_LOG(warning) << "Ignoring user limits for volumes that are not "
+                              "in the geometry: "
+                           << join(missing.begin(), missing.end(), ", ");
+    }
+
+    HostVal<UserLimitsParamsData> host_data;
+    make_builder(&host_data.volumes).insert_back(limits.begin(), limits.end());
+    host_data.step_limit_action = step_limit_action;
+
+    data_ = CollectionMirror<UserLimitsParamsData>{std::move(host_data)};
+    CELER_ENSURE(data_);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
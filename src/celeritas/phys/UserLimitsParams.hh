@@ -0,0 +1,86 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/UserLimitsParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <map>
+#include <memory>
+
+#include "corecel/data/CollectionMirror.hh"
+#include "corecel/data/ParamsDataInterface.hh"
+#include "corecel/io/Label.hh"
+#include "celeritas/geo/GeoFwd.hh"
+
+#include "UserLimitsData.hh"
+
+namespace celeritas
+{
+class CoreParams;
+struct ImportData;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Per-volume step limits and tracking cuts.
+ *
+ * This is the equivalent of the Geant4 \c G4UserLimits attached to logical
+ * volumes, as used by \c G4StepLimiter and \c G4UserSpecialCuts :
+ * - The maximum step length applies to charged particles (the default for \c
+ *   G4StepLimiterPhysics ) and is applied after the physics step limits are
+ *   calculated in the pre-step (see \c UserStepLimitAction ).
+ * - The minimum kinetic energy and maximum lab-frame time apply to all
+ *   particles and are checked at the end of each step against the volume the
+ *   track is in (see \c RegionTrackingCutAction ). Killed tracks deposit
+ *   their energy locally.
+ *
+ * Volumes are matched to the geometry by label. If no label matches exactly,
+ * the extension (e.g., a Geant4 pointer address) is ignored so that the limits
+ * apply to all volumes with the same name.
+ */
+class UserLimitsParams final : public ParamsDataInterface<UserLimitsParamsData>
+{
+  public:
+    //! Limits for each volume name
+    struct Input
+    {
+        std::map<Label, VolumeUserLimits> volumes;
+
+        // Construct from the user limits of imported volumes
+        static Input from_import(ImportData const& data);
+
+        //! Whether any limits are specified
+        explicit operator bool() const { return !volumes.empty(); }
+    };
+
+  public:
+    // Construct params and add the required actions to core params
+    static std::shared_ptr<UserLimitsParams>
+    make_and_insert(CoreParams const& core, Input const& input);
+
+    // Construct from geometry and per-volume limits
+    UserLimitsParams(GeoParams const& geo,
+                     ActionId step_limit_action,
+                     Input const& input);
+
+    //! Whether any volume has a maximum step length
+    bool has_step_limit() const { return has_step_limit_; }
+
+    //! Whether any volume has a time or energy cut
+    bool has_cuts() const { return has_cuts_; }
+
+    //! Access data on the host
+    HostRef const& host_ref() const final { return data_.host_ref(); }
+    //! Access data on the device
+    DeviceRef const& device_ref() const final { return data_.device_ref(); }
+
+  private:
+    CollectionMirror<UserLimitsParamsData> data_;
+    bool has_step_limit_{false};
+    bool has_cuts_{false};
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
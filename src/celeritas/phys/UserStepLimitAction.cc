@@ -0,0 +1,67 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/UserStepLimitAction.cc
+//---------------------------------------------------------------------------//
+#include "UserStepLimitAction.hh"
+
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "celeritas/global/ActionLauncher.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+
+#include "UserLimitsParams.hh"
+
+#include "detail/UserStepLimitExecutor.hh"  // IWYU pragma: associated
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with action ID and per-volume limits.
+ */
+UserStepLimitAction::UserStepLimitAction(ActionId id, SPConstUserLimits limits)
+    : id_(id), limits_(std::move(limits))
+{
+    CELER_EXPECT(id_);
+    CELER_EXPECT(limits_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a long description of the action.
+ */
+std::string_view UserStepLimitAction::description() const
+{
+    return "apply the maximum step length of the current volume";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the step limiter with host data.
+ */
+void UserStepLimitAction::step(CoreParams const& params,
+                               CoreStateHost& state) const
+{
+    auto execute = make_active_track_executor(
+        params.ptr<MemSpace::native>(),
+        state.ptr(),
+        detail::UserStepLimitExecutor{limits_->host_ref()});
+    launch_action(*this, params, state, execute);
+}
+
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+void UserStepLimitAction::step(CoreParams const&, CoreStateDevice&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
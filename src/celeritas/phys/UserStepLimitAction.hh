@@ -0,0 +1,65 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/UserStepLimitAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+
+#include "celeritas/global/ActionInterface.hh"
+
+namespace celeritas
+{
+class UserLimitsParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Limit the step length of charged particles in selected volumes.
+ *
+ * This runs after the pre-step, which calculates the physics step limits, and
+ * reduces the step to the maximum step length of the current volume. A step
+ * limited this way is labeled with the implicit "user-max-step" action. This
+ * action is created by \c UserLimitsParams::make_and_insert .
+ */
+class UserStepLimitAction final : public CoreStepActionInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstUserLimits = std::shared_ptr<UserLimitsParams const>;
+    //!@}
+
+  public:
+    // Construct with action ID and per-volume limits
+    UserStepLimitAction(ActionId id, SPConstUserLimits limits);
+
+    //!@{
+    //! \name Action interface
+    //! ID of the action
+    ActionId action_id() const final { return id_; }
+    //! Short name for the action
+    std::string_view label() const final { return "user-step-limit"; }
+    // Description of the action for user interaction
+    std::string_view description() const final;
+    //! Dependency ordering of the action
+    StepActionOrder order() const final { return StepActionOrder::user_pre; }
+    //!@}
+
+    //!@{
+    //! \name StepAction interface
+    // Launch kernel with host data
+    void step(CoreParams const&, CoreStateHost&) const final;
+    // Launch kernel with device data
+    void step(CoreParams const&, CoreStateDevice&) const final;
+    //!@}
+
+  private:
+    ActionId id_;
+    SPConstUserLimits limits_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
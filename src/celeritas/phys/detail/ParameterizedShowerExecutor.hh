@@ -0,0 +1,127 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/detail/ParameterizedShowerExecutor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/user/MeshCaloData.hh"
+#include "celeritas/user/MeshCaloDepositor.hh"
+
+#include "RegionParticleLookup.hh"
+#include "ShowerSpotSampler.hh"
+#include "TrackingCutExecutor.hh"
+#include "../ParameterizedShowerData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Replace electromagnetic tracks with a parameterized shower.
+ *
+ * Only tracks whose step ended inside a volume (rather than on its boundary)
+ * are candidates, so the whole step was in the volume and the shower starts
+ * at the post-step point. If a mesh is provided, the shower energy is divided
+ * among spots scored directly on the mesh; otherwise it is deposited locally
+ * by the ordinary tracking cut.
+ */
+struct ParameterizedShowerExecutor
+{
+    NativeCRef<ParameterizedShowerParamsData> params;
+    NativeCRef<MeshCaloParamsData> mesh_params;
+    NativeRef<MeshCaloStateData> mesh_state;
+
+    inline CELER_FUNCTION void operator()(celeritas::CoreTrackView& track);
+};
+
+//---------------------------------------------------------------------------//
+CELER_FUNCTION void
+ParameterizedShowerExecutor::operator()(celeritas::CoreTrackView& track)
+{
+    using Energy = units::MevEnergy;
+
+    auto sim = track.make_sim_view();
+    if (sim.status() != TrackStatus::alive)
+    {
+        return;
+    }
+
+    auto geo = track.make_geo_view();
+    if (geo.is_outside() || geo.is_on_boundary())
+    {
+        return;
+    }
+
+    auto min_id = find_region_particle<Energy>(
+        track, params.num_regions, params.num_particles);
+    if (!min_id)
+    {
+        return;
+    }
+
+    auto particle = track.make_particle_view();
+    Energy const min_energy = params.min_energy[min_id];
+    if (min_energy == zero_quantity() || particle.energy() < min_energy
+        || particle.energy() >= params.max_energy)
+    {
+        return;
+    }
+
+    auto mat_id = track.make_material_view().material_id();
+    ShowerMaterial const& material = params.materials[mat_id];
+    if (!material)
+    {
+        return;
+    }
+
+    if (!mesh_params)
+    {
+        TrackingCutExecutor{}(track);
+        return;
+    }
+
+    // Shower energy includes annihilation of a positron
+    real_type energy = value_as<Energy>(particle.energy());
+    if (particle.is_antiparticle())
+    {
+        energy += 2 * value_as<units::MevMass>(particle.mass());
+    }
+
+    ShowerSpotSampler sample_spot{params.profile,
+                                  material,
+                                  Energy{energy},
+                                  particle.charge() == zero_quantity(),
+                                  params.max_spots};
+    real_type const spot_energy = energy / sample_spot.num_spots();
+    MeshCaloDepositor deposit{mesh_params, mesh_state};
+    auto rng = track.make_rng_engine();
+    for (size_type i = 0; i < sample_spot.num_spots(); ++i)
+    {
+        Real3 pos = geo.pos();
+        Real3 offset = sample_spot(rng);
+        real_type dist = norm(offset);
+        if (dist > 0)
+        {
+            // Rotate from the shower frame
+            offset = rotate(make_unit_vector(offset), geo.dir());
+            axpy(dist, offset, &pos);
+        }
+        deposit(pos, spot_energy);
+    }
+
+    particle.subtract_energy(particle.energy());
+    sim.status(TrackStatus::killed);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
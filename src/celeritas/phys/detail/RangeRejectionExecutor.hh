@@ -0,0 +1,85 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/detail/RangeRejectionExecutor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/grid/RangeCalculator.hh"
+
+#include "RegionParticleLookup.hh"
+#include "TrackingCutExecutor.hh"
+#include "../RangeRejectionData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Kill tracks that cannot leave their current volume.
+ *
+ * The residual range is calculated from the post-step energy, and the safety
+ * distance is only calculated if the track is a candidate for rejection. The
+ * energy is deposited locally by the ordinary tracking cut.
+ */
+struct RangeRejectionExecutor
+{
+    NativeCRef<RangeRejectionParamsData> params;
+
+    inline CELER_FUNCTION void operator()(celeritas::CoreTrackView& track);
+};
+
+//---------------------------------------------------------------------------//
+CELER_FUNCTION void
+RangeRejectionExecutor::operator()(celeritas::CoreTrackView& track)
+{
+    if (track.make_sim_view().status() != TrackStatus::alive)
+    {
+        return;
+    }
+
+    auto geo = track.make_geo_view();
+    if (geo.is_outside() || geo.is_on_boundary())
+    {
+        return;
+    }
+
+    auto limit_id = find_region_particle<units::MevEnergy>(
+        track, params.num_regions, params.num_particles);
+    auto particle = track.make_particle_view();
+    if (!limit_id || !(particle.energy() < params.max_energy[limit_id]))
+    {
+        return;
+    }
+
+    auto phys = track.make_physics_view();
+    auto grid_id = phys.range_grid();
+    if (!grid_id)
+    {
+        // No energy loss in this material
+        return;
+    }
+    auto calc_range = phys.make_calculator<RangeCalculator>(grid_id);
+    real_type range = calc_range(particle.energy());
+    if (!(range > 0))
+    {
+        return;
+    }
+
+    // The safety is only needed up to the residual range
+    if (geo.find_safety(range) >= range)
+    {
+        TrackingCutExecutor{}(track);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
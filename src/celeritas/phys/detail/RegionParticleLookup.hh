@@ -0,0 +1,61 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/detail/RegionParticleLookup.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/data/Collection.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/global/CoreTrackView.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Find the [region][particle] item for a track.
+ *
+ * Region-dependent user actions store their per-particle values as a
+ * flattened array over all regions and particle types. The result is null if
+ * there are no regions, the track is outside the geometry, or its volume is
+ * not in a region.
+ */
+template<class T>
+inline CELER_FUNCTION ItemId<T>
+find_region_particle(CoreTrackView const& track,
+                     RegionId::size_type num_regions,
+                     ParticleId::size_type num_particles)
+{
+    if (num_regions == 0)
+    {
+        return {};
+    }
+
+    auto geo = track.make_geo_view();
+    if (geo.is_outside())
+    {
+        return {};
+    }
+
+    RegionId region
+        = track.make_geo_material_view().region_id(geo.volume_id());
+    if (!region)
+    {
+        return {};
+    }
+    CELER_ASSERT(region < num_regions);
+
+    ParticleId particle = track.make_particle_view().particle_id();
+    CELER_ASSERT(particle < num_particles);
+    return ItemId<T>{region.get() * num_particles + particle.get()};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,79 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/detail/RegionTrackingCutExecutor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/global/CoreTrackView.hh"
+
+#include "RegionParticleLookup.hh"
+#include "TrackingCutExecutor.hh"
+#include "../RegionTrackingCutData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Kill tracks that violate the cuts of their current volume or region.
+ *
+ * The energy is deposited locally by the ordinary tracking cut.
+ */
+struct RegionTrackingCutExecutor
+{
+    NativeCRef<RegionTrackingCutParamsData> params;
+
+    inline CELER_FUNCTION void operator()(celeritas::CoreTrackView& track);
+};
+
+//---------------------------------------------------------------------------//
+CELER_FUNCTION void
+RegionTrackingCutExecutor::operator()(celeritas::CoreTrackView& track)
+{
+    auto sim = track.make_sim_view();
+    if (sim.status() != TrackStatus::alive)
+    {
+        return;
+    }
+
+    auto geo = track.make_geo_view();
+    if (geo.is_outside())
+    {
+        return;
+    }
+
+    auto energy = track.make_particle_view().energy();
+    auto is_cut = [&sim, energy](TrackingCutLimits const& limits) {
+        return sim.time() > limits.max_time || energy < limits.min_energy;
+    };
+
+    if (!params.volume_cuts.empty())
+    {
+        CELER_ASSERT(geo.volume_id() < params.volume_cuts.size());
+        if (is_cut(params.volume_cuts[geo.volume_id()]))
+        {
+            TrackingCutExecutor{}(track);
+            return;
+        }
+    }
+
+    if (auto cut_id = find_region_particle<TrackingCutLimits>(
+            track, params.num_regions, params.num_particles))
+    {
+        if (is_cut(params.region_cuts[cut_id]))
+        {
+            TrackingCutExecutor{}(track);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,175 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/detail/ShowerSpotSampler.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Assert.hh"
+#include "corecel/Constants.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/math/Algorithms.hh"
+#include "geocel/Types.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/random/distribution/GammaDistribution.hh"
+#include "celeritas/random/distribution/GenerateCanonical.hh"
+
+#include "../ParameterizedShowerData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the positions of energy spots in a parameterized shower.
+ *
+ * The depth \em t of each spot in radiation lengths is sampled from the
+ * average longitudinal profile, a gamma distribution with shape \f$ \alpha
+ * \f$ whose maximum is at \f$ T \f$. The radial distance in Moliere radii is
+ * sampled from one of two components, a core and a tail, each with the
+ * profile
+ * \f[
+   f(r) = \frac{2 r R^2}{(r^2 + R^2)^2}
+ * \f]
+ * whose radius \em R and relative weight depend on the depth. All spots carry
+ * the same energy. Showers whose maximum is not beyond the starting point
+ * (too low in energy for the material) are deposited in a single spot at the
+ * origin.
+ *
+ * Spot positions are returned in a frame whose origin is the start of the
+ * shower and whose \em z axis is the shower axis.
+ */
+class ShowerSpotSampler
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Energy = units::MevEnergy;
+    //!@}
+
+  public:
+    // Construct from shower properties
+    inline CELER_FUNCTION ShowerSpotSampler(ShowerProfileParameters const& p,
+                                            ShowerMaterial const& material,
+                                            Energy energy,
+                                            bool is_photon,
+                                            size_type max_spots);
+
+    //! Number of spots to sample
+    CELER_FUNCTION size_type num_spots() const { return num_spots_; }
+
+    //! Depth of the shower maximum [len]
+    CELER_FUNCTION real_type depth_max() const { return t_max_ * x0_; }
+
+    // Sample the position of a spot [len]
+    template<class Engine>
+    inline CELER_FUNCTION Real3 operator()(Engine& rng);
+
+  private:
+    real_type x0_;
+    real_type rm_;
+    real_type t_max_{0};
+    real_type alpha_{1};
+    size_type num_spots_{1};
+
+    // Core radius and tail radius/probability coefficients
+    real_type core_[2]{};
+    real_type tail_[4]{};
+    real_type prob_[3]{};
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from shower properties.
+ */
+CELER_FUNCTION
+ShowerSpotSampler::ShowerSpotSampler(ShowerProfileParameters const& p,
+                                     ShowerMaterial const& material,
+                                     Energy energy,
+                                     bool is_photon,
+                                     size_type max_spots)
+    : x0_{material.radiation_length}, rm_{material.moliere_radius}
+{
+    CELER_EXPECT(material);
+    CELER_EXPECT(energy > zero_quantity());
+    CELER_EXPECT(max_spots > 0);
+
+    real_type const z = material.zeff;
+    real_type const log_y
+        = std::log(value_as<Energy>(energy)
+                   / value_as<Energy>(material.critical_energy));
+    real_type const alpha = p.alpha[0] + (p.alpha[1] + p.alpha[2] / z) * log_y;
+    real_type const t_max = log_y + p.t0 + (is_photon ? p.photon_t0 : 0);
+    if (!(t_max > 0 && alpha > 1))
+    {
+        // Shower is too small to have a profile
+        return;
+    }
+    t_max_ = t_max;
+    alpha_ = alpha;
+
+    // Energy-dependent coefficients use GeV
+    real_type const gev = value_as<Energy>(energy) / 1000;
+    real_type const log_e = std::log(gev);
+    core_[0] = p.core_radius[0] + p.core_radius[1] * log_e;
+    core_[1] = p.core_radius[2] + p.core_radius[3] * z;
+    tail_[0] = p.tail_radius[0] + p.tail_radius[1] * z;
+    tail_[1] = p.tail_radius[2];
+    tail_[2] = p.tail_radius[3];
+    tail_[3] = p.tail_radius[4] + p.tail_radius[5] * log_e;
+    prob_[0] = p.core_prob[0] + p.core_prob[1] * z;
+    prob_[1] = p.core_prob[2] + p.core_prob[3] * z;
+    prob_[2] = p.core_prob[4] + p.core_prob[5] * log_e;
+
+    real_type n = std::ceil(p.num_spots[0] * std::log(z)
+                            * std::pow(gev, p.num_spots[1]));
+    num_spots_ = static_cast<size_type>(
+        clamp(n, real_type{1}, static_cast<real_type>(max_spots)));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the position of a spot.
+ */
+template<class Engine>
+CELER_FUNCTION Real3 ShowerSpotSampler::operator()(Engine& rng)
+{
+    if (t_max_ == 0)
+    {
+        return {0, 0, 0};
+    }
+
+    // Sample depth and calculate the lateral profile there
+    GammaDistribution<real_type> sample_depth{alpha_,
+                                              t_max_ / (alpha_ - 1)};
+    real_type const t = sample_depth(rng);
+    real_type const tau = t / t_max_;
+    real_type const core_r = core_[0] + core_[1] * tau;
+    real_type const tail_r = tail_[0]
+                             * (std::exp(tail_[2] * (tau - tail_[1]))
+                                + std::exp(tail_[3] * (tau - tail_[1])));
+    real_type const x = (prob_[1] - tau) / prob_[2];
+    real_type const core_prob = prob_[0] * std::exp(x - std::exp(x));
+
+    // Sample the radius from the inverse CDF r^2 / (r^2 + R^2)
+    real_type const radius = generate_canonical(rng) < core_prob ? core_r
+                                                                  : tail_r;
+    real_type const u = generate_canonical(rng);
+    real_type const r = radius * std::sqrt(u / (1 - u)) * rm_;
+    real_type const phi = 2 * real_type(constants::pi)
+                          * generate_canonical(rng);
+
+    return {r * std::cos(phi), r * std::sin(phi), t * x0_};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
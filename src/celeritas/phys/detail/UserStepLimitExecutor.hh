@@ -0,0 +1,59 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/detail/UserStepLimitExecutor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/global/CoreTrackView.hh"
+
+#include "../UserLimitsData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Reduce the step of a charged track to the maximum step in its volume.
+ */
+struct UserStepLimitExecutor
+{
+    NativeCRef<UserLimitsParamsData> params;
+
+    inline CELER_FUNCTION void operator()(celeritas::CoreTrackView& track);
+};
+
+//---------------------------------------------------------------------------//
+CELER_FUNCTION void
+UserStepLimitExecutor::operator()(celeritas::CoreTrackView& track)
+{
+    auto sim = track.make_sim_view();
+    if (sim.status() != TrackStatus::alive)
+    {
+        return;
+    }
+
+    auto geo = track.make_geo_view();
+    if (geo.is_outside()
+        || track.make_particle_view().charge() == zero_quantity())
+    {
+        return;
+    }
+
+    CELER_ASSERT(geo.volume_id() < params.volumes.size());
+    VolumeUserLimits const& limits = params.volumes[geo.volume_id()];
+    if (limits.has_step_limit())
+    {
+        sim.step_limit({limits.max_step, params.step_limit_action});
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -64,18 +64,14 @@ void InitializeTracksAction::step_impl(CoreParams const& core_params,
         = std::min(counters.num_vacancies, counters.num_initializers);
     if (num_new_tracks > 0 || core_state.warming_up())
     {
-        if (core_params.init()->track_order() == TrackOrder::init_charge)
+        if (is_init_sorted(core_params.init()->track_order()))
         {
             // Reset track initializer indices
             fill_sequence(&core_state.ref().init.indices,
                           core_state.stream_id());
 
-            // Partition indices by whether tracks are charged or neutral
-            detail::partition_initializers(core_params,
-                                           core_state.ref().init,
-                                           counters,
-                                           num_new_tracks,
-                                           core_state.stream_id());
+            // Sort indices by the track layout policy
+            detail::sort_initializers(core_params, core_state, num_new_tracks);
         }
 
         // Launch a kernel to initialize tracks
@@ -85,7 +81,7 @@ void InitializeTracksAction::step_impl(CoreParams const& core_params,
         counters.num_initializers -= num_new_tracks;
         counters.num_vacancies -= num_new_tracks;
 
-        if (core_params.init()->track_order() == TrackOrder::init_charge)
+        if (is_init_sorted(core_params.init()->track_order()))
         {
             // Clear stale parent track IDs
             fill(TrackSlotId{}, &core_state.ref().init.parents);
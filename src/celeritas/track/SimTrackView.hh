@@ -52,6 +52,9 @@ class SimTrackView
     // Add the time change over the step
     inline CELER_FUNCTION void add_time(real_type delta);
 
+    // Change the statistical weight
+    inline CELER_FUNCTION void weight(real_type w);
+
     // Increment the total number of steps
     inline CELER_FUNCTION void increment_num_steps();
 
@@ -91,6 +94,9 @@ class SimTrackView
     // Time elapsed in the lab frame since the start of the event
     inline CELER_FUNCTION real_type time() const;
 
+    // Statistical weight of the track
+    inline CELER_FUNCTION real_type weight() const;
+
     // Whether the track is alive or inactive or dying
     inline CELER_FUNCTION TrackStatus status() const;
 
@@ -157,6 +163,7 @@ CELER_FUNCTION SimTrackView& SimTrackView::operator=(Initializer_t const& other)
         states_.num_looping_steps[track_slot_] = 0;
     }
     states_.time[track_slot_] = other.time;
+    states_.weight[track_slot_] = other.weight;
     states_.status[track_slot_] = TrackStatus::initializing;
     states_.step_length[track_slot_] = {};
     states_.post_step_action[track_slot_] = {};
@@ -174,6 +181,16 @@ CELER_FUNCTION void SimTrackView::add_time(real_type delta)
     states_.time[track_slot_] += delta;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Change the statistical weight (e.g., for splitting or roulette).
+ */
+CELER_FUNCTION void SimTrackView::weight(real_type w)
+{
+    CELER_EXPECT(w > 0);
+    states_.weight[track_slot_] = w;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Increment the total number of steps.
@@ -375,6 +392,15 @@ CELER_FORCEINLINE_FUNCTION real_type SimTrackView::time() const
     return states_.time[track_slot_];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Statistical weight of the track.
+ */
+CELER_FORCEINLINE_FUNCTION real_type SimTrackView::weight() const
+{
+    return states_.weight[track_slot_];
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Whether the track is inactive, alive, or being killed.
@@ -12,6 +12,7 @@
 
 #include "corecel/Assert.hh"
 #include "corecel/Macros.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/sys/ActionRegistry.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/global/CoreParams.hh"
@@ -36,6 +37,84 @@ bool is_sort_by_action(TrackOrder torder)
            && to_int(torder) < to_int(TrackOrder::end_reindex_action_);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Group tracks by charge and assign thread ranges to along-step actions.
+ *
+ * Neutral tracks are assigned to the neutral along-step action and charged
+ * tracks to the user along-step action: all other actions have empty ranges,
+ * so \c validate_begin_run rejects any other along-step action.
+ * The group with the lower action ID comes first so that the offsets are
+ * monotonic. If the user action is also the neutral action, it is assigned
+ * every track.
+ */
+template<MemSpace M>
+void partition_along_step(CoreParams const& params, CoreState<M>& state)
+{
+    auto const& scalars = params.host_ref().scalars;
+    ActionId const neutral = scalars.along_step_neutral_action;
+    ActionId const charged = scalars.along_step_user_action;
+    bool const neutral_first = neutral < charged;
+
+    size_type num_first = 0;
+    if (neutral != charged)
+    {
+        num_first = detail::partition_tracks_by_charge(
+            params.ref<M>().particles, state.ref(), neutral_first);
+    }
+
+    ActionId const first = neutral_first ? neutral : charged;
+    ActionId const second = neutral_first ? charged : neutral;
+    auto& offsets = state.action_thread_offsets();
+    for (auto aid : range(ActionId{offsets.size()}))
+    {
+        offsets[aid] = ThreadId{aid <= first    ? 0
+                                : aid <= second ? num_first
+                                                : state.size()};
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Check that the state and registered actions are consistent with sorting.
+ *
+ * Partitioning by particle type assigns tracks only to the neutral and user
+ * along-step actions, so any other along-step action would never run.
+ */
+void validate_begin_run(CoreParams const& params,
+                        size_type num_offsets,
+                        TrackOrder track_order)
+{
+    ActionRegistry const& reg = *params.action_reg();
+    CELER_VALIDATE(num_offsets == reg.num_actions() + 1,
+                   << "state action size is incorrect: actions might have "
+                      "been added after creating states");
+
+    if (track_order != TrackOrder::reindex_particle_type)
+    {
+        return;
+    }
+
+    auto const& scalars = params.host_ref().scalars;
+    for (auto aidx : range(reg.num_actions()))
+    {
+        auto const* step_action = dynamic_cast<CoreStepActionInterface const*>(
+            reg.action(ActionId{aidx}).get());
+        if (!step_action || step_action->order() != StepActionOrder::along)
+        {
+            continue;
+        }
+        ActionId const id = step_action->action_id();
+        CELER_VALIDATE(id == scalars.along_step_neutral_action
+                           || id == scalars.along_step_user_action,
+                       << "along-step action '" << step_action->label()
+                       << "' cannot be used with track order '"
+                       << to_cstring(track_order)
+                       << "', which only assigns tracks to the neutral and "
+                          "user along-step actions");
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace
 
@@ -99,7 +178,8 @@ std::string_view SortTracksAction::label() const
 /*!
  * Execute the action with host data.
  */
-void SortTracksAction::step(CoreParams const&, CoreStateHost& state) const
+void SortTracksAction::step(CoreParams const& params,
+                            CoreStateHost& state) const
 {
     detail::sort_tracks(state.ref(), track_order_);
     if (is_sort_by_action(track_order_))
@@ -110,13 +190,18 @@ void SortTracksAction::step(CoreParams const&, CoreStateHost& state) const
             state.action_thread_offsets(),
             track_order_);
     }
+    else if (track_order_ == TrackOrder::reindex_particle_type)
+    {
+        partition_along_step(params, state);
+    }
 }
 
 //---------------------------------------------------------------------------//
 /*!
  * Execute the action with device data.
  */
-void SortTracksAction::step(CoreParams const&, CoreStateDevice& state) const
+void SortTracksAction::step(CoreParams const& params,
+                            CoreStateDevice& state) const
 {
     detail::sort_tracks(state.ref(), track_order_);
     if (is_sort_by_action(track_order_))
@@ -128,6 +213,10 @@ void SortTracksAction::step(CoreParams const&, CoreStateDevice& state) const
             state.action_thread_offsets(),
             track_order_);
     }
+    else if (track_order_ == TrackOrder::reindex_particle_type)
+    {
+        partition_along_step(params, state);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -136,10 +225,8 @@ void SortTracksAction::step(CoreParams const&, CoreStateDevice& state) const
  */
 void SortTracksAction::begin_run(CoreParams const& params, CoreStateHost& state)
 {
-    CELER_VALIDATE(state.action_thread_offsets().size()
-                       == params.action_reg()->num_actions() + 1,
-                   << "state action size is incorrect: actions might have "
-                      "been added after creating states");
+    validate_begin_run(
+        params, state.action_thread_offsets().size(), track_order_);
 }
 
 //---------------------------------------------------------------------------//
@@ -149,10 +236,8 @@ void SortTracksAction::begin_run(CoreParams const& params, CoreStateHost& state)
 void SortTracksAction::begin_run(CoreParams const& params,
                                  CoreStateDevice& state)
 {
-    CELER_VALIDATE(state.action_thread_offsets().size()
-                       == params.action_reg()->num_actions() + 1,
-                   << "state action size is incorrect: actions might have "
-                      "been added after creating states");
+    validate_begin_run(
+        params, state.action_thread_offsets().size(), track_order_);
 }
 
 //---------------------------------------------------------------------------//
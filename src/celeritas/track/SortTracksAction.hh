@@ -17,7 +17,12 @@ namespace celeritas
  *
  * This action can be applied at different stage of a simulation step,
  * automatically determined by TrackOrder. This should not have any impact on
- * simulation output: it is only useful for GPU device optimizations.
+ * simulation output: it is mostly useful for GPU device optimizations, but
+ * the resulting action ranges also let CPU launches skip inapplicable tracks.
+ *
+ * When sorting by particle type, the tracks are additionally grouped by charge
+ * so that the neutral and charged along-step actions each run as a separate
+ * loop over only their own tracks.
  *
  * \todo Keep weak pointer to actions? Use aux data?
  */
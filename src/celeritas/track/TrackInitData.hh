@@ -174,7 +174,7 @@ void resize(TrackInitStateData<Ownership::value, M>* data,
     resize(&data->parents, size);
     resize(&data->secondary_counts, size + 1);
     resize(&data->track_counters, params.max_events);
-    if (params.track_order == TrackOrder::init_charge)
+    if (is_init_sorted(params.track_order))
     {
         resize(&data->indices, size);
     }
@@ -0,0 +1,136 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/WeightWindowAction.cc
+//---------------------------------------------------------------------------//
+#include "WeightWindowAction.hh"
+
+#include <algorithm>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/sys/ActionRegistry.hh"  // IWYU pragma: keep
+#include "celeritas/global/ActionLauncher.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+#include "celeritas/geo/GeoParams.hh"  // IWYU pragma: keep
+#include "celeritas/user/detail/StepGatherUtils.hh"
+
+#include "detail/WeightWindowExecutor.hh"  // IWYU pragma: associated
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct and add to core params.
+ */
+std::shared_ptr<WeightWindowAction>
+WeightWindowAction::make_and_insert(CoreParams const& core, Input const& input)
+{
+    auto const num_volumes = core.geometry()->volumes().size();
+    CELER_VALIDATE(input.lower_bounds.size() <= num_volumes,
+                   << "weight windows were given for "
+                   << input.lower_bounds.size()
+                   << " volumes, but the geometry has only " << num_volumes);
+
+    ActionRegistry& actions = *core.action_reg();
+    auto result
+        = std::make_shared<WeightWindowAction>(actions.next_id(), input);
+    detail::validate_before_step_gather(actions, result->label());
+    actions.insert(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with action ID and windows.
+ */
+WeightWindowAction::WeightWindowAction(ActionId id, Input const& input)
+    : id_(id)
+{
+    CELER_EXPECT(id_);
+    CELER_VALIDATE(!input.lower_bounds.empty(),
+                   << "no weight windows were specified");
+    CELER_VALIDATE(std::is_sorted(input.energy_grid.begin(),
+                                  input.energy_grid.end())
+                       && std::adjacent_find(input.energy_grid.begin(),
+                                             input.energy_grid.end())
+                              == input.energy_grid.end(),
+                   << "weight window energy grid is not strictly increasing");
+    CELER_VALIDATE(input.survival_ratio >= 1
+                       && input.upper_ratio >= input.survival_ratio,
+                   << "invalid weight window ratios: upper="
+                   << input.upper_ratio
+                   << ", survival=" << input.survival_ratio);
+    CELER_VALIDATE(input.max_split > 0,
+                   << "invalid maximum split " << input.max_split);
+
+    size_type const num_bins = input.energy_grid.size() + 1;
+
+    HostVal<WeightWindowParamsData> host_data;
+    make_builder(&host_data.energy_grid)
+        .insert_back(input.energy_grid.begin(), input.energy_grid.end());
+
+    auto windows = make_builder(&host_data.windows);
+    windows.reserve(input.lower_bounds.size() * num_bins);
+    for (auto const& vol_lower : input.lower_bounds)
+    {
+        CELER_VALIDATE(vol_lower.size() == num_bins,
+                       << "expected " << num_bins
+                       << " weight window bounds per volume but got "
+                       << vol_lower.size());
+        for (real_type lower : vol_lower)
+        {
+            CELER_VALIDATE(lower >= 0,
+                           << "invalid weight window lower bound " << lower);
+            WeightWindow ww;
+            ww.lower = lower;
+            ww.upper = lower * input.upper_ratio;
+            ww.survival = lower * input.survival_ratio;
+            windows.push_back(ww);
+        }
+    }
+    host_data.num_volumes = input.lower_bounds.size();
+    host_data.max_split = input.max_split;
+
+    data_ = CollectionMirror<WeightWindowParamsData>{std::move(host_data)};
+    CELER_ENSURE(data_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a long description of the action.
+ */
+std::string_view WeightWindowAction::description() const
+{
+    return "apply weight window roulette and splitting";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the weight window game with host data.
+ */
+void WeightWindowAction::step(CoreParams const& params,
+                              CoreStateHost& state) const
+{
+    auto execute = make_active_track_executor(
+        params.ptr<MemSpace::native>(),
+        state.ptr(),
+        detail::WeightWindowExecutor{this->host_ref()});
+    launch_action(*this, params, state, execute);
+}
+
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+void WeightWindowAction::step(CoreParams const&, CoreStateDevice&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,101 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/WeightWindowAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "corecel/data/CollectionMirror.hh"
+#include "corecel/data/ParamsDataInterface.hh"
+#include "celeritas/global/ActionInterface.hh"
+
+#include "WeightWindowData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply Russian roulette and splitting with volume/energy weight windows.
+ *
+ * This is the weight window technique of MCNP and the Geant4 "weight window"
+ * biasing: each volume (and optionally each kinetic energy bin) is assigned
+ * a lower weight bound. Tracks whose statistical weight falls below the
+ * window are rouletted to the survival weight, and tracks whose weight is
+ * above the window are split into several tracks with a smaller weight. With
+ * importance-based windows (lower bound inversely proportional to the
+ * importance of the volume) the population is depleted in unimportant regions
+ * and enhanced in important ones, which greatly reduces the cost of
+ * deep-penetration problems.
+ *
+ * The upper bound and survival weight are given as multiples of the lower
+ * bound, with the same defaults as MCNP. Volumes beyond the end of the input
+ * \c lower_bounds, and windows with a zero lower bound, are unbiased.
+ *
+ * Tallies must account for the track weight: the \c SimpleCalo and Geant4
+ * hit processing use the pre-step weight.
+ */
+class WeightWindowAction final
+    : public CoreStepActionInterface,
+      public ParamsDataInterface<WeightWindowParamsData>
+{
+  public:
+    //! Input for constructing weight windows
+    struct Input
+    {
+        //! Increasing interior energy bin boundaries [MeV]
+        std::vector<real_type> energy_grid;
+        //! Lower weight bound for each [volume][energy bin]
+        std::vector<std::vector<real_type>> lower_bounds;
+        //! Ratio of the upper weight bound to the lower bound
+        real_type upper_ratio{5};
+        //! Ratio of the roulette survival weight to the lower bound
+        real_type survival_ratio{3};
+        //! Maximum number of tracks a single track can be split into
+        size_type max_split{5};
+    };
+
+  public:
+    // Construct and add to core params
+    static std::shared_ptr<WeightWindowAction>
+    make_and_insert(CoreParams const& core, Input const& input);
+
+    // Construct with action ID and windows
+    WeightWindowAction(ActionId id, Input const& input);
+
+    //!@{
+    //! \name Action interface
+    //! ID of the action
+    ActionId action_id() const final { return id_; }
+    //! Short name for the action
+    std::string_view label() const final { return "weight-window"; }
+    // Description of the action for user interaction
+    std::string_view description() const final;
+    //! Dependency ordering of the action
+    StepActionOrder order() const final { return StepActionOrder::user_post; }
+    //!@}
+
+    //!@{
+    //! \name StepAction interface
+    // Launch kernel with host data
+    void step(CoreParams const&, CoreStateHost&) const final;
+    // Launch kernel with device data
+    void step(CoreParams const&, CoreStateDevice&) const final;
+    //!@}
+
+    //! Access data on the host
+    HostRef const& host_ref() const final { return data_.host_ref(); }
+    //! Access data on the device
+    DeviceRef const& device_ref() const final { return data_.device_ref(); }
+
+  private:
+    ActionId id_;
+    CollectionMirror<WeightWindowParamsData> data_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,85 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/WeightWindowData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/data/Collection.hh"
+#include "celeritas/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Weight window bounds for a single volume and energy bin.
+ *
+ * A lower bound of zero disables the window: no roulette or splitting is
+ * performed.
+ */
+struct WeightWindow
+{
+    real_type lower{0};  //!< Roulette tracks below this weight
+    real_type upper{0};  //!< Split tracks above this weight
+    real_type survival{0};  //!< Weight of tracks that survive roulette
+
+    //! Whether the window applies
+    explicit CELER_FUNCTION operator bool() const { return lower > 0; }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Weight windows as a function of volume and kinetic energy.
+ *
+ * The windows are stored as a flattened [volume][energy bin] array. The
+ * energy grid has the \em interior bin boundaries, so there is one more
+ * energy bin than grid points.
+ */
+template<Ownership W, MemSpace M>
+struct WeightWindowParamsData
+{
+    //// TYPES ////
+
+    template<class T>
+    using Items = Collection<T, W, M>;
+
+    //// DATA ////
+
+    //! Increasing interior energy bin boundaries [MeV]
+    Items<real_type> energy_grid;
+    //! Windows for each [volume][energy bin]
+    Items<WeightWindow> windows;
+    //! Number of volumes with windows
+    size_type num_volumes{0};
+    //! Maximum number of tracks a single track can be split into
+    size_type max_split{0};
+
+    //// METHODS ////
+
+    //! Whether the data are assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return num_volumes > 0 && max_split > 0
+               && windows.size() == num_volumes * (energy_grid.size() + 1);
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    WeightWindowParamsData&
+    operator=(WeightWindowParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        energy_grid = other.energy_grid;
+        windows = other.windows;
+        num_volumes = other.num_volumes;
+        max_split = other.max_split;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -75,7 +75,7 @@ CELER_FUNCTION void InitTracksExecutor::operator()(ThreadId tid) const
     auto const& data = state->init;
 
     auto get_idx = [&](size_type size) {
-        if (params->init.track_order == TrackOrder::init_charge)
+        if (is_init_sorted(params->init.track_order))
         {
             // Get the index into the track initializer or parent track slot ID
             // array from the sorted indices
@@ -21,6 +21,7 @@
 #include "celeritas/phys/PhysicsTrackView.hh"
 #include "celeritas/phys/Secondary.hh"
 
+#include "Utils.hh"
 #include "../CoreStateCounters.hh"
 #include "../SimTrackView.hh"
 
@@ -86,9 +87,10 @@ ProcessSecondariesExecutor::operator()(TrackSlotId tid) const
     // A new track was initialized from a secondary in the parent's track slot
     bool initialized = false;
 
-    // Save the parent ID since it will be overwritten if a secondary is
-    // initialized in this slot
+    // Save the parent ID and weight since they will be overwritten if a
+    // secondary is initialized in this slot
     TrackId const parent_id{sim.track_id()};
+    real_type const parent_weight{sim.weight()};
 
     PhysicsStepView const phys_step(params->physics, state->physics, tid);
     for (auto const& secondary : phys_step.secondaries())
@@ -109,6 +111,8 @@ ProcessSecondariesExecutor::operator()(TrackSlotId tid) const
             ti.sim.parent_id = parent_id;
             ti.sim.event_id = sim.event_id();
             ti.sim.time = sim.time();
+            ti.sim.weight = secondary.weight > 0 ? secondary.weight
+                                                 : parent_weight;
             ti.geo.pos = geo.pos();
             ti.geo.dir = secondary.direction;
             ti.particle.particle_id = secondary.particle_id;
@@ -116,11 +120,11 @@ ProcessSecondariesExecutor::operator()(TrackSlotId tid) const
             CELER_ASSERT(ti);
 
             if (!initialized && sim.status() != TrackStatus::alive
-                && params->init.track_order != TrackOrder::init_charge)
+                && can_init_in_parent_slot(params->init.track_order))
             {
                 /*!
-                 * Skip in-place initialization when tracks are partitioned by
-                 * charge to reduce the amount of mixing
+                 * Skip in-place initialization when tracks are grouped by
+                 * charge or particle type to reduce the amount of mixing
                  *
                  * \todo Consider allowing this if the parent's charge is the
                  * same as the secondary's
@@ -157,14 +161,14 @@ ProcessSecondariesExecutor::operator()(TrackSlotId tid) const
                     = ti;
 
                 if (offset <= data.parents.size()
-                    && (params->init.track_order != TrackOrder::init_charge
+                    && (can_init_in_parent_slot(params->init.track_order)
                         || sim.status() == TrackStatus::alive))
                 {
                     // Store the thread ID of the secondary's parent if the
                     // secondary could be initialized in the next step. If the
-                    // tracks are partitioned by charge we skip in-place
-                    // initialization of the secondary, so the parent track
-                    // must still be alive to ensure the state isn't
+                    // tracks are grouped by charge or particle type we skip
+                    // in-place initialization of the secondary, so the parent
+                    // track must still be alive to ensure the state isn't
                     // overwritten
                     data.parents[TrackSlotId(data.parents.size() - offset)]
                         = tid;
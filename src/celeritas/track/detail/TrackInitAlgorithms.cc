@@ -10,6 +10,8 @@
 #include <algorithm>
 #include <numeric>
 
+#include "celeritas/track/TrackInitParams.hh"
+
 #include "Utils.hh"
 
 namespace celeritas
@@ -72,25 +74,42 @@ size_type exclusive_scan_counts(
 
 //---------------------------------------------------------------------------//
 /*!
- * Sort the tracks that will be initialized in this step by charged/neutral.
+ * Sort the tracks that will be initialized in this step.
  *
- * This partitions an array of indices used to access the track initializers
- * and the thread IDs of the initializers' parent tracks.
+ * This reorders an array of indices used to access the track initializers
+ * and the thread IDs of the initializers' parent tracks. With \c init_charge
+ * the indices are partitioned by charged/neutral; otherwise they are stably
+ * sorted by the layout key so that consecutive vacancies are filled with
+ * similar tracks.
  */
-void partition_initializers(
-    CoreParams const& params,
-    TrackInitStateData<Ownership::reference, MemSpace::host> const& init,
-    CoreStateCounters const& counters,
-    size_type count,
-    StreamId)
+void sort_initializers(CoreParams const& params,
+                       CoreState<MemSpace::host>& state,
+                       size_type count)
 {
-    // Partition the indices based on the track initializer charge
+    auto const& init = state.ref().init;
+    auto const& counters = state.counters();
     auto start = init.indices.data().get();
     auto end = start + count;
-    auto stencil = init.initializers.data().get() + counters.num_initializers
-                   - count;
-    std::stable_partition(
-        start, end, IsNeutralStencil{params.ptr<MemSpace::native>(), stencil});
+
+    if (params.init()->track_order() == TrackOrder::init_charge)
+    {
+        // Partition the indices based on the track initializer charge
+        auto stencil = init.initializers.data().get()
+                       + counters.num_initializers - count;
+        std::stable_partition(
+            start,
+            end,
+            IsNeutralStencil{params.ptr<MemSpace::native>(), stencil});
+        return;
+    }
+
+    std::stable_sort(
+        start,
+        end,
+        InitializerLayoutLess{{params.ptr<MemSpace::native>(),
+                               state.ptr(),
+                               counters.num_initializers,
+                               count}});
 }
 
 //---------------------------------------------------------------------------//
@@ -12,6 +12,7 @@
 #include <thrust/partition.h>
 #include <thrust/remove.h>
 #include <thrust/scan.h>
+#include <thrust/sort.h>
 
 #include "corecel/Macros.hh"
 #include "corecel/data/ObserverPtr.device.hh"
@@ -19,6 +20,7 @@
 #include "corecel/sys/ScopedProfiling.hh"
 #include "corecel/sys/Stream.hh"
 #include "corecel/sys/Thrust.device.hh"
+#include "celeritas/track/TrackInitParams.hh"
 
 #include "Utils.hh"
 
@@ -79,30 +81,46 @@ size_type exclusive_scan_counts(
 
 //---------------------------------------------------------------------------//
 /*!
- * Sort the tracks that will be initialized in this step by charged/neutral.
+ * Sort the tracks that will be initialized in this step.
  *
- * This partitions an array of indices used to access the track initializers
- * and the thread IDs of the initializers' parent tracks.
+ * This reorders an array of indices used to access the track initializers
+ * and the thread IDs of the initializers' parent tracks. With \c init_charge
+ * the indices are partitioned by charged/neutral; otherwise they are stably
+ * sorted by the layout key.
  */
-void partition_initializers(
-    CoreParams const& params,
-    TrackInitStateData<Ownership::reference, MemSpace::device> const& init,
-    CoreStateCounters const& counters,
-    size_type count,
-    StreamId stream_id)
+void sort_initializers(CoreParams const& params,
+                       CoreState<MemSpace::device>& state,
+                       size_type count)
 {
-    ScopedProfiling profile_this{"partition-initializers"};
+    ScopedProfiling profile_this{"sort-initializers"};
 
-    // Partition the indices based on the track initializer charge
+    auto const& init = state.ref().init;
+    auto const& counters = state.counters();
     auto start = device_pointer_cast(init.indices.data());
     auto end = start + count;
-    auto stencil = static_cast<TrackInitializer*>(init.initializers.data())
-                   + counters.num_initializers - count;
-    thrust::stable_partition(
-        thrust_execute_on(stream_id),
-        start,
-        end,
-        IsNeutralStencil{params.ptr<MemSpace::native>(), stencil});
+
+    if (params.init()->track_order() == TrackOrder::init_charge)
+    {
+        // Partition the indices based on the track initializer charge
+        auto stencil = static_cast<TrackInitializer*>(init.initializers.data())
+                       + counters.num_initializers - count;
+        thrust::stable_partition(
+            thrust_execute_on(state.stream_id()),
+            start,
+            end,
+            IsNeutralStencil{params.ptr<MemSpace::native>(), stencil});
+    }
+    else
+    {
+        thrust::stable_sort(
+            thrust_execute_on(state.stream_id()),
+            start,
+            end,
+            InitializerLayoutLess{{params.ptr<MemSpace::native>(),
+                                   state.ptr(),
+                                   counters.num_initializers,
+                                   count}});
+    }
     CELER_DEVICE_CHECK_ERROR();
 }
 
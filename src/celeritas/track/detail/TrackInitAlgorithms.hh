@@ -13,6 +13,7 @@
 #include "corecel/data/Collection.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
 #include "celeritas/track/CoreStateCounters.hh"
 #include "celeritas/track/TrackInitData.hh"
 
@@ -41,19 +42,13 @@ size_type exclusive_scan_counts(
     StreamId);
 
 //---------------------------------------------------------------------------//
-// Sort the tracks that will be initialized in this step by charged/neutral
-void partition_initializers(
-    CoreParams const&,
-    TrackInitStateData<Ownership::reference, MemSpace::host> const&,
-    CoreStateCounters const&,
-    size_type,
-    StreamId);
-void partition_initializers(
-    CoreParams const&,
-    TrackInitStateData<Ownership::reference, MemSpace::device> const&,
-    CoreStateCounters const&,
-    size_type,
-    StreamId);
+// Sort the tracks that will be initialized in this step by layout policy
+void sort_initializers(CoreParams const&,
+                       CoreState<MemSpace::host>&,
+                       size_type);
+void sort_initializers(CoreParams const&,
+                       CoreState<MemSpace::device>&,
+                       size_type);
 
 //---------------------------------------------------------------------------//
 // INLINE DEFINITIONS
@@ -73,12 +68,8 @@ inline size_type exclusive_scan_counts(
     CELER_NOT_CONFIGURED("CUDA or HIP");
 }
 
-inline void partition_initializers(
-    CoreParams const&,
-    TrackInitStateData<Ownership::reference, MemSpace::device> const&,
-    CoreStateCounters const&,
-    size_type,
-    StreamId)
+inline void
+sort_initializers(CoreParams const&, CoreState<MemSpace::device>&, size_type)
 {
     CELER_NOT_CONFIGURED("CUDA or HIP");
 }
@@ -87,6 +87,28 @@ void sort_tracks(HostRef<CoreStateData> const& states, TrackOrder order)
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Group tracks sorted by particle type into neutral and charged tracks.
+ *
+ * The partition is stable so that tracks remain sorted by particle type in
+ * each group. Never-initialized track slots are placed at the end.
+ *
+ * \return Number of tracks in the first group
+ */
+size_type partition_tracks_by_charge(HostCRef<ParticleParamsData> const& params,
+                                     HostRef<CoreStateData> const& states,
+                                     bool neutral_first)
+{
+    auto* start = states.track_slots.data().get();
+    auto* stop = std::stable_partition(
+        start,
+        start + states.track_slots.size(),
+        IsInFirstChargeGroup<MemSpace::host>{
+            params, states.particles.particle_id.data(), neutral_first});
+    return stop - start;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Count tracks associated to each action that was used to sort them, specified
@@ -167,6 +167,28 @@ void sort_tracks(DeviceRef<CoreStateData> const& states, TrackOrder order)
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Group tracks sorted by particle type into neutral and charged tracks.
+ *
+ * \return Number of tracks in the first group
+ */
+size_type
+partition_tracks_by_charge(DeviceCRef<ParticleParamsData> const& params,
+                           DeviceRef<CoreStateData> const& states,
+                           bool neutral_first)
+{
+    auto start = device_pointer_cast(states.track_slots.data());
+    auto stop = thrust::stable_partition(
+        thrust_execute_on(states.stream_id),
+        start,
+        start + states.track_slots.size(),
+        IsInFirstChargeGroup<MemSpace::device>{
+            params, states.particles.particle_id.data(), neutral_first});
+    CELER_DEVICE_CHECK_ERROR();
+    return stop - start;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Count tracks associated to each action that was used to sort them, specified
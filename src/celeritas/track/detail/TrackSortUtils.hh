@@ -16,6 +16,7 @@
 #include "corecel/data/ObserverPtr.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/phys/ParticleView.hh"
 
 namespace celeritas
 {
@@ -30,6 +31,15 @@ namespace detail
 void sort_tracks(HostRef<CoreStateData> const&, TrackOrder);
 void sort_tracks(DeviceRef<CoreStateData> const&, TrackOrder);
 
+//---------------------------------------------------------------------------//
+// Group sorted tracks by charge and return the size of the first group
+size_type partition_tracks_by_charge(HostCRef<ParticleParamsData> const&,
+                                     HostRef<CoreStateData> const&,
+                                     bool neutral_first);
+size_type partition_tracks_by_charge(DeviceCRef<ParticleParamsData> const&,
+                                     DeviceRef<CoreStateData> const&,
+                                     bool neutral_first);
+
 //---------------------------------------------------------------------------//
 // Count tracks associated to each action
 void count_tracks_per_action(
@@ -62,6 +72,28 @@ struct IsNotInactive
     }
 };
 
+//! Predicate for grouping neutral and charged tracks
+template<MemSpace M>
+struct IsInFirstChargeGroup
+{
+    ParticleParamsData<Ownership::const_reference, M> particles;
+    ObserverPtr<ParticleId const> particle_ids;
+    bool neutral_first;
+
+    CELER_FUNCTION bool operator()(size_type track_slot) const
+    {
+        ParticleId pid = particle_ids.get()[track_slot];
+        if (!pid)
+        {
+            // Never-initialized track slots go at the end
+            return false;
+        }
+        bool is_neutral = ParticleView(particles, pid).charge()
+                          == zero_quantity();
+        return is_neutral == neutral_first;
+    }
+};
+
 //! Map from a thread ID to an action ID by pointer indirection
 struct ActionAccessor
 {
@@ -100,6 +132,14 @@ inline void sort_tracks(DeviceRef<CoreStateData> const&, TrackOrder)
     CELER_NOT_CONFIGURED("CUDA or HIP");
 }
 
+inline size_type partition_tracks_by_charge(
+    DeviceCRef<ParticleParamsData> const&,
+    DeviceRef<CoreStateData> const&,
+    bool)
+{
+    CELER_NOT_CONFIGURED("CUDA or HIP");
+}
+
 inline void count_tracks_per_action(
     DeviceRef<CoreStateData> const&,
     Span<ThreadId>,
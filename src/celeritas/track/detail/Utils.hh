@@ -12,6 +12,7 @@
 #include "corecel/Types.hh"
 #include "corecel/data/Collection.hh"
 #include "corecel/math/Atomics.hh"
+#include "corecel/math/NumericLimits.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/global/CoreTrackData.hh"
 #include "celeritas/phys/ParticleView.hh"
@@ -60,6 +61,53 @@ struct IsNeutralStencil
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the layout key used to sort new tracks into vacancies.
+ *
+ * The argument is an index into the \c count track initializers (and
+ * corresponding parent track slots) at the back of their arrays. Initializers
+ * whose key can't be determined (e.g., primaries, which have no parent track)
+ * are sorted to the end.
+ */
+struct InitializerLayoutKey
+{
+    using ParamsPtr = CRefPtr<CoreParamsData, MemSpace::native>;
+    using StatePtr = RefPtr<CoreStateData, MemSpace::native>;
+
+    ParamsPtr params;
+    StatePtr state;
+    size_type num_initializers;
+    size_type count;
+
+    inline CELER_FUNCTION size_type operator()(size_type i) const;
+};
+
+//---------------------------------------------------------------------------//
+//! Comparator for sorting initializer indices by layout key
+struct InitializerLayoutLess
+{
+    InitializerLayoutKey key;
+
+    CELER_FUNCTION bool operator()(size_type a, size_type b) const
+    {
+        return key(a) < key(b);
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether the first secondary of a killed track may reuse the parent's slot.
+ *
+ * In-place initialization keeps the material and position of the parent, so
+ * it is allowed unless new tracks are grouped by charge or particle type.
+ */
+CELER_CONSTEXPR_FUNCTION bool can_init_in_parent_slot(TrackOrder order)
+{
+    return order != TrackOrder::init_charge
+           && order != TrackOrder::init_particle;
+}
+
 //---------------------------------------------------------------------------//
 //! Indicate that a track slot is occupied by a still-alive track
 CELER_CONSTEXPR_FUNCTION TrackSlotId occupied()
@@ -115,6 +163,35 @@ make_track_id(NativeCRef<TrackInitParamsData> const&,
     return TrackId{result};
 }
 
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Get the layout key for the given initializer index.
+ */
+CELER_FUNCTION size_type InitializerLayoutKey::operator()(size_type i) const
+{
+    CELER_EXPECT(i < count);
+
+    auto const& init = state->init;
+    if (params->init.track_order == TrackOrder::init_particle)
+    {
+        return init.initializers[ItemId<TrackInitializer>(
+                                     num_initializers - count + i)]
+            .particle.particle_id.unchecked_get();
+    }
+
+    // New tracks are in the same material as their parent
+    CELER_ASSERT(params->init.track_order == TrackOrder::init_material);
+    TrackSlotId parent
+        = init.parents[TrackSlotId(init.parents.size() - count + i)];
+    if (!parent)
+    {
+        return numeric_limits<size_type>::max();
+    }
+    return state->materials.state[parent].material_id.unchecked_get();
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace celeritas
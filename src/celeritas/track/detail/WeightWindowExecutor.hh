@@ -0,0 +1,155 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/WeightWindowExecutor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/math/Algorithms.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/random/distribution/GenerateCanonical.hh"
+
+#include "../WeightWindowData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply Russian roulette and splitting to keep weights inside a window.
+ *
+ * This is applied at the end of the step, after the interaction. Secondaries
+ * created during the step keep the weight of the parent that created them.
+ * Tracks on a boundary are rouletted but not split, since the new tracks
+ * can't be initialized on a surface.
+ *
+ * - Below the window, a track survives with probability \f$ w / w_s \f$ and
+ *   is assigned the survival weight \f$ w_s \f$ ; otherwise it's killed
+ *   without depositing its energy.
+ * - Above the window, a track is split into \f$ n = \lceil w / w_u \rceil \f$
+ *   (limited by \c max_split ) identical copies with weight \f$ w / n \f$ .
+ *   The copies are emitted as secondaries at the track's position.
+ */
+struct WeightWindowExecutor
+{
+    inline CELER_FUNCTION void
+    operator()(celeritas::CoreTrackView const& track);
+
+    NativeCRef<WeightWindowParamsData> const params;
+};
+
+//---------------------------------------------------------------------------//
+CELER_FUNCTION void
+WeightWindowExecutor::operator()(celeritas::CoreTrackView const& track)
+{
+    CELER_EXPECT(params);
+
+    auto sim = track.make_sim_view();
+    if (sim.status() != TrackStatus::alive)
+    {
+        return;
+    }
+
+    auto geo = track.make_geo_view();
+    if (geo.is_outside() || !(geo.volume_id() < params.num_volumes))
+    {
+        return;
+    }
+
+    auto particle = track.make_particle_view();
+    WeightWindow const window = [&] {
+        auto grid = params.energy_grid[AllItems<real_type>{}];
+        auto iter = celeritas::upper_bound(
+            grid.begin(), grid.end(), particle.energy().value());
+        size_type bin = iter - grid.begin();
+        return params.windows[ItemId<WeightWindow>{
+            geo.volume_id().unchecked_get() * (grid.size() + 1) + bin}];
+    }();
+    if (!window)
+    {
+        return;
+    }
+
+    real_type const weight = sim.weight();
+    auto phys_step = track.make_physics_step_view();
+    Span<Secondary> secondaries = phys_step.secondaries();
+    if (weight < window.lower)
+    {
+        // Russian roulette
+        auto rng = track.make_rng_engine();
+        if (generate_canonical(rng) * window.survival < weight)
+        {
+            sim.weight(window.survival);
+        }
+        else
+        {
+            particle.subtract_energy(particle.energy());
+            sim.status(TrackStatus::killed);
+        }
+    }
+    else if (weight > window.upper && !geo.is_on_boundary())
+    {
+        // Splitting
+        size_type num_split = celeritas::min(
+            static_cast<size_type>(std::ceil(weight / window.upper)),
+            params.max_split);
+        if (num_split < 2)
+        {
+            return;
+        }
+
+        // Copy the existing secondaries into a larger block
+        auto allocate = phys_step.make_secondary_allocator();
+        Span<Secondary> result{allocate(secondaries.size() + num_split - 1),
+                               secondaries.size() + num_split - 1};
+        if (!result.data())
+        {
+            // Out of secondary storage: skip splitting this step
+            return;
+        }
+        for (auto i : range(secondaries.size()))
+        {
+            result[i] = secondaries[i];
+        }
+
+        // Add identical copies of the track
+        real_type const split_weight = weight / num_split;
+        for (auto i : range(secondaries.size(), result.size()))
+        {
+            Secondary& copy = result[i];
+            copy.particle_id = particle.particle_id();
+            copy.energy = particle.energy();
+            copy.direction = geo.dir();
+            copy.weight = split_weight;
+        }
+        phys_step.secondaries(result);
+        secondaries = result.first(secondaries.size());
+        sim.weight(split_weight);
+    }
+    else
+    {
+        // Weight is inside the window
+        return;
+    }
+
+    // Secondaries from the interaction keep the parent's original weight
+    for (Secondary& secondary : secondaries)
+    {
+        if (secondary && !(secondary.weight > 0))
+        {
+            secondary.weight = weight;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
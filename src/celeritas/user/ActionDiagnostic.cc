@@ -94,14 +94,15 @@ void ActionDiagnostic::begin_run(CoreParams const& params, CoreStateDevice&)
  */
 void ActionDiagnostic::step(CoreParams const& params, CoreStateHost& state) const
 {
+    auto& tally_state = store_.state<MemSpace::host>(state.stream_id(),
+                                                     this->state_size());
     auto execute = make_active_track_executor(
         params.ptr<MemSpace::native>(),
         state.ptr(),
-        detail::ActionDiagnosticExecutor{
-            store_.params<MemSpace::native>(),
-            store_.state<MemSpace::native>(state.stream_id(),
-                                           this->state_size())});
-    return launch_action(*this, params, state, execute);
+        detail::ActionDiagnosticExecutor{store_.params<MemSpace::native>(),
+                                         tally_state});
+    launch_action(*this, params, state, execute);
+    reduce_private_counts(tally_state);
 }
 
 //---------------------------------------------------------------------------//
@@ -151,6 +151,7 @@ void copy_steps<MemSpace::host>(
     DS_ASSIGN(parent_id);
     DS_ASSIGN(track_step_count);
     DS_ASSIGN(step_length);
+    DS_ASSIGN(weight);
     DS_ASSIGN(particle);
     DS_ASSIGN(energy_deposition);
 
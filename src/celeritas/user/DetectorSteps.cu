@@ -156,6 +156,7 @@ void copy_steps<MemSpace::device>(
     DS_ASSIGN(parent_id);
     DS_ASSIGN(track_step_count);
     DS_ASSIGN(step_length);
+    DS_ASSIGN(weight);
     DS_ASSIGN(particle);
     DS_ASSIGN(energy_deposition);
 
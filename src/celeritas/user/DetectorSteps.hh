@@ -83,6 +83,7 @@ struct DetectorStepOutput
     PinnedVec<TrackId> parent_id;
     PinnedVec<size_type> track_step_count;
     PinnedVec<real_type> step_length;
+    PinnedVec<real_type> weight;
     PinnedVec<ParticleId> particle;
     PinnedVec<Energy> energy_deposition;
 
@@ -0,0 +1,284 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/MeshCalo.cc
+//---------------------------------------------------------------------------//
+#include "MeshCalo.hh"
+
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
+#include "corecel/io/EnumStringMapper.hh"
+#include "corecel/io/JsonPimpl.hh"
+#include "corecel/math/Algorithms.hh"
+
+#include "detail/MeshCaloImpl.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with mesh definition.
+ */
+MeshCalo::MeshCalo(std::string output_label,
+                   MeshCaloInput const& inp,
+                   size_type num_streams)
+    : output_label_{std::move(output_label)}, input_{inp}
+{
+    CELER_EXPECT(!output_label_.empty());
+    CELER_EXPECT(num_streams > 0);
+    CELER_VALIDATE(input_,
+                   << "invalid mesh calorimeter input: bounds must be "
+                      "increasing and bin counts must be positive");
+    if (input_.type == MeshType::cylindrical)
+    {
+        CELER_VALIDATE(input_.lower[0] >= 0,
+                       << "invalid lower radius " << input_.lower[0]
+                       << " for cylindrical mesh");
+        CELER_VALIDATE(input_.lower[1] >= -real_type(m_pi)
+                           && input_.upper[1] <= real_type(m_pi),
+                       << "invalid azimuthal bounds [" << input_.lower[1]
+                       << ", " << input_.upper[1]
+                       << "] for cylindrical mesh: must be within [-pi, pi]");
+    }
+
+    HostVal<MeshCaloParamsData> host_params;
+    host_params.type = input_.type;
+    host_params.origin = input_.origin;
+    host_params.max_private_bins = input_.max_private_bins;
+    for (auto ax : range(3))
+    {
+        host_params.axes[ax] = UniformGridData::from_bounds(
+            input_.lower[ax], input_.upper[ax], input_.num_bins[ax] + 1);
+    }
+    store_ = {std::move(host_params), num_streams};
+
+    CELER_ENSURE(store_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record all steps, filtering out those with no deposition.
+ */
+auto MeshCalo::filters() const -> Filters
+{
+    Filters result;
+    result.nonzero_energy_deposition = true;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save energy deposition and pre/post step positions.
+ */
+auto MeshCalo::selection() const -> StepSelection
+{
+    StepSelection result;
+    result.energy_deposition = true;
+    result.points[StepPoint::pre].pos = true;
+    result.points[StepPoint::post].pos = true;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Process mesh tallies (CPU).
+ */
+void MeshCalo::process_steps(HostStepState state)
+{
+    detail::mesh_calo_accum(
+        store_.params<MemSpace::host>(),
+        state.steps,
+        store_.state<MemSpace::host>(state.stream_id, state.steps.size()));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Process mesh tallies (GPU).
+ */
+void MeshCalo::process_steps(DeviceStepState state)
+{
+    detail::mesh_calo_accum(
+        store_.params<MemSpace::device>(),
+        state.steps,
+        store_.state<MemSpace::device>(state.stream_id, state.steps.size()));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write output to the given JSON object.
+ */
+void MeshCalo::output(JsonPimpl* j) const
+{
+    using json = nlohmann::json;
+
+    auto obj = json::object();
+
+    // Save mesh definition
+    {
+        auto const& p = input_;
+        obj["type"] = to_cstring(p.type);
+        obj["origin"] = std::vector<real_type>(p.origin.begin(),
+                                               p.origin.end());
+        auto axes = json::array();
+        for (auto ax : range(3))
+        {
+            axes.push_back({
+                {"lower", p.lower[ax]},
+                {"upper", p.upper[ax]},
+                {"num_bins", p.num_bins[ax]},
+            });
+        }
+        obj["axes"] = std::move(axes);
+    }
+
+    // Save results
+    {
+        obj["energy_deposition"] = this->calc_total_energy_deposition();
+        obj["_units"] = {
+            {"energy_deposition", EnergyUnits::label()},
+        };
+    }
+
+    j->obj = std::move(obj);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get tallied stream-local data.
+ */
+template<MemSpace M>
+auto MeshCalo::energy_deposition(StreamId stream_id) const -> BinRef<M> const&
+{
+    CELER_EXPECT(stream_id < store_.num_streams());
+    auto* result = store_.state<M>(stream_id);
+    CELER_VALIDATE(result,
+                   << "no mesh calo state is stored on " << to_cstring(M)
+                   << " for stream ID " << stream_id.get());
+    return result->energy_deposition;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get accumulated energy deposition over all streams.
+ *
+ * The index in the vector is the row-major mesh bin index. Thread-private
+ * tallies that have not yet been reduced are included.
+ */
+auto MeshCalo::calc_total_energy_deposition() const -> VecReal
+{
+    VecReal result(this->num_bins(), real_type{0});
+
+    accumulate_over_streams(
+        store_, [](auto& state) { return state.energy_deposition; }, &result);
+    for (StreamId s : range(StreamId{store_.num_streams()}))
+    {
+        if (auto* state = store_.state<MemSpace::host>(s))
+        {
+            accumulate_private_tally(state->private_edep, make_span(result));
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the mesh definition.
+ */
+template<MemSpace M>
+auto MeshCalo::params_ref() const -> ParamsRef<M> const&
+{
+    return store_.params<M>();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get stream-local data for depositing energy directly.
+ *
+ * This allocates the state if needed.
+ */
+template<MemSpace M>
+auto MeshCalo::state_ref(StreamId stream_id, size_type num_track_slots)
+    -> StateRef<M>&
+{
+    CELER_EXPECT(stream_id < store_.num_streams());
+    return store_.state<M>(stream_id, num_track_slots);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sum thread-private tallies into the stream-local results.
+ *
+ * This is needed only before reading \c energy_deposition for a stream, and
+ * should be called once at the end of an event or run rather than every step.
+ */
+void MeshCalo::reduce()
+{
+    using AllEnergy = AllItems<real_type, MemSpace::host>;
+    for (StreamId s : range(StreamId{store_.num_streams()}))
+    {
+        if (auto* state = store_.state<MemSpace::host>(s))
+        {
+            reduce_private_tally(state->private_edep,
+                                 state->energy_deposition[AllEnergy{}]);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reset energy deposition to zero, usually at the start of an event.
+ */
+void MeshCalo::clear()
+{
+    apply_to_all_streams(store_, [](auto& state) {
+        fill(real_type(0), &state.energy_deposition);
+        if (state.private_edep)
+        {
+            fill(real_type(0), &state.private_edep.values);
+        }
+    });
+}
+
+//---------------------------------------------------------------------------//
+// EXPLICIT INSTANTIATION
+//---------------------------------------------------------------------------//
+
+template MeshCalo::BinRef<MemSpace::host> const&
+    MeshCalo::energy_deposition<MemSpace::host>(StreamId) const;
+template MeshCalo::BinRef<MemSpace::device> const&
+    MeshCalo::energy_deposition<MemSpace::device>(StreamId) const;
+
+template MeshCalo::ParamsRef<MemSpace::host> const&
+    MeshCalo::params_ref<MemSpace::host>() const;
+template MeshCalo::ParamsRef<MemSpace::device> const&
+    MeshCalo::params_ref<MemSpace::device>() const;
+
+template MeshCalo::StateRef<MemSpace::host>&
+    MeshCalo::state_ref<MemSpace::host>(StreamId, size_type);
+template MeshCalo::StateRef<MemSpace::device>&
+    MeshCalo::state_ref<MemSpace::device>(StreamId, size_type);
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Get a string corresponding to a mesh type.
+ */
+char const* to_cstring(MeshType value)
+{
+    static EnumStringMapper<MeshType> const to_cstring_impl{
+        "cartesian",
+        "cylindrical",
+    };
+    return to_cstring_impl(value);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
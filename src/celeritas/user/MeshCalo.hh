@@ -0,0 +1,168 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/MeshCalo.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/data/StreamStore.hh"
+#include "corecel/io/OutputInterface.hh"
+#include "geocel/Types.hh"
+#include "celeritas/Quantities.hh"
+
+#include "MeshCaloData.hh"
+#include "StepInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Input for a mesh energy deposition scorer.
+ *
+ * Each axis is divided into \c num_bins equal bins between \c lower and \c
+ * upper . For cylindrical meshes the axes are (r, phi, z): radii must be
+ * nonnegative and azimuthal bounds are in radians inside \f$[-\pi, \pi]\f$.
+ *
+ * With track-level OpenMP parallelism, meshes with at most \c
+ * max_private_bins bins are tallied into a private copy per thread; larger
+ * meshes are tallied with atomics to bound the memory and reduction cost.
+ */
+struct MeshCaloInput
+{
+    MeshType type{MeshType::cartesian};
+    Real3 origin{0, 0, 0};
+    Real3 lower{0, 0, 0};
+    Real3 upper{0, 0, 0};
+    Array<size_type, 3> num_bins{0, 0, 0};
+    size_type max_private_bins{size_type(1) << 16};
+
+    //! Whether the input is valid
+    explicit operator bool() const
+    {
+        return type != MeshType::size_ && num_bins[0] > 0 && num_bins[1] > 0
+               && num_bins[2] > 0 && lower[0] < upper[0]
+               && lower[1] < upper[1] && lower[2] < upper[2];
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate energy deposition on a Cartesian or cylindrical mesh.
+ *
+ * The energy deposited in each step is divided among the mesh bins crossed by
+ * the straight line between the pre- and post-step points, proportionally to
+ * the path length in each bin. The mesh is independent of the geometry, so
+ * this interface records every step and cannot be combined in a single
+ * collector with interfaces (such as \c SimpleCalo ) that filter by detector.
+ *
+ * Thread-private tallies are not summed after each step: \c
+ * calc_total_energy_deposition includes them, and \c reduce must be called
+ * (e.g., at the end of an event) before reading stream-local results.
+ */
+class MeshCalo final : public StepInterface, public OutputInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using EnergyUnits = units::Mev;
+    template<MemSpace M>
+    using BinRef = celeritas::Collection<real_type, Ownership::reference, M>;
+    template<MemSpace M>
+    using ParamsRef = MeshCaloParamsData<Ownership::const_reference, M>;
+    template<MemSpace M>
+    using StateRef = MeshCaloStateData<Ownership::reference, M>;
+    using VecReal = std::vector<real_type>;
+    //!@}
+
+  public:
+    // Construct with all requirements
+    MeshCalo(std::string output_label,
+             MeshCaloInput const& inp,
+             size_type max_streams);
+
+    //! Construct with default label
+    MeshCalo(MeshCaloInput const& inp, size_type max_streams)
+        : MeshCalo{"mesh_calo", inp, max_streams}
+    {
+    }
+
+    //!@{
+    //! \name Step interface
+    // Record all steps
+    Filters filters() const final;
+    // Save energy deposition and pre/post step positions
+    StepSelection selection() const final;
+    // Process CPU-generated hits
+    void process_steps(HostStepState) final;
+    // Process device-generated hits
+    void process_steps(DeviceStepState) final;
+    //!@}
+
+    //!@{
+    //! \name Output interface
+    // Category of data to write
+    Category category() const final { return Category::result; }
+    // Key for the entry inside the category.
+    std::string_view label() const final { return output_label_; }
+    // Write output to the given JSON object
+    void output(JsonPimpl*) const final;
+    //!@}
+
+    //// ACCESSORS ////
+
+    //! Mesh definition
+    MeshCaloInput const& input() const { return input_; }
+
+    //! Total number of mesh bins
+    size_type num_bins() const
+    {
+        return input_.num_bins[0] * input_.num_bins[1] * input_.num_bins[2];
+    }
+
+    // Get tallied stream-local data (throw if not available) [EnergyUnits]
+    template<MemSpace M>
+    BinRef<M> const& energy_deposition(StreamId) const;
+
+    // Get accumulated energy deposition over all streams and host/device
+    VecReal calc_total_energy_deposition() const;
+
+    // Get the mesh definition
+    template<MemSpace M>
+    ParamsRef<M> const& params_ref() const;
+
+    //// MUTATORS ////
+
+    // Get stream-local data for depositing energy directly
+    template<MemSpace M>
+    StateRef<M>& state_ref(StreamId, size_type num_track_slots);
+
+    // Sum thread-private tallies into the stream-local results
+    void reduce();
+
+    // Reset energy deposition to zero, usually at the start of an event
+    void clear();
+
+  private:
+    using StoreT = StreamStore<MeshCaloParamsData, MeshCaloStateData>;
+
+    std::string output_label_;
+    MeshCaloInput input_;
+    StoreT store_;
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+// Get a string corresponding to a mesh type
+char const* to_cstring(MeshType value);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
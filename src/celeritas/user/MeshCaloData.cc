@@ -0,0 +1,54 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/MeshCaloData.cc
+//---------------------------------------------------------------------------//
+#include "MeshCaloData.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
+#include "corecel/data/CollectionBuilder.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Resize based on the number of mesh bins.
+ *
+ * Thread-private copies are only allocated for small meshes: large meshes use
+ * atomic additions to the shared tally.
+ */
+template<MemSpace M>
+void resize(MeshCaloStateData<Ownership::value, M>* state,
+            HostCRef<MeshCaloParamsData> const& params,
+            StreamId,
+            size_type num_track_slots)
+{
+    CELER_EXPECT(params);
+    resize(&state->energy_deposition, params.size());
+    fill(real_type(0), &state->energy_deposition);
+    if (params.size() <= params.max_private_bins)
+    {
+        resize(&state->private_edep,
+               params.size(),
+               num_private_tally_threads());
+    }
+    state->num_track_slots = num_track_slots;
+    CELER_ENSURE(*state);
+}
+
+//---------------------------------------------------------------------------//
+
+template void resize(MeshCaloStateData<Ownership::value, MemSpace::host>*,
+                     HostCRef<MeshCaloParamsData> const&,
+                     StreamId,
+                     size_type);
+template void resize(MeshCaloStateData<Ownership::value, MemSpace::device>*,
+                     HostCRef<MeshCaloParamsData> const&,
+                     StreamId,
+                     size_type);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,143 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/MeshCaloData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/data/PrivateTallyData.hh"
+#include "corecel/grid/UniformGridData.hh"
+#include "corecel/sys/ThreadId.hh"
+#include "geocel/Types.hh"
+#include "celeritas/Quantities.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Coordinate system of a scoring mesh.
+ *
+ * Cartesian meshes are binned in (x, y, z) and cylindrical meshes in (r, phi,
+ * z) about an axis parallel to z. Azimuthal bounds are in radians on
+ * \f$[-\pi, \pi]\f$.
+ */
+enum class MeshType
+{
+    cartesian,
+    cylindrical,
+    size_
+};
+
+//---------------------------------------------------------------------------//
+//! Mesh definition for energy deposition scoring.
+template<Ownership W, MemSpace M>
+struct MeshCaloParamsData
+{
+    //// DATA ////
+
+    MeshType type{MeshType::size_};
+    Real3 origin{0, 0, 0};  //!< Mesh coordinates are relative to this point
+    Array<UniformGridData, 3> axes;  //!< Bin edges along each coordinate
+    size_type max_private_bins{0};  //!< Largest mesh tallied per thread
+
+    //// METHODS ////
+
+    //! Whether the data is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return type != MeshType::size_ && axes[0] && axes[1] && axes[2];
+    }
+
+    //! Number of bins along an axis
+    CELER_FUNCTION size_type num_bins(size_type axis) const
+    {
+        CELER_EXPECT(axis < 3);
+        return axes[axis].size - 1;
+    }
+
+    //! Total number of mesh bins
+    CELER_FUNCTION size_type size() const
+    {
+        return this->num_bins(0) * this->num_bins(1) * this->num_bins(2);
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    MeshCaloParamsData& operator=(MeshCaloParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        type = other.type;
+        origin = other.origin;
+        axes = other.axes;
+        max_private_bins = other.max_private_bins;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulated energy deposition in each mesh bin for a single stream.
+ *
+ * Bins are indexed in row-major order over the three mesh axes.
+ */
+template<Ownership W, MemSpace M>
+struct MeshCaloStateData
+{
+    //// TYPES ////
+
+    template<class T>
+    using Items = celeritas::Collection<T, W, M>;
+    using EnergyUnits = units::Mev;
+
+    //// DATA ////
+
+    // Energy indexed by mesh bin
+    Items<real_type> energy_deposition;
+
+    // Per-thread energy for track-parallel host execution (small meshes)
+    PrivateTallyData<real_type, W, M> private_edep;
+
+    // Number of track slots (unused during calculation)
+    size_type num_track_slots{};
+
+    //// METHODS ////
+
+    //! Number of states
+    CELER_FUNCTION size_type size() const { return num_track_slots; }
+
+    //! True if constructed
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !energy_deposition.empty() && num_track_slots > 0;
+    }
+
+    //! Assign from another set of states
+    template<Ownership W2, MemSpace M2>
+    MeshCaloStateData& operator=(MeshCaloStateData<W2, M2>& other)
+    {
+        energy_deposition = other.energy_deposition;
+        private_edep = other.private_edep;
+        num_track_slots = other.num_track_slots;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+// Resize based on the number of mesh bins
+template<MemSpace M>
+void resize(MeshCaloStateData<Ownership::value, M>* state,
+            HostCRef<MeshCaloParamsData> const& params,
+            StreamId,
+            size_type num_track_slots);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
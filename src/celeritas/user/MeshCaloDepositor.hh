@@ -0,0 +1,108 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/MeshCaloDepositor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/PrivateTally.hh"
+#include "corecel/math/Algorithms.hh"
+#include "geocel/Types.hh"
+
+#include "MeshCaloData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Deposit energy at points on a mesh calorimeter.
+ *
+ * This is used by actions (such as parameterized showers) that score energy
+ * directly into a \c MeshCalo rather than through step data. Deposits outside
+ * the mesh are ignored. On host, per-thread tallies of small meshes are
+ * summed by \c MeshCalo::reduce .
+ */
+class MeshCaloDepositor
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using ParamsRef = NativeCRef<MeshCaloParamsData>;
+    using StateRef = NativeRef<MeshCaloStateData>;
+    //!@}
+
+  public:
+    // Construct with mesh definition and stream-local tally
+    inline CELER_FUNCTION
+    MeshCaloDepositor(ParamsRef const& params, StateRef& state);
+
+    // Deposit energy at a point, returning whether it is inside the mesh
+    inline CELER_FUNCTION bool operator()(Real3 const& pos, real_type edep);
+
+  private:
+    ParamsRef const& params_;
+    PrivateTally<real_type> add_edep_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with mesh definition and stream-local tally.
+ */
+CELER_FUNCTION
+MeshCaloDepositor::MeshCaloDepositor(ParamsRef const& params, StateRef& state)
+    : params_{params}
+    , add_edep_{state.private_edep,
+                state.energy_deposition[AllItems<real_type>{}]}
+{
+    CELER_EXPECT(params_ && state);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Deposit energy at a point, returning whether it is inside the mesh.
+ */
+CELER_FUNCTION bool
+MeshCaloDepositor::operator()(Real3 const& pos, real_type edep)
+{
+    Real3 coords;
+    for (auto ax : range(3))
+    {
+        coords[ax] = pos[ax] - params_.origin[ax];
+    }
+    if (params_.type == MeshType::cylindrical)
+    {
+        real_type const r = std::sqrt(ipow<2>(coords[0]) + ipow<2>(coords[1]));
+        coords[1] = std::atan2(coords[1], coords[0]);
+        coords[0] = r;
+    }
+
+    size_type bin = 0;
+    for (auto ax : range(3))
+    {
+        auto const& grid = params_.axes[ax];
+        if (!(coords[ax] >= grid.front && coords[ax] < grid.back))
+        {
+            return false;
+        }
+        auto index = static_cast<size_type>(
+            std::floor((coords[ax] - grid.front) / grid.delta));
+        bin = bin * params_.num_bins(ax)
+              + celeritas::min(index, params_.num_bins(ax) - 1);
+    }
+
+    add_edep_(bin, edep);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,75 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/MeshCaloIO.json.cc
+//---------------------------------------------------------------------------//
+#include "MeshCaloIO.json.hh"
+
+#include <string>
+
+#include "corecel/cont/ArrayIO.json.hh"
+#include "corecel/io/JsonUtils.json.hh"
+#include "corecel/io/StringEnumMapper.hh"
+
+#include "MeshCalo.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Read mesh type from JSON.
+ */
+void from_json(nlohmann::json const& j, MeshType& value)
+{
+    static auto const from_string
+        = StringEnumMapper<MeshType>::from_cstring_func(to_cstring,
+                                                        "mesh type");
+    value = from_string(j.get<std::string>());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write mesh type to JSON.
+ */
+void to_json(nlohmann::json& j, MeshType const& value)
+{
+    j = std::string{to_cstring(value)};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read options from JSON.
+ */
+void from_json(nlohmann::json const& j, MeshCaloInput& options)
+{
+#define MCI_LOAD_OPTION(NAME) CELER_JSON_LOAD_OPTION(j, options, NAME)
+#define MCI_LOAD_REQUIRED(NAME) CELER_JSON_LOAD_REQUIRED(j, options, NAME)
+    MCI_LOAD_OPTION(type);
+    MCI_LOAD_OPTION(origin);
+    MCI_LOAD_REQUIRED(lower);
+    MCI_LOAD_REQUIRED(upper);
+    MCI_LOAD_REQUIRED(num_bins);
+    MCI_LOAD_OPTION(max_private_bins);
+#undef MCI_LOAD_OPTION
+#undef MCI_LOAD_REQUIRED
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write options to JSON.
+ */
+void to_json(nlohmann::json& j, MeshCaloInput const& options)
+{
+    j = nlohmann::json::object();
+    CELER_JSON_SAVE(j, options, type);
+    CELER_JSON_SAVE(j, options, origin);
+    CELER_JSON_SAVE(j, options, lower);
+    CELER_JSON_SAVE(j, options, upper);
+    CELER_JSON_SAVE(j, options, num_bins);
+    CELER_JSON_SAVE(j, options, max_private_bins);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
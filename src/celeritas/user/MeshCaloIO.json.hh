@@ -0,0 +1,33 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/MeshCaloIO.json.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include "MeshCaloData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+struct MeshCaloInput;
+
+//---------------------------------------------------------------------------//
+// Read mesh type from JSON
+void from_json(nlohmann::json const& j, MeshType& value);
+
+// Write mesh type to JSON
+void to_json(nlohmann::json& j, MeshType const& value);
+
+// Read options from JSON
+void from_json(nlohmann::json const& j, MeshCaloInput& opts);
+
+// Write options to JSON
+void to_json(nlohmann::json& j, MeshCaloInput const& opts);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
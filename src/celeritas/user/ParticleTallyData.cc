@@ -26,6 +26,20 @@ inline void resize(ParticleTallyStateData<Ownership::value, M>* state,
     CELER_EXPECT(params);
     resize(&state->counts, params.num_bins * params.num_particles);
     fill(size_type(0), &state->counts);
+    resize(&state->private_counts,
+           state->counts.size(),
+           num_private_tally_threads());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sum thread-private counts into the shared counts.
+ */
+void reduce_private_counts(HostRef<ParticleTallyStateData>& state)
+{
+    CELER_EXPECT(state);
+    reduce_private_tally(state.private_counts,
+                         state.counts[AllItems<size_type, MemSpace::host>{}]);
 }
 
 //---------------------------------------------------------------------------//
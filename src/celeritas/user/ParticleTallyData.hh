@@ -9,6 +9,7 @@
 
 #include "corecel/Macros.hh"
 #include "corecel/data/Collection.hh"
+#include "corecel/data/PrivateTallyData.hh"
 
 namespace celeritas
 {
@@ -50,7 +51,9 @@ struct ParticleTallyParamsData
 /*!
  * State data for accumulating results for each particle type.
  *
- * \c counts is indexed as particle_id * num_bins + bin_index.
+ * \c counts is indexed as particle_id * num_bins + bin_index. With
+ * track-level OpenMP parallelism, host threads tally into \c private_counts,
+ * which are reduced into \c counts after each launch.
  */
 template<Ownership W, MemSpace M>
 struct ParticleTallyStateData
@@ -63,6 +66,7 @@ struct ParticleTallyStateData
     //// DATA ////
 
     Items<size_type> counts;
+    PrivateTallyData<size_type, W, M> private_counts;
 
     //// METHODS ////
 
@@ -78,6 +82,7 @@ struct ParticleTallyStateData
     {
         CELER_EXPECT(other);
         counts = other.counts;
+        private_counts = other.private_counts;
         return *this;
     }
 };
@@ -92,5 +97,8 @@ void resize(ParticleTallyStateData<Ownership::value, M>* state,
             StreamId,
             size_type);
 
+// Sum thread-private counts into the shared counts
+void reduce_private_counts(HostRef<ParticleTallyStateData>& state);
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -83,12 +83,13 @@ auto SimpleCalo::filters() const -> Filters
 
 //---------------------------------------------------------------------------//
 /*!
- * Only save energy deposition and pre-step volume.
+ * Only save energy deposition, track weight, and pre-step volume.
  */
 auto SimpleCalo::selection() const -> StepSelection
 {
     StepSelection result;
     result.energy_deposition = true;
+    result.weight = true;
     result.points[StepPoint::pre].volume_id = true;
     return result;
 }
@@ -29,6 +29,9 @@ class GeoParamsInterface;
 /*!
  * Accumulate energy deposition in volumes.
  *
+ * Each step's deposition is multiplied by the statistical weight of the
+ * track, so that the tallies remain unbiased when variance reduction is used.
+ *
  * \todo Add a "begin run" interface to set up the stream store, rather than
  * passing in number of streams at construction time.
  */
@@ -64,7 +67,7 @@ class SimpleCalo final : public StepInterface, public OutputInterface
     //! \name Step interface
     // Map volume names to detector IDs and exclude tracks with no deposition
     Filters filters() const final;
-    // Save energy deposition and pre-step volume
+    // Save weighted energy deposition and pre-step volume
     StepSelection selection() const final;
     // Process CPU-generated hits
     void process_steps(HostStepState) final;
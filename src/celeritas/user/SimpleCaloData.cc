@@ -26,6 +26,9 @@ void resize(SimpleCaloStateData<Ownership::value, M>* state,
     CELER_EXPECT(params);
     resize(&state->energy_deposition, params.num_detectors);
     fill(real_type(0), &state->energy_deposition);
+    resize(&state->private_edep,
+           params.num_detectors,
+           num_private_tally_threads());
     state->num_track_slots = num_track_slots;
     CELER_ENSURE(*state);
 }
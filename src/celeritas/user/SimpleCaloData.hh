@@ -10,6 +10,7 @@
 #include "corecel/Assert.hh"
 #include "corecel/Macros.hh"
 #include "corecel/data/Collection.hh"
+#include "corecel/data/PrivateTallyData.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/Types.hh"
@@ -58,6 +59,9 @@ struct SimpleCaloStateData
     // Energy indexed by detector ID
     DetItems<real_type> energy_deposition;
 
+    // Per-thread energy for track-parallel host execution
+    PrivateTallyData<real_type, W, M> private_edep;
+
     // Number of track slots (unused during calculation)
     size_type num_track_slots{};
 
@@ -77,6 +81,7 @@ struct SimpleCaloStateData
     SimpleCaloStateData& operator=(SimpleCaloStateData<W2, M2>& other)
     {
         energy_deposition = other.energy_deposition;
+        private_edep = other.private_edep;
         num_track_slots = other.num_track_slots;
         return *this;
     }
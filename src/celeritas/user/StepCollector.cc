@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <map>
+#include <string>
 #include <type_traits>
 #include <utility>
 
@@ -27,6 +28,9 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Construct and add to core params.
+ *
+ * User post-step actions that kill or modify tracks must be created before
+ * the collector.
  */
 std::shared_ptr<StepCollector>
 StepCollector::make_and_insert(CoreParams const& core, VecInterface callbacks)
@@ -40,6 +44,10 @@ StepCollector::make_and_insert(CoreParams const& core, VecInterface callbacks)
 //---------------------------------------------------------------------------//
 /*!
  * Construct with options and register pre and/or post-step actions.
+ *
+ * Multiple collectors can be created, e.g. to combine sensitive detectors
+ * with unfiltered step output. The actions and auxiliary data of each
+ * additional collector are labeled with its index.
  */
 StepCollector::StepCollector(SPConstGeo geo,
                              VecInterface&& callbacks,
@@ -55,8 +63,16 @@ StepCollector::StepCollector(SPConstGeo geo,
     CELER_EXPECT(aux_registry);
     CELER_EXPECT(action_registry);
 
+    // Every collector has a post-step action: use it to count collectors
+    std::string suffix;
+    for (int i = 1; action_registry->find_action("step-gather-post" + suffix);
+         ++i)
+    {
+        suffix = "-" + std::to_string(i);
+    }
+
     params_ = std::make_shared<detail::StepParams>(
-        aux_registry->next_id(), *geo, callbacks);
+        aux_registry->next_id(), "detector-step" + suffix, *geo, callbacks);
     aux_registry->insert(params_);
 
     if (this->selection().points[StepPoint::pre] || params_->has_detectors())
@@ -64,13 +80,19 @@ StepCollector::StepCollector(SPConstGeo geo,
         // Some pre-step data is being gathered
         pre_action_
             = std::make_shared<detail::StepGatherAction<StepPoint::pre>>(
-                action_registry->next_id(), params_, VecInterface{});
+                action_registry->next_id(),
+                "step-gather-pre" + suffix,
+                params_,
+                VecInterface{});
         action_registry->insert(pre_action_);
     }
 
     // Always add post-step action, and add callbacks to it
     post_action_ = std::make_shared<detail::StepGatherAction<StepPoint::post>>(
-        action_registry->next_id(), params_, std::move(callbacks));
+        action_registry->next_id(),
+        "step-gather-post" + suffix,
+        params_,
+        std::move(callbacks));
     action_registry->insert(post_action_);
 }
 
@@ -37,10 +37,10 @@ class StepParams;
  * interfacing with the GPU track states at the beginning and/or end of every
  * step.
  *
- * \todo The step collector serves two purposes: supporting "sensitive
+ * A step collector serves one of two purposes: supporting "sensitive
  * detectors" (mapping volume IDs to detector IDs and ignoring unmapped
- * volumes) and supporting unfiltered output for "MC truth" . Right now only
- * one or the other can be used, not both.
+ * volumes) or supporting unfiltered output for "MC truth" and mesh scoring.
+ * To use both, create a separate collector for each.
  */
 class StepCollector
 {
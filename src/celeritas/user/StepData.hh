@@ -81,6 +81,7 @@ struct StepSelection
     bool step_length{false};
     bool particle{false};
     bool energy_deposition{false};
+    bool weight{false};
 
     //! Create StepSelection with all options set to true
     static constexpr StepSelection all()
@@ -93,6 +94,7 @@ struct StepSelection
             true,
             true,
             true,
+            true,
             true};
     }
 
@@ -101,7 +103,7 @@ struct StepSelection
     {
         return points[StepPoint::pre] || points[StepPoint::post] || event_id
                || parent_id || track_step_count || action_id || step_length
-               || particle || energy_deposition;
+               || particle || energy_deposition || weight;
     }
 
     //! Combine the selection with another
@@ -119,6 +121,7 @@ struct StepSelection
         this->step_length |= other.step_length;
         this->particle |= other.particle;
         this->energy_deposition |= other.energy_deposition;
+        this->weight |= other.weight;
         return *this;
     }
 };
@@ -260,6 +263,7 @@ struct StepStateDataImpl
     StateItems<ActionId> action_id;
     StateItems<size_type> track_step_count;
     StateItems<real_type> step_length;
+    StateItems<real_type> weight;  //!< Statistical weight over the step
 
     // Physics
     StateItems<ParticleId> particle;
@@ -278,7 +282,7 @@ struct StepStateDataImpl
                && right_sized(event_id) && right_sized(parent_id)
                && right_sized(track_step_count) && right_sized(action_id)
                && right_sized(step_length) && right_sized(particle)
-               && right_sized(energy_deposition);
+               && right_sized(energy_deposition) && right_sized(weight);
     }
 
     //! State size
@@ -307,6 +311,7 @@ struct StepStateDataImpl
         track_step_count = other.track_step_count;
         action_id = other.action_id;
         step_length = other.step_length;
+        weight = other.weight;
         particle = other.particle;
         energy_deposition = other.energy_deposition;
         return *this;
@@ -456,6 +461,7 @@ inline void resize(StepStateDataImpl<Ownership::value, M>* state,
     SD_RESIZE_IF_SELECTED(parent_id);
     SD_RESIZE_IF_SELECTED(track_step_count);
     SD_RESIZE_IF_SELECTED(step_length);
+    SD_RESIZE_IF_SELECTED(weight);
     SD_RESIZE_IF_SELECTED(action_id);
     SD_RESIZE_IF_SELECTED(particle);
     SD_RESIZE_IF_SELECTED(energy_deposition);
@@ -84,14 +84,15 @@ StepDiagnostic::~StepDiagnostic() = default;
  */
 void StepDiagnostic::step(CoreParams const& params, CoreStateHost& state) const
 {
+    auto& tally_state = store_.state<MemSpace::host>(state.stream_id(),
+                                                     this->state_size());
     auto execute = make_active_track_executor(
         params.ptr<MemSpace::native>(),
         state.ptr(),
-        detail::StepDiagnosticExecutor{
-            store_.params<MemSpace::native>(),
-            store_.state<MemSpace::native>(state.stream_id(),
-                                           this->state_size())});
-    return launch_action(*this, params, state, execute);
+        detail::StepDiagnosticExecutor{store_.params<MemSpace::native>(),
+                                       tally_state});
+    launch_action(*this, params, state, execute);
+    reduce_private_counts(tally_state);
 }
 
 //---------------------------------------------------------------------------//
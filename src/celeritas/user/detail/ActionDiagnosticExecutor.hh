@@ -9,7 +9,7 @@
 
 #include "corecel/Assert.hh"
 #include "corecel/Macros.hh"
-#include "corecel/math/Atomics.hh"
+#include "corecel/data/PrivateTally.hh"
 #include "celeritas/global/CoreTrackView.hh"
 
 #include "../ParticleTallyData.hh"
@@ -50,17 +50,16 @@ ActionDiagnosticExecutor::operator()(CoreTrackView const& track)
     CELER_EXPECT(params);
     CELER_EXPECT(state);
 
-    using BinId = ItemId<size_type>;
-
     auto action = track.make_sim_view().post_step_action();
     CELER_ASSERT(action);
     auto particle = track.make_particle_view().particle_id();
     CELER_ASSERT(particle);
 
-    BinId bin{particle.unchecked_get() * params.num_bins
-              + action.unchecked_get()};
-    CELER_ASSERT(bin < state.counts.size());
-    celeritas::atomic_add(&state.counts[bin], size_type(1));
+    size_type bin = particle.unchecked_get() * params.num_bins
+                    + action.unchecked_get();
+    PrivateTally<size_type> add_count{state.private_counts,
+                                      state.counts[AllItems<size_type>{}]};
+    add_count(bin, size_type{1});
 }
 
 //---------------------------------------------------------------------------//
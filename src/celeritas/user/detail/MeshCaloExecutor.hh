@@ -0,0 +1,82 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/detail/MeshCaloExecutor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <type_traits>
+
+#include "corecel/Types.hh"
+#include "corecel/data/PrivateTally.hh"
+
+#include "MeshSegmentTraverser.hh"
+#include "../MeshCaloData.hh"
+#include "../StepData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// LAUNCHER
+//---------------------------------------------------------------------------//
+/*!
+ * Distribute the energy deposited in each step over mesh bins.
+ *
+ * We do not remap any threads, so the track slot ID should be the thread ID.
+ */
+struct MeshCaloExecutor
+{
+    NativeCRef<MeshCaloParamsData> const params;
+    NativeRef<StepStateData> const step;
+    NativeRef<MeshCaloStateData> calo;
+
+    inline CELER_FUNCTION void operator()(TrackSlotId tid);
+    CELER_FORCEINLINE_FUNCTION void operator()(ThreadId tid)
+    {
+        return (*this)(TrackSlotId{tid.unchecked_get()});
+    }
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate energy along the step chord on each thread.
+ */
+CELER_FUNCTION void MeshCaloExecutor::operator()(TrackSlotId tid)
+{
+    CELER_EXPECT(tid < step.data.track_id.size());
+    CELER_EXPECT(!step.data.energy_deposition.empty());
+
+    if (!step.data.track_id[tid])
+    {
+        // Inactive track slot
+        return;
+    }
+
+    static_assert(
+        std::is_same_v<NativeRef<StepStateDataImpl>::Energy::unit_type,
+                       NativeRef<MeshCaloStateData>::EnergyUnits>);
+    real_type edep = step.data.energy_deposition[tid].value();
+    if (edep == 0)
+    {
+        return;
+    }
+
+    PrivateTally<real_type> add_edep{
+        calo.private_edep, calo.energy_deposition[AllItems<real_type>{}]};
+    MeshSegmentTraverser traverse{params,
+                                  step.data.points[StepPoint::pre].pos[tid],
+                                  step.data.points[StepPoint::post].pos[tid]};
+    traverse([&add_edep, edep](size_type bin, real_type frac) {
+        add_edep(bin, frac * edep);
+    });
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,49 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/detail/MeshCaloImpl.cc
+//---------------------------------------------------------------------------//
+#include "MeshCaloImpl.hh"
+
+#include "corecel/Config.hh"
+
+#include "corecel/Types.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
+#include "corecel/sys/ThreadId.hh"
+
+#include "MeshCaloExecutor.hh"  // IWYU pragma: associated
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate mesh energy deposition on host.
+ *
+ * Thread-private tallies are reduced by \c MeshCalo rather than after every
+ * step.
+ */
+void mesh_calo_accum(HostCRef<MeshCaloParamsData> const& params,
+                     HostRef<StepStateData> const& step,
+                     HostRef<MeshCaloStateData>& calo)
+{
+    CELER_EXPECT(params && step && calo);
+    MultiExceptionHandler capture_exception;
+    MeshCaloExecutor execute{params, step, calo};
+    size_type const size = step.size();
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel for
+#endif
+    for (ThreadId::size_type i = 0; i < size; ++i)
+    {
+        CELER_TRY_HANDLE(execute(ThreadId{i}), capture_exception);
+    }
+    log_and_rethrow(std::move(capture_exception));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
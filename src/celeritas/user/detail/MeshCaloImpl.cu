@@ -0,0 +1,37 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/detail/MeshCaloImpl.cu
+//---------------------------------------------------------------------------//
+#include "MeshCaloImpl.hh"
+
+#include "corecel/Types.hh"
+#include "corecel/sys/KernelLauncher.device.hh"
+
+#include "MeshCaloExecutor.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate mesh energy deposition on device.
+ */
+void mesh_calo_accum(DeviceCRef<MeshCaloParamsData> const& params,
+                     DeviceRef<StepStateData> const& step,
+                     DeviceRef<MeshCaloStateData>& calo)
+{
+    CELER_EXPECT(params && step && calo);
+
+    MeshCaloExecutor execute_thread{params, step, calo};
+    static KernelLauncher<decltype(execute_thread)> const launch_kernel(
+        "mesh-calo-accum");
+    launch_kernel(step.size(), step.stream_id, execute_thread);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
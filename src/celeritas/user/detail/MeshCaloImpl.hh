@@ -0,0 +1,40 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/detail/MeshCaloImpl.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+
+#include "../MeshCaloData.hh"
+#include "../StepData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+void mesh_calo_accum(HostCRef<MeshCaloParamsData> const& params,
+                     HostRef<StepStateData> const& step,
+                     HostRef<MeshCaloStateData>& calo);
+
+void mesh_calo_accum(DeviceCRef<MeshCaloParamsData> const& params,
+                     DeviceRef<StepStateData> const& step,
+                     DeviceRef<MeshCaloStateData>& calo);
+
+#if !CELER_USE_DEVICE
+inline void mesh_calo_accum(DeviceCRef<MeshCaloParamsData> const&,
+                            DeviceRef<StepStateData> const&,
+                            DeviceRef<MeshCaloStateData>&)
+{
+    CELER_NOT_CONFIGURED("CUDA or HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,490 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/detail/MeshSegmentTraverser.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/math/NumericLimits.hh"
+
+#include "../MeshCaloData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Split a straight step segment into the mesh bins it crosses.
+ *
+ * The segment from \c start to \c stop is parameterized by \em t in [0, 1].
+ * Starting from the bin containing the start point, the traverser finds the
+ * next boundary crossing along each axis, advances the bin index of the first
+ * axis crossed, and calls the tally function with the flattened bin index and
+ * the fraction of the segment inside that bin. Portions of the segment outside
+ * the mesh are skipped.
+ *
+ * Like a voxel DDA, bin indices are updated incrementally rather than
+ * recalculated from positions, so points on a bin boundary are never
+ * misassigned. Each axis index ranges from -1 (below the mesh) to \em n
+ * (above it). The azimuthal axis of a cylindrical mesh wraps around if it
+ * spans the full circle.
+ *
+ * Since the step is treated as a chord, energy from curved (field or
+ * multiple-scattering) steps is distributed along the straight line between
+ * the pre- and post-step points.
+ */
+class MeshSegmentTraverser
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using ParamsRef = NativeCRef<MeshCaloParamsData>;
+    //!@}
+
+  public:
+    // Construct with mesh and segment endpoints
+    inline CELER_FUNCTION MeshSegmentTraverser(ParamsRef const& params,
+                                               Real3 const& start,
+                                               Real3 const& stop);
+
+    // Call tally(bin, fraction) for each mesh bin along the segment
+    template<class F>
+    inline CELER_FUNCTION void operator()(F&& tally);
+
+  private:
+    //// TYPES ////
+
+    using Int3 = Array<int, 3>;
+
+    //! Next crossing along one axis
+    struct Crossing
+    {
+        real_type t;
+        int step;  //!< Change in index: +1 or -1
+    };
+
+    //// DATA ////
+
+    ParamsRef const& params_;
+    Real3 start_;
+    Real3 delta_;
+    Int3 index_;
+
+    //// HELPER FUNCTIONS ////
+
+    static CELER_CONSTEXPR_FUNCTION real_type inf()
+    {
+        return numeric_limits<real_type>::infinity();
+    }
+
+    inline CELER_FUNCTION bool is_cylindrical() const;
+    inline CELER_FUNCTION bool is_full_circle() const;
+    inline CELER_FUNCTION Real3 position(real_type t) const;
+    inline CELER_FUNCTION real_type coordinate(size_type ax, real_type t) const;
+    inline CELER_FUNCTION real_type slope(size_type ax, real_type t) const;
+    inline CELER_FUNCTION int find_index(size_type ax) const;
+    inline CELER_FUNCTION real_type edge(size_type ax, int i) const;
+    inline CELER_FUNCTION Crossing next_linear(size_type ax) const;
+    inline CELER_FUNCTION Crossing next_radial(real_type t) const;
+    inline CELER_FUNCTION Crossing next_azimuthal(real_type t) const;
+    inline CELER_FUNCTION void advance(size_type ax, int step);
+    inline CELER_FUNCTION bool is_inside() const;
+    inline CELER_FUNCTION size_type flat_index() const;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with mesh and segment endpoints.
+ */
+CELER_FUNCTION
+MeshSegmentTraverser::MeshSegmentTraverser(ParamsRef const& params,
+                                           Real3 const& start,
+                                           Real3 const& stop)
+    : params_(params)
+{
+    CELER_EXPECT(params_);
+    for (auto ax : range(3))
+    {
+        start_[ax] = start[ax] - params_.origin[ax];
+        delta_[ax] = stop[ax] - start[ax];
+    }
+    for (auto ax : range(size_type{3}))
+    {
+        index_[ax] = this->find_index(ax);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Call tally(bin, fraction) for each mesh bin along the segment.
+ */
+template<class F>
+CELER_FUNCTION void MeshSegmentTraverser::operator()(F&& tally)
+{
+    // Each axis boundary is crossed at most twice by a straight line
+    size_type remaining = 2
+                              * (params_.axes[0].size + params_.axes[1].size
+                                 + params_.axes[2].size)
+                          + 1;
+    real_type t = 0;
+    while (remaining-- > 0)
+    {
+        // Find the first axis boundary crossed
+        Crossing next{inf(), 0};
+        size_type next_ax = 0;
+        for (auto ax : range(size_type{3}))
+        {
+            Crossing c;
+            if (this->is_cylindrical() && ax == 0)
+            {
+                c = this->next_radial(t);
+            }
+            else if (this->is_cylindrical() && ax == 1)
+            {
+                c = this->next_azimuthal(t);
+            }
+            else
+            {
+                c = this->next_linear(ax);
+            }
+            if (c.t < next.t)
+            {
+                next = c;
+                next_ax = ax;
+            }
+        }
+
+        real_type t_end = celeritas::min(next.t, real_type{1});
+        if (this->is_inside() && t_end > t)
+        {
+            tally(this->flat_index(), t_end - t);
+        }
+        if (!(next.t < 1))
+        {
+            return;
+        }
+        t = t_end;
+        this->advance(next_ax, next.step);
+    }
+}
+
+//---------------------------------------------------------------------------//
+//! Whether the mesh uses (r, phi, z) coordinates
+CELER_FUNCTION bool MeshSegmentTraverser::is_cylindrical() const
+{
+    return params_.type == MeshType::cylindrical;
+}
+
+//---------------------------------------------------------------------------//
+//! Whether the azimuthal bins span the full circle
+CELER_FUNCTION bool MeshSegmentTraverser::is_full_circle() const
+{
+    constexpr real_type tol = 8 * numeric_limits<real_type>::epsilon();
+    auto const& grid = params_.axes[1];
+    return grid.back - grid.front >= real_type(2 * m_pi) * (1 - tol);
+}
+
+//---------------------------------------------------------------------------//
+//! Position along the segment relative to the mesh origin
+CELER_FUNCTION Real3 MeshSegmentTraverser::position(real_type t) const
+{
+    return {start_[0] + t * delta_[0],
+            start_[1] + t * delta_[1],
+            start_[2] + t * delta_[2]};
+}
+
+//---------------------------------------------------------------------------//
+//! Mesh coordinate along the segment
+CELER_FUNCTION real_type MeshSegmentTraverser::coordinate(size_type ax,
+                                                          real_type t) const
+{
+    Real3 pos = this->position(t);
+    if (this->is_cylindrical() && ax == 0)
+    {
+        return std::sqrt(ipow<2>(pos[0]) + ipow<2>(pos[1]));
+    }
+    if (this->is_cylindrical() && ax == 1)
+    {
+        return std::atan2(pos[1], pos[0]);
+    }
+    return pos[ax];
+}
+
+//---------------------------------------------------------------------------//
+//! Sign of the rate of change of a mesh coordinate along the segment
+CELER_FUNCTION real_type MeshSegmentTraverser::slope(size_type ax,
+                                                     real_type t) const
+{
+    Real3 pos = this->position(t);
+    if (this->is_cylindrical() && ax == 0)
+    {
+        return pos[0] * delta_[0] + pos[1] * delta_[1];
+    }
+    if (this->is_cylindrical() && ax == 1)
+    {
+        return pos[0] * delta_[1] - pos[1] * delta_[0];
+    }
+    return delta_[ax];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the initial bin index along an axis.
+ *
+ * A start point exactly on an edge is assigned to the bin the segment moves
+ * into.
+ */
+CELER_FUNCTION int MeshSegmentTraverser::find_index(size_type ax) const
+{
+    auto const& grid = params_.axes[ax];
+    int const num_bins = static_cast<int>(grid.size) - 1;
+    real_type const value = this->coordinate(ax, 0);
+
+    int result;
+    if (value < grid.front)
+    {
+        result = -1;
+    }
+    else if (value >= grid.back)
+    {
+        result = num_bins;
+    }
+    else
+    {
+        result = celeritas::min(
+            static_cast<int>(std::floor((value - grid.front) / grid.delta)),
+            num_bins - 1);
+    }
+    if (this->slope(ax, 0) < 0 && result >= 0
+        && value == this->edge(ax, result))
+    {
+        // Moving downward from an edge
+        --result;
+    }
+    if (this->is_cylindrical() && ax == 1 && this->is_full_circle())
+    {
+        // Wrap azimuthal index
+        result = (result + num_bins) % num_bins;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+//! Lower edge of bin i along an axis
+CELER_FUNCTION real_type MeshSegmentTraverser::edge(size_type ax, int i) const
+{
+    auto const& grid = params_.axes[ax];
+    if (i + 1 == static_cast<int>(grid.size))
+    {
+        return grid.back;
+    }
+    return grid.front + i * grid.delta;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Next crossing along a Cartesian coordinate.
+ */
+CELER_FUNCTION auto MeshSegmentTraverser::next_linear(size_type ax) const
+    -> Crossing
+{
+    auto const& grid = params_.axes[ax];
+    int const i = index_[ax];
+    int const num_bins = static_cast<int>(grid.size) - 1;
+    real_type const d = delta_[ax];
+    if (d > 0 && i < num_bins)
+    {
+        return {(this->edge(ax, i + 1) - start_[ax]) / d, +1};
+    }
+    if (d < 0 && i >= 0)
+    {
+        return {(this->edge(ax, i) - start_[ax]) / d, -1};
+    }
+    return {inf(), 0};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Next crossing of a cylinder of constant radius.
+ *
+ * The radius along a line decreases to its closest approach and then
+ * increases, so moving inward the next crossing is the first intersection
+ * with the inner radius (if it is reached) and otherwise the second
+ * intersection with the outer radius.
+ */
+CELER_FUNCTION auto MeshSegmentTraverser::next_radial(real_type t) const
+    -> Crossing
+{
+    auto const& grid = params_.axes[0];
+    int const i = index_[0];
+    int const num_bins = static_cast<int>(grid.size) - 1;
+
+    real_type const a = ipow<2>(delta_[0]) + ipow<2>(delta_[1]);
+    if (a == 0)
+    {
+        return {inf(), 0};
+    }
+    real_type const b = start_[0] * delta_[0] + start_[1] * delta_[1];
+    real_type const c0 = ipow<2>(start_[0]) + ipow<2>(start_[1]);
+
+    // Roots of |start + t delta|_{xy} = radius
+    auto calc_roots = [&](real_type radius, real_type* lo, real_type* hi) {
+        real_type disc = b * b - a * (c0 - ipow<2>(radius));
+        if (disc < 0)
+        {
+            return false;
+        }
+        real_type sq = std::sqrt(disc);
+        *lo = (-b - sq) / a;
+        *hi = (-b + sq) / a;
+        return true;
+    };
+
+    real_type lo;
+    real_type hi;
+    if (this->slope(0, t) < 0 && i >= 0)
+    {
+        // Moving inward: check for intersection with the inner radius
+        real_type inner = this->edge(0, i);
+        if (inner > 0 && calc_roots(inner, &lo, &hi) && lo >= t)
+        {
+            return {lo, -1};
+        }
+    }
+    if (i < num_bins)
+    {
+        // Exit through the outer radius
+        if (calc_roots(this->edge(0, i + 1), &lo, &hi) && hi >= t)
+        {
+            return {hi, +1};
+        }
+    }
+    return {inf(), 0};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Next crossing of a half-plane of constant azimuth.
+ *
+ * The azimuth along a line is monotonic, so only the edge in the direction of
+ * rotation can be crossed.
+ */
+CELER_FUNCTION auto MeshSegmentTraverser::next_azimuthal(real_type t) const
+    -> Crossing
+{
+    auto const& grid = params_.axes[1];
+    int const i = index_[1];
+    int const num_bins = static_cast<int>(grid.size) - 1;
+    bool const outside = (i < 0 || i >= num_bins);
+
+    real_type const rotation = this->slope(1, t);
+    if (rotation == 0)
+    {
+        return {inf(), 0};
+    }
+
+    // Counterclockwise motion crosses the upper edge; outside the mesh the
+    // "upper" edge is the front of the grid
+    real_type phi;
+    int step;
+    if (rotation > 0)
+    {
+        phi = outside ? grid.front : this->edge(1, i + 1);
+        step = +1;
+    }
+    else
+    {
+        phi = outside ? grid.back : this->edge(1, i);
+        step = -1;
+    }
+
+    real_type sinphi;
+    real_type cosphi;
+    sincos(phi, &sinphi, &cosphi);
+    real_type denom = cosphi * delta_[1] - sinphi * delta_[0];
+    if (denom == 0)
+    {
+        return {inf(), 0};
+    }
+    real_type t_cross = (sinphi * start_[0] - cosphi * start_[1]) / denom;
+    Real3 pos = this->position(t_cross);
+    if (t_cross < t || cosphi * pos[0] + sinphi * pos[1] <= 0)
+    {
+        // Line crosses the opposite half-plane or is moving away
+        return {inf(), 0};
+    }
+    return {t_cross, step};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move to the adjacent bin along an axis.
+ */
+CELER_FUNCTION void MeshSegmentTraverser::advance(size_type ax, int step)
+{
+    CELER_EXPECT(step == 1 || step == -1);
+    int const num_bins = static_cast<int>(params_.axes[ax].size) - 1;
+    int& i = index_[ax];
+    if (this->is_cylindrical() && ax == 1)
+    {
+        if (this->is_full_circle())
+        {
+            i = (i + step + num_bins) % num_bins;
+        }
+        else if (i < 0 || i >= num_bins)
+        {
+            // Enter from outside the azimuthal range
+            i = (step > 0 ? 0 : num_bins - 1);
+        }
+        else
+        {
+            i += step;
+        }
+        return;
+    }
+    i += step;
+    CELER_ENSURE(i >= -1 && i <= num_bins);
+}
+
+//---------------------------------------------------------------------------//
+//! Whether the current bin is inside the mesh
+CELER_FUNCTION bool MeshSegmentTraverser::is_inside() const
+{
+    for (auto ax : range(size_type{3}))
+    {
+        if (index_[ax] < 0
+            || index_[ax] >= static_cast<int>(params_.num_bins(ax)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+//! Row-major index of the current bin
+CELER_FUNCTION size_type MeshSegmentTraverser::flat_index() const
+{
+    CELER_EXPECT(this->is_inside());
+    return (static_cast<size_type>(index_[0]) * params_.num_bins(1)
+            + static_cast<size_type>(index_[1]))
+               * params_.num_bins(2)
+           + static_cast<size_type>(index_[2]);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -10,7 +10,7 @@
 #include <type_traits>
 
 #include "corecel/Types.hh"
-#include "corecel/math/Atomics.hh"
+#include "corecel/data/PrivateTally.hh"
 
 #include "../SimpleCaloData.hh"
 #include "../StepData.hh"
@@ -62,8 +62,14 @@ CELER_FUNCTION void SimpleCaloExecutor::operator()(TrackSlotId tid)
                        NativeRef<SimpleCaloStateData>::EnergyUnits>);
     real_type edep = step.data.energy_deposition[tid].value();
     CELER_ASSERT(edep > 0);
-    CELER_ASSERT(det < calo.energy_deposition.size());
-    atomic_add(&calo.energy_deposition[det], edep);
+    if (!step.data.weight.empty())
+    {
+        // Tally the statistically weighted deposition
+        edep *= step.data.weight[tid];
+    }
+    PrivateTally<real_type> add_edep{
+        calo.private_edep, calo.energy_deposition[AllItems<real_type>{}]};
+    add_edep(det.unchecked_get(), edep);
 }
 
 //---------------------------------------------------------------------------//
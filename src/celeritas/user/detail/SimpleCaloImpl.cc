@@ -38,6 +38,10 @@ void simple_calo_accum(HostRef<StepStateData> const& step,
         CELER_TRY_HANDLE(execute(ThreadId{i}), capture_exception);
     }
     log_and_rethrow(std::move(capture_exception));
+
+    reduce_private_tally(
+        calo.private_edep,
+        calo.energy_deposition[AllItems<real_type, MemSpace::host>{}]);
 }
 
 //---------------------------------------------------------------------------//
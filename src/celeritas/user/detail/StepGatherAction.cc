@@ -34,11 +34,16 @@ namespace detail
  */
 template<StepPoint P>
 StepGatherAction<P>::StepGatherAction(ActionId id,
+                                      std::string label,
                                       SPConstStepParams params,
                                       VecInterface callbacks)
-    : id_(id), params_(std::move(params)), callbacks_(std::move(callbacks))
+    : id_(id)
+    , label_(std::move(label))
+    , params_(std::move(params))
+    , callbacks_(std::move(callbacks))
 {
     CELER_EXPECT(id_);
+    CELER_EXPECT(!label_.empty());
     CELER_EXPECT(!callbacks_.empty() || P == StepPoint::pre);
     CELER_EXPECT(params_);
 
@@ -44,8 +44,9 @@ class StepGatherAction final : public CoreStepActionInterface
     //!@}
 
   public:
-    // Construct with action ID and storage
+    // Construct with action ID, label, and storage
     StepGatherAction(ActionId id,
+                     std::string label,
                      SPConstStepParams params,
                      VecInterface callbacks);
 
@@ -59,12 +60,7 @@ class StepGatherAction final : public CoreStepActionInterface
     ActionId action_id() const final { return id_; }
 
     //! Short name for the action
-    std::string_view label() const final
-    {
-        return P == StepPoint::pre    ? "step-gather-pre"
-               : P == StepPoint::post ? "step-gather-post"
-                                      : std::string_view{};
-    }
+    std::string_view label() const final { return label_; }
 
     // Name of the action (for user output)
     std::string_view description() const final { return description_; }
@@ -81,6 +77,7 @@ class StepGatherAction final : public CoreStepActionInterface
     //// DATA ////
 
     ActionId id_;
+    std::string label_;
     SPConstStepParams params_;
     VecInterface callbacks_;
     std::string description_;
@@ -137,6 +137,11 @@ StepGatherExecutor<P>::fill(celeritas::CoreTrackView const& track)
             SGL_SET_IF_SELECTED(action_id, sim.post_step_action());
             SGL_SET_IF_SELECTED(step_length, sim.step_length());
         }
+        else
+        {
+            // Save the weight before any post-step variance reduction
+            SGL_SET_IF_SELECTED(weight, sim.weight());
+        }
     }
 
     {
@@ -0,0 +1,37 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/detail/StepGatherUtils.cc
+//---------------------------------------------------------------------------//
+#include "StepGatherUtils.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/sys/ActionRegistry.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Check that a user post-step action is inserted before any step collector.
+ *
+ * User post-step actions are executed in the order they are registered. An
+ * action that kills or modifies tracks must run before the post-step gather
+ * action so that step data reflect its changes in the same step, regardless
+ * of the order in which the user created them.
+ */
+void validate_before_step_gather(ActionRegistry const& actions,
+                                 std::string_view label)
+{
+    CELER_VALIDATE(!actions.find_action("step-gather-post"),
+                   << "action '" << label
+                   << "' must be created before the step collector so that "
+                      "collected post-step data include its changes");
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,25 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/detail/StepGatherUtils.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string_view>
+
+namespace celeritas
+{
+class ActionRegistry;
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// Check that a user post-step action is inserted before any step collector
+void validate_before_step_gather(ActionRegistry const& actions,
+                                 std::string_view label);
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "StepParams.hh"
 
+#include <utility>
 #include <vector>
 
 #include "corecel/data/AuxStateData.hh"
@@ -26,11 +27,13 @@ namespace detail
  * Construct from data IDs and interfaces.
  */
 StepParams::StepParams(AuxId aux_id,
+                       std::string label,
                        GeoParams const& geo,
                        VecInterface const& callbacks)
-    : aux_id_{aux_id}
+    : aux_id_{aux_id}, label_{std::move(label)}
 {
     CELER_EXPECT(aux_id_);
+    CELER_EXPECT(!label_.empty());
 
     enum class HasDetectors
     {
@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <string>
+
 #include "corecel/data/AuxInterface.hh"
 #include "corecel/data/CollectionMirror.hh"
 #include "corecel/data/ParamsDataInterface.hh"
@@ -41,13 +43,14 @@ class StepParams : public ParamsDataInterface<StepParamsData>,
   public:
     // Construct from data IDs and interfaces
     StepParams(AuxId aux_id,
+               std::string label,
                GeoParams const& geo,
                VecInterface const& interfaces);
 
     //!@{
     //! \name Aux interface
     //! Short name for the aux data
-    std::string_view label() const final { return "detector-step"; }
+    std::string_view label() const final { return label_; }
     //! Index of this class instance in its registry
     AuxId aux_id() const final { return aux_id_; }
     // Build core state data for a stream
@@ -74,6 +77,7 @@ class StepParams : public ParamsDataInterface<StepParamsData>,
 
   private:
     AuxId aux_id_;
+    std::string label_;
     CollectionMirror<StepParamsData> mirror_;
 };
 
@@ -99,6 +99,7 @@ CELER_FUNCTION void StepScratchCopyExecutor::operator()(ThreadId dst_id)
     DS_COPY_IF_SELECTED(parent_id);
     DS_COPY_IF_SELECTED(track_step_count);
     DS_COPY_IF_SELECTED(step_length);
+    DS_COPY_IF_SELECTED(weight);
     DS_COPY_IF_SELECTED(particle);
     DS_COPY_IF_SELECTED(energy_deposition);
 #undef DS_COPY_IF_SELECTED
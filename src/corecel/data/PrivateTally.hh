@@ -0,0 +1,97 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/PrivateTally.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/math/Atomics.hh"
+
+#include "PrivateTallyData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Add to a tally bin without contention between host threads.
+ *
+ * With track-level OpenMP parallelism, each thread adds to its own private
+ * copy of the tally, which must be reduced into the shared values with \c
+ * reduce_private_tally after the parallel loop. If private data is unavailable
+ * (on device, or with a single thread) this is an atomic add to the shared
+ * value.
+ *
+ * \code
+   PrivateTally<real_type> add_edep{state.private_edep, edep_span};
+   add_edep(det.unchecked_get(), value);
+   \endcode
+ */
+template<class T>
+class PrivateTally
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using DataRef = PrivateTallyData<T, Ownership::reference, MemSpace::native>;
+    using SpanT = Span<T>;
+    //!@}
+
+  public:
+    // Construct with private data and shared tally
+    inline CELER_FUNCTION PrivateTally(DataRef const& data, SpanT shared);
+
+    // Add to a bin
+    inline CELER_FUNCTION void operator()(size_type bin, T value) const;
+
+  private:
+    DataRef const& data_;
+    SpanT shared_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with private data and shared tally.
+ */
+template<class T>
+CELER_FUNCTION
+PrivateTally<T>::PrivateTally(DataRef const& data, SpanT shared)
+    : data_{data}, shared_{shared}
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add to a bin.
+ */
+template<class T>
+CELER_FUNCTION void PrivateTally<T>::operator()(size_type bin, T value) const
+{
+    CELER_EXPECT(bin < shared_.size());
+#if !CELER_DEVICE_COMPILE
+    if (data_)
+    {
+#    if defined(_OPENMP) && CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+        auto thread = static_cast<size_type>(omp_get_thread_num());
+#    else
+        size_type thread = 0;
+#    endif
+        if (thread < data_.num_threads)
+        {
+            data_.values[ItemId<T>{thread * data_.stride + bin}] += value;
+            return;
+        }
+    }
+#endif
+    atomic_add(&shared_[bin], value);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
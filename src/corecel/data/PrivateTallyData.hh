@@ -0,0 +1,163 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/PrivateTallyData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Config.hh"
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/math/Algorithms.hh"
+
+#include "Collection.hh"
+#include "CollectionAlgorithms.hh"
+#include "CollectionBuilder.hh"
+
+#if defined(_OPENMP) && CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    include <omp.h>
+#endif
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Per-thread copies of a tally for track-parallel host execution.
+ *
+ * Each host thread accumulates into its own block of \c stride values, which
+ * is padded to a multiple of a cache line so that neighboring threads don't
+ * share lines. The blocks are summed into the shared tally with \c
+ * reduce_private_tally . The data is empty (and tallies fall back to atomics)
+ * on device and when only one host thread is available.
+ */
+template<class T, Ownership W, MemSpace M>
+struct PrivateTallyData
+{
+    //// DATA ////
+
+    Collection<T, W, M> values;  //!< [thread][bin]
+    size_type stride{0};  //!< Padded number of bins per thread
+    size_type num_threads{0};  //!< Number of private copies
+
+    //// METHODS ////
+
+    //! Whether the data is assigned
+    explicit CELER_FUNCTION operator bool() const { return num_threads > 0; }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    PrivateTallyData& operator=(PrivateTallyData<T, W2, M2>& other)
+    {
+        values = other.values;
+        stride = other.stride;
+        num_threads = other.num_threads;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Number of host threads that may concurrently add to a tally.
+ */
+inline size_type num_private_tally_threads()
+{
+#if defined(_OPENMP) && CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+    return static_cast<size_type>(omp_get_max_threads());
+#else
+    return 1;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate thread-private tallies in host code.
+ *
+ * Storage is only allocated for host memory with more than one thread.
+ */
+template<class T, MemSpace M>
+inline void resize(PrivateTallyData<T, Ownership::value, M>* data,
+                   size_type num_bins,
+                   size_type num_threads)
+{
+    CELER_EXPECT(data);
+    CELER_EXPECT(num_bins > 0);
+    if (M != MemSpace::host || num_threads <= 1)
+    {
+        *data = {};
+        return;
+    }
+
+    constexpr size_type cache_line_bytes{64};
+    constexpr size_type per_line = max<size_type>(
+        1, cache_line_bytes / static_cast<size_type>(sizeof(T)));
+    data->stride = ceil_div(num_bins, per_line) * per_line;
+    data->num_threads = num_threads;
+    resize(&data->values, data->stride * num_threads);
+    fill(T{0}, &data->values);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sum thread-private tallies into the shared values and reset them.
+ */
+template<class T>
+inline void reduce_private_tally(
+    PrivateTallyData<T, Ownership::reference, MemSpace::host>& data,
+    Span<T> shared)
+{
+    if (!data)
+    {
+        return;
+    }
+    CELER_EXPECT(shared.size() <= data.stride);
+
+    auto values = data.values[AllItems<T, MemSpace::host>{}];
+    size_type const num_bins = shared.size();
+#if defined(_OPENMP) && CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel for
+#endif
+    for (size_type bin = 0; bin < num_bins; ++bin)
+    {
+        T total = shared[bin];
+        for (size_type t = 0; t < data.num_threads; ++t)
+        {
+            T& private_value = values[t * data.stride + bin];
+            total += private_value;
+            private_value = T{0};
+        }
+        shared[bin] = total;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add unreduced thread-private tallies to a result without modifying them.
+ */
+template<class T>
+inline void accumulate_private_tally(
+    PrivateTallyData<T, Ownership::reference, MemSpace::host> const& data,
+    Span<T> result)
+{
+    if (!data)
+    {
+        return;
+    }
+    CELER_EXPECT(result.size() <= data.stride);
+
+    auto values = data.values[AllItems<T, MemSpace::host>{}];
+    for (size_type t = 0; t < data.num_threads; ++t)
+    {
+        for (size_type bin = 0; bin < result.size(); ++bin)
+        {
+            result[bin] += values[t * data.stride + bin];
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
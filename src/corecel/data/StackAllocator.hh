@@ -89,6 +89,14 @@ namespace celeritas
  * These separate kernel launches are needed as grid-level synchronization
  * points.
  *
+ * If the data was resized for multiple host threads, each thread reserves a
+ * chunk of the stack with a single atomic add and then allocates from it
+ * locally, so that threads creating secondaries don't all contend on the
+ * shared size. Requests larger than a chunk, and requests made after the
+ * stack is too full for another chunk, fall back to the shared allocation.
+ * Because chunks may be partially filled, \c size() and \c get() include
+ * default-constructed gaps between allocations.
+ *
  * \todo Instead of returning a pointer, return IdRange<T>. Rename
  * StackAllocatorData to StackAllocation and have it look like a collection so
  * that *it* will provide access to the data. Better yet, have a
@@ -141,6 +149,12 @@ class StackAllocator
     using SizeId = ItemId<size_type>;
     using StorageId = ItemId<T>;
     static CELER_CONSTEXPR_FUNCTION SizeId size_id() { return SizeId{0}; }
+
+    // Allocate from the shared stack
+    inline CELER_FUNCTION result_type allocate_shared(size_type count);
+
+    // Allocate from a thread-local chunk
+    inline CELER_FUNCTION result_type allocate_chunked(size_type count);
 };
 
 //---------------------------------------------------------------------------//
@@ -180,6 +194,10 @@ template<class T>
 CELER_FUNCTION void StackAllocator<T>::clear()
 {
     data_.size[this->size_id()] = 0;
+    for (size_type i = 0; i < data_.chunks.size(); ++i)
+    {
+        data_.chunks[SizeId{i}] = 0;
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -195,6 +213,26 @@ StackAllocator<T>::operator()(size_type count) -> result_type
 {
     CELER_EXPECT(count > 0);
 
+#if !CELER_DEVICE_COMPILE
+    if (!data_.chunks.empty())
+    {
+        if (value_type* result = this->allocate_chunked(count))
+        {
+            return result;
+        }
+    }
+#endif
+    return this->allocate_shared(count);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate space for a given number of items from the shared stack.
+ */
+template<class T>
+CELER_FUNCTION auto
+StackAllocator<T>::allocate_shared(size_type count) -> result_type
+{
     // Atomic add 'count' to the shared size
     size_type start = atomic_add(&data_.size[this->size_id()], count);
     if (CELER_UNLIKELY(start + count > data_.storage.size()))
@@ -236,6 +274,62 @@ StackAllocator<T>::operator()(size_type count) -> result_type
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate space from the calling thread's chunk.
+ *
+ * When the current chunk is exhausted, a new one is reserved and
+ * default-constructed in its entirety, so that any unused remainder is a
+ * "null" item. Returns NULL if the request should instead be satisfied by the
+ * shared stack.
+ */
+template<class T>
+CELER_FUNCTION auto
+StackAllocator<T>::allocate_chunked(size_type count) -> result_type
+{
+#if defined(_OPENMP) && CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+    auto thread = static_cast<size_type>(omp_get_thread_num());
+#else
+    size_type thread = 0;
+#endif
+    SizeId const next_id{thread * data_.chunk_stride};
+    SizeId const end_id{thread * data_.chunk_stride + 1};
+    if (!(end_id < data_.chunks.size()) || count > data_.chunk_size)
+    {
+        return nullptr;
+    }
+
+    size_type& next = data_.chunks[next_id];
+    size_type& end = data_.chunks[end_id];
+    if (next + count > end)
+    {
+        // Reserve a new chunk
+        size_type const chunk = data_.chunk_size;
+        size_type start = atomic_add(&data_.size[this->size_id()], chunk);
+        if (CELER_UNLIKELY(start + chunk > this->capacity()))
+        {
+            // Restore the size as in the shared allocation and fall back to
+            // it, since the remaining storage might fit this request
+            if (start <= this->capacity())
+            {
+                data_.size[this->size_id()] = start;
+            }
+            next = end = 0;
+            return nullptr;
+        }
+        for (size_type i = 0; i < chunk; ++i)
+        {
+            new (&data_.storage[StorageId{start + i}]) value_type;
+        }
+        next = start;
+        end = start + chunk;
+    }
+
+    value_type* result = &data_.storage[StorageId{next}];
+    next += count;
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get the number of items currently present.
@@ -7,24 +7,40 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "corecel/Config.hh"
+
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
+#include "corecel/math/Algorithms.hh"
 
 #include "Collection.hh"
 #include "CollectionAlgorithms.hh"
 #include "CollectionBuilder.hh"
 
+#if defined(_OPENMP) && CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    include <omp.h>
+#endif
+
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
  * Storage for a stack and its dynamic size.
+ *
+ * When host tracks are processed in parallel, each thread can reserve \c
+ * chunk_size contiguous items at a time with a single atomic operation and
+ * then allocate from its chunk without contention. The per-thread \c [next,
+ * end) chunk cursors are stored \c chunk_stride apart to keep them on
+ * separate cache lines. Chunking is disabled (\c chunks is empty) on device.
  */
 template<class T, Ownership W, MemSpace M>
 struct StackAllocatorData
 {
     celeritas::Collection<T, W, M> storage;  //!< Allocated capacity
     celeritas::Collection<size_type, W, M> size;  //!< Stored size
+    celeritas::Collection<size_type, W, M> chunks;  //!< [thread][next, end]
+    size_type chunk_size{0};  //!< Items reserved by a thread at a time
+    size_type chunk_stride{0};  //!< Padded spacing of thread cursors
 
     //! Whether the data is assigned
     explicit CELER_FUNCTION operator bool() const
@@ -42,22 +58,64 @@ struct StackAllocatorData
         CELER_EXPECT(other);
         storage = other.storage;
         size = other.size;
+        chunks = other.chunks;
+        chunk_size = other.chunk_size;
+        chunk_stride = other.chunk_stride;
         return *this;
     }
 };
 
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Number of host threads that may concurrently allocate from a stack.
+ */
+inline size_type num_stack_allocator_threads()
+{
+#if defined(_OPENMP) && CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+    return static_cast<size_type>(omp_get_max_threads());
+#else
+    return 1;
+#endif
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Resize a stack allocator in host code.
+ *
+ * With more than one host thread, per-thread chunked allocation is enabled if
+ * the capacity is large enough that the chunks reserved but not yet filled
+ * by each thread use at most a quarter of the storage.
  */
 template<class T, MemSpace M>
-inline void
-resize(StackAllocatorData<T, Ownership::value, M>* data, size_type capacity)
+inline void resize(StackAllocatorData<T, Ownership::value, M>* data,
+                   size_type capacity,
+                   size_type num_threads = 1)
 {
     CELER_EXPECT(capacity > 0);
+    CELER_EXPECT(num_threads > 0);
     resize(&data->storage, capacity);
     resize(&data->size, 1);
     celeritas::fill(size_type(0), &data->size);
+
+    constexpr size_type max_chunk_size{64};
+    size_type chunk_size
+        = celeritas::min(max_chunk_size, capacity / (4 * num_threads));
+    if (M != MemSpace::host || num_threads <= 1 || chunk_size <= 1)
+    {
+        data->chunks = {};
+        data->chunk_size = 0;
+        data->chunk_stride = 0;
+        return;
+    }
+
+    constexpr size_type cache_line_bytes{64};
+    data->chunk_size = chunk_size;
+    data->chunk_stride = celeritas::max<size_type>(
+        2, cache_line_bytes / static_cast<size_type>(sizeof(size_type)));
+    resize(&data->chunks, data->chunk_stride * num_threads);
+    celeritas::fill(size_type(0), &data->chunks);
 }
 
 //---------------------------------------------------------------------------//
@@ -106,7 +106,7 @@ namespace detail
  */
 void MultiExceptionHandler::operator()(std::exception_ptr p)
 {
-#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#if CELERITAS_USE_OPENMP
 #    pragma omp critical(MultiExceptionHandler)
 #endif
     {
@@ -0,0 +1,202 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/PerfEventCounters.cc
+//---------------------------------------------------------------------------//
+#include "PerfEventCounters.hh"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "corecel/Config.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/io/Logger.hh"
+
+#if defined(__linux__)
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/syscall.h>
+#    include <sys/types.h>
+#    include <unistd.h>
+#endif
+#if defined(_OPENMP) && CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    include <omp.h>
+#endif
+
+namespace celeritas
+{
+namespace
+{
+#if defined(__linux__)
+//---------------------------------------------------------------------------//
+/*!
+ * Open a disabled hardware counter for the given thread.
+ */
+int open_hw_counter(pid_t tid, std::uint64_t config, int group_fd)
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = (group_fd == -1 ? 1 : 0);
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+
+    return static_cast<int>(syscall(SYS_perf_event_open,
+                                    &attr,
+                                    tid,
+                                    /* cpu = */ -1,
+                                    group_fd,
+                                    /* flags = */ 0));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the kernel IDs of the calling thread and its OpenMP workers.
+ *
+ * The calling thread is always the first (OpenMP thread zero).
+ */
+std::vector<pid_t> get_thread_ids()
+{
+    std::vector<pid_t> result;
+#    if defined(_OPENMP) && CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+    result.resize(static_cast<std::size_t>(omp_get_max_threads()), -1);
+#        pragma omp parallel
+    {
+        auto thread = static_cast<std::size_t>(omp_get_thread_num());
+        if (thread < result.size())
+        {
+            result[thread] = static_cast<pid_t>(syscall(SYS_gettid));
+        }
+    }
+    result.erase(std::remove(result.begin(), result.end(), pid_t{-1}),
+                 result.end());
+#    else
+    result.push_back(static_cast<pid_t>(syscall(SYS_gettid)));
+#    endif
+    return result;
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Open counters for the calling thread and OpenMP workers.
+ */
+PerfEventCounters::PerfEventCounters()
+{
+#if defined(__linux__)
+    bool missing_misses{false};
+    for (pid_t tid : get_thread_ids())
+    {
+        Group g;
+        g.cycles_fd = open_hw_counter(tid, PERF_COUNT_HW_CPU_CYCLES, -1);
+        if (g.cycles_fd < 0)
+        {
+            break;
+        }
+        g.misses_fd
+            = open_hw_counter(tid, PERF_COUNT_HW_CACHE_MISSES, g.cycles_fd);
+        missing_misses = missing_misses || g.misses_fd < 0;
+        groups_.push_back(g);
+    }
+    if (groups_.empty())
+    {
+        CELER_LOG(warning) << "Hardware performance counters are unavailable "
+                              "(check /proc/sys/kernel/perf_event_paranoid)";
+        return;
+    }
+    if (missing_misses)
+    {
+        CELER_LOG(warning) << "Cache miss counter is unavailable: only CPU "
+                              "cycles will be counted";
+    }
+#    if defined(_OPENMP) && CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+    if (groups_.size() < static_cast<std::size_t>(omp_get_max_threads()))
+    {
+        CELER_LOG(warning) << "Hardware performance counters cover only "
+                           << groups_.size() << " of "
+                           << omp_get_max_threads() << " OpenMP threads";
+    }
+#    endif
+#else
+    CELER_LOG(warning) << "Hardware performance counters are only supported "
+                          "on Linux";
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Close counters.
+ */
+PerfEventCounters::~PerfEventCounters()
+{
+#if defined(__linux__)
+    for (Group const& g : groups_)
+    {
+        for (int fd : {g.misses_fd, g.cycles_fd})
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+        }
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reset and enable counters.
+ */
+void PerfEventCounters::start()
+{
+#if defined(__linux__)
+    for (Group const& g : groups_)
+    {
+        ioctl(g.cycles_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(g.cycles_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Disable and read counters, summing over all threads.
+ */
+auto PerfEventCounters::stop() -> Result
+{
+    Result result;
+#if defined(__linux__)
+    for (Group const& g : groups_)
+    {
+        ioctl(g.cycles_fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+        // Group read format: number of events followed by each value
+        std::uint64_t buffer[3] = {0, 0, 0};
+        auto nbytes = read(g.cycles_fd, buffer, sizeof(buffer));
+        if (nbytes < static_cast<decltype(nbytes)>(2 * sizeof(std::uint64_t)))
+        {
+            continue;
+        }
+        CELER_ASSERT(buffer[0] <= 2);
+        result.cycles += static_cast<std::size_t>(buffer[1]);
+        if (buffer[0] == 2)
+        {
+            result.cache_misses += static_cast<std::size_t>(buffer[2]);
+        }
+    }
+#endif
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,84 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/PerfEventCounters.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "corecel/Macros.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Read CPU hardware counters for the calling thread and its OpenMP workers.
+ *
+ * This uses the Linux \c perf_event_open system call to count CPU cycles and
+ * last-level cache misses between calls to \c start and \c stop. Counters are
+ * attached to the thread that constructs this object and, when built with
+ * track-level OpenMP parallelism, to each thread of an OpenMP team spawned at
+ * construction; the result is the sum over all threads. This relies on the
+ * OpenMP runtime reusing its worker threads for later parallel regions,
+ * which holds as long as the number of threads does not change. If the
+ * counters cannot
+ * be opened (a non-Linux platform, a restrictive \c perf_event_paranoid
+ * setting, or a container without access to the PMU) the instance is false
+ * and \c stop always returns zeros.
+ *
+ * \code
+   PerfEventCounters counters;
+   counters.start();
+   do_work();
+   auto result = counters.stop();
+   \endcode
+ */
+class PerfEventCounters
+{
+  public:
+    //! Counter values accumulated between start and stop
+    struct Result
+    {
+        std::size_t cycles{};
+        std::size_t cache_misses{};
+    };
+
+  public:
+    // Open counters for the calling thread and OpenMP workers
+    PerfEventCounters();
+
+    // Close counters
+    ~PerfEventCounters();
+
+    //! Prevent copying and moving
+    CELER_DELETE_COPY_MOVE(PerfEventCounters);
+
+    //! Whether hardware counters are available
+    explicit operator bool() const { return !groups_.empty(); }
+
+    //! Number of threads being counted
+    std::size_t num_threads() const { return groups_.size(); }
+
+    // Reset and enable counters
+    void start();
+
+    // Disable and read counters
+    Result stop();
+
+  private:
+    // File descriptors for a single thread: cycles lead the group
+    struct Group
+    {
+        int cycles_fd{-1};
+        int misses_fd{-1};
+    };
+
+    std::vector<Group> groups_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -45,6 +45,9 @@ struct GeoTraits
     //! Descriptive name for the geometry
     static constexpr inline char const* name = nullptr;
 
+    //! Whether host states can be navigated concurrently by multiple threads
+    static constexpr inline bool host_thread_safe = false;
+
     //! TO BE REMOVED: "native" file extension for this geometry
     static constexpr inline char const* ext = nullptr;
 };
@@ -70,6 +73,7 @@ struct NotConfiguredGeoTraits
     using StateData = void;
     using TrackView = void;
     static constexpr inline char const* name = nullptr;
+    static constexpr inline bool host_thread_safe = false;
     static constexpr inline char const* ext = nullptr;
 };
 
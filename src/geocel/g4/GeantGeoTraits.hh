@@ -43,6 +43,9 @@ struct GeoTraits<GeantGeoParams>
     //! Descriptive name for the geometry
     static constexpr inline char const* name = "Geant4";
 
+    //! Geant4 navigation relies on thread-local data set up by Geant4 workers
+    static constexpr inline bool host_thread_safe = false;
+
     //! TO BE REMOVED: "native" file extension for this geometry
     static constexpr inline char const* ext = ".gdml";
 };
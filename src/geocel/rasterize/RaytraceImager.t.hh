@@ -16,8 +16,10 @@
 
 #include "RaytraceImager.hh"
 
+#include "corecel/Config.hh"
+
 #include "corecel/data/CollectionStateStore.hh"
-#include "corecel/sys/KernelLauncher.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
 
 #include "Image.hh"
 
@@ -121,6 +123,11 @@ void RaytraceImager<G>::raytrace_impl(Image<M>* image)
 //---------------------------------------------------------------------------//
 /*!
  * Execute the raytrace on the host.
+ *
+ * Each image line has its own geometry state, so lines can be traced
+ * independently. If OpenMP is enabled and the geometry supports concurrent
+ * host navigation, lines are distributed dynamically among threads since the
+ * cost of each line depends strongly on the local geometry complexity.
  */
 template<class G>
 void RaytraceImager<G>::launch_raytrace_kernel(
@@ -132,9 +139,19 @@ void RaytraceImager<G>::launch_raytrace_kernel(
     using CalcId = detail::VolumeIdCalculator;
     using Executor = detail::RaytraceExecutor<GeoTrackView, CalcId>;
 
-    launch_kernel(
-        geo_states.size(),
-        Executor{geo_params, geo_states, img_params, img_state, CalcId{}});
+    Executor execute_thread{
+        geo_params, geo_states, img_params, img_state, CalcId{}};
+    size_type const num_lines = geo_states.size();
+
+    MultiExceptionHandler capture_exception;
+#if defined(_OPENMP) && CELERITAS_USE_OPENMP
+#    pragma omp parallel for schedule(dynamic) if (GTraits::host_thread_safe)
+#endif
+    for (size_type i = 0; i < num_lines; ++i)
+    {
+        CELER_TRY_HANDLE(execute_thread(ThreadId{i}), capture_exception);
+    }
+    log_and_rethrow(std::move(capture_exception));
 }
 
 //---------------------------------------------------------------------------//
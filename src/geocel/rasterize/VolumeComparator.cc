@@ -0,0 +1,225 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file geocel/rasterize/VolumeComparator.cc
+//---------------------------------------------------------------------------//
+#include "VolumeComparator.hh"
+
+#include <map>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/math/ArrayUtils.hh"
+
+#include "Image.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Sentinel for a reference volume that is missing from the tested geometry
+constexpr int missing_volume = -2;
+
+//! Sentinel for a label or name that occurs more than once
+constexpr int duplicate_volume = -3;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Map each key to its volume index, or to a sentinel if it is duplicated.
+ */
+template<class K, class F>
+std::map<K, int> make_volume_map(std::vector<Label> const& labels, F&& get_key)
+{
+    std::map<K, int> result;
+    for (auto i : range(labels.size()))
+    {
+        auto [iter, inserted]
+            = result.insert({get_key(labels[i]), static_cast<int>(i)});
+        if (!inserted)
+        {
+            iter->second = duplicate_volume;
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the unique volume for a key, or a sentinel.
+ */
+template<class K>
+int find_volume(std::map<K, int> const& volumes, K const& key)
+{
+    auto iter = volumes.find(key);
+    return iter != volumes.end() ? iter->second : missing_volume;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with volume labels of the reference and tested geometries.
+ */
+VolumeComparator::VolumeComparator(VecLabel expected_labels,
+                                   VecLabel actual_labels,
+                                   size_type max_mismatches)
+    : expected_labels_{std::move(expected_labels)}
+    , actual_labels_{std::move(actual_labels)}
+    , max_mismatches_{max_mismatches}
+{
+    auto get_label = [](Label const& l) { return l; };
+    auto get_name = [](Label const& l) { return l.name; };
+    auto expected_by_label
+        = make_volume_map<Label>(expected_labels_, get_label);
+    auto expected_by_name
+        = make_volume_map<std::string>(expected_labels_, get_name);
+    auto actual_by_label = make_volume_map<Label>(actual_labels_, get_label);
+    auto actual_by_name
+        = make_volume_map<std::string>(actual_labels_, get_name);
+
+    expected_to_actual_.resize(expected_labels_.size(), missing_volume);
+    for (auto i : range(expected_labels_.size()))
+    {
+        Label const& label = expected_labels_[i];
+        int actual = missing_volume;
+        if (find_volume(expected_by_label, label) >= 0)
+        {
+            actual = find_volume(actual_by_label, label);
+            if (actual == missing_volume
+                && find_volume(expected_by_name, label.name) >= 0)
+            {
+                // Extensions differ: fall back to a unique name
+                actual = find_volume(actual_by_name, label.name);
+            }
+        }
+        if (actual >= 0)
+        {
+            expected_to_actual_[i] = actual;
+        }
+        else
+        {
+            unmatched_.push_back(label);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compare two images traced with the same parameters.
+ */
+void VolumeComparator::operator()(ImageInterface const& expected,
+                                  ImageInterface const& actual,
+                                  VolumeComparison* result) const
+{
+    CELER_EXPECT(expected.params() && actual.params());
+    CELER_EXPECT(result);
+
+    auto const& params = *expected.params();
+    CELER_VALIDATE(params.scalars().dims == actual.params()->scalars().dims,
+                   << "cannot compare images with different dimensions");
+
+    std::vector<int> expected_ids(params.num_pixels());
+    std::vector<int> actual_ids(params.num_pixels());
+    expected.copy_to_host(make_span(expected_ids));
+    actual.copy_to_host(make_span(actual_ids));
+
+    auto const& scalars = params.scalars();
+    size_type const num_cols = scalars.dims[1];
+    for (auto i : range(expected_ids.size()))
+    {
+        if (this->is_same(expected_ids[i], actual_ids[i]))
+        {
+            continue;
+        }
+
+        // Locate the pixel center
+        auto row = i / num_cols;
+        auto col = i % num_cols;
+        Real3 pos = scalars.origin;
+        axpy((row + real_type(0.5)) * scalars.pixel_width, scalars.down, &pos);
+        axpy((col + real_type(0.5)) * scalars.pixel_width,
+             scalars.right,
+             &pos);
+        this->add_mismatch(pos, expected_ids[i], actual_ids[i], result);
+    }
+    result->num_samples += expected_ids.size();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compare volumes located at each point.
+ */
+void VolumeComparator::operator()(SpanConstPoint pos,
+                                  SpanConstInt expected,
+                                  SpanConstInt actual,
+                                  VolumeComparison* result) const
+{
+    CELER_EXPECT(expected.size() == pos.size());
+    CELER_EXPECT(actual.size() == pos.size());
+    CELER_EXPECT(result);
+
+    for (auto i : range(pos.size()))
+    {
+        if (!this->is_same(expected[i], actual[i]))
+        {
+            this->add_mismatch(pos[i], expected[i], actual[i], result);
+        }
+    }
+    result->num_samples += pos.size();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether two volume IDs refer to the same volume.
+ */
+bool VolumeComparator::is_same(int expected, int actual) const
+{
+    if (expected < 0 || actual < 0)
+    {
+        // Exterior (or untraced) pixels must both be outside
+        return (expected < 0) == (actual < 0);
+    }
+    CELER_ASSERT(static_cast<size_type>(expected) < expected_to_actual_.size());
+    return expected_to_actual_[expected] == actual;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the label of a volume ID.
+ */
+std::string VolumeComparator::volume_label(VecLabel const& labels, int id)
+{
+    if (id < 0)
+    {
+        return "[OUTSIDE]";
+    }
+    CELER_ASSERT(static_cast<size_type>(id) < labels.size());
+    return to_string(labels[id]);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Count and possibly save a mismatch.
+ */
+void VolumeComparator::add_mismatch(Real3 const& pos,
+                                    int expected,
+                                    int actual,
+                                    VolumeComparison* result) const
+{
+    ++result->num_mismatched;
+    if (result->mismatches.size() < max_mismatches_)
+    {
+        result->mismatches.push_back(
+            {pos,
+             volume_label(expected_labels_, expected),
+             volume_label(actual_labels_, actual)});
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,117 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file geocel/rasterize/VolumeComparator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/io/Label.hh"
+#include "geocel/Types.hh"
+
+namespace celeritas
+{
+class ImageInterface;
+
+//---------------------------------------------------------------------------//
+//! A sample point where two geometries disagree
+struct VolumeMismatch
+{
+    Real3 pos{};  //!< Sample position [len]
+    std::string expected;  //!< Volume label in the reference geometry
+    std::string actual;  //!< Volume label in the tested geometry
+};
+
+//---------------------------------------------------------------------------//
+//! Accumulated result of comparing two geometries
+struct VolumeComparison
+{
+    size_type num_samples{0};  //!< Number of compared points or pixels
+    size_type num_mismatched{0};  //!< Number of disagreeing samples
+    std::vector<VolumeMismatch> mismatches;  //!< First few mismatches
+
+    //! Whether all the compared samples agree
+    explicit operator bool() const { return num_mismatched == 0; }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compare volumes found by two geometry implementations.
+ *
+ * Volume IDs differ between geometry implementations, so they are compared
+ * by label: each volume in the reference ("expected") geometry is mapped to
+ * the volume in the tested ("actual") geometry with the same full label (name
+ * and extension) or, if there is none, the same name. A label or name that
+ * occurs more than once in either geometry is ambiguous (e.g., reflected or
+ * replicated volumes without a uniquifying extension), so the reference
+ * volume is left unmatched and any sample in it is a mismatch. Unmatched
+ * reference volumes are listed by \c unmatched . Points outside the geometry
+ * (a volume ID of -1) compare equal only to other exterior points.
+ *
+ * Two images traced with the same \c ImageParams can be compared pixel by
+ * pixel. Since each pixel value is the volume occupying the largest fraction
+ * of the pixel's segment along the ray, the reported position for an image
+ * mismatch is the pixel center. Independently located points (e.g.,
+ * randomly sampled) can be compared as well.
+ *
+ * Only the first \c max_mismatches disagreements are saved, but all are
+ * counted.
+ */
+class VolumeComparator
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using VecLabel = std::vector<Label>;
+    using SpanConstInt = Span<int const>;
+    using SpanConstPoint = Span<Real3 const>;
+    //!@}
+
+  public:
+    // Construct with volume labels of the reference and tested geometries
+    VolumeComparator(VecLabel expected_labels,
+                     VecLabel actual_labels,
+                     size_type max_mismatches);
+
+    // Compare two images traced with the same parameters
+    void operator()(ImageInterface const& expected,
+                    ImageInterface const& actual,
+                    VolumeComparison* result) const;
+
+    // Compare volumes located at each point
+    void operator()(SpanConstPoint pos,
+                    SpanConstInt expected,
+                    SpanConstInt actual,
+                    VolumeComparison* result) const;
+
+    //! Reference volumes with no unique counterpart in the tested geometry
+    VecLabel const& unmatched() const { return unmatched_; }
+
+  private:
+    VecLabel expected_labels_;
+    VecLabel actual_labels_;
+    VecLabel unmatched_;
+    std::vector<int> expected_to_actual_;
+    size_type max_mismatches_;
+
+    // Whether two volume IDs refer to the same volume
+    bool is_same(int expected, int actual) const;
+
+    // Get the label of a volume ID
+    static std::string volume_label(VecLabel const& labels, int id);
+
+    // Count and possibly save a mismatch
+    void add_mismatch(Real3 const& pos,
+                      int expected,
+                      int actual,
+                      VolumeComparison* result) const;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
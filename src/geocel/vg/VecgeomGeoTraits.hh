@@ -43,6 +43,9 @@ struct GeoTraits<VecgeomParams>
     //! Descriptive name for the geometry
     static constexpr inline char const* name = "VecGeom";
 
+    //! Whether host states can be navigated concurrently by multiple threads
+    static constexpr inline bool host_thread_safe = true;
+
     //! TO BE REMOVED: "native" file extension for this geometry
     static constexpr inline char const* ext = ".gdml";
 };
@@ -50,6 +50,9 @@ struct OrangeParamsScalars
     // Soft comparison and dynamic "bumping" values
     Tolerance<> tol;
 
+    // Reuse distance-to-boundary and safety distances between steps
+    bool cache_navigation{false};
+
     //! True if assigned
     explicit CELER_FUNCTION operator bool() const
     {
@@ -68,7 +71,7 @@ struct OrangeParamsScalars
 struct VolumeRecord
 {
     ItemRange<LocalSurfaceId> faces;
-    ItemRange<logic_int> logic;
+    ItemRange<logic_int> logic;  //!< Infix, empty if unreachable
 
     logic_int max_intersections{0};
     logic_int flags{0};
@@ -112,6 +115,7 @@ struct SurfacesRecord
 
     ItemRange<SurfaceType> types;
     ItemRange<RealId> data_offsets;
+    SurfaceTypeSet type_set{SurfaceTypeSet::all};  //!< Types present
 
     //! Number of surfaces stored
     CELER_FUNCTION size_type size() const { return types.size(); }
@@ -262,6 +266,40 @@ struct RectArrayRecord
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Data for a single regular voxel grid universe.
+ *
+ * Each voxel stores the index of its local volume (typically a material) in
+ * the \c voxels storage. The planes between voxels are numbered like the
+ * surfaces of a rect array, but as with rect arrays the outer boundaries of
+ * the grid are never reported as intersections: the grid must be placed in a
+ * parent volume that exactly matches its extents.
+ */
+struct VoxelGridRecord
+{
+    using Dims = Array<size_type, 3>;
+    using SurfaceIndexerData = RaggedRightIndexerData<3>;
+
+    // Local volume of each voxel [x][y][z]
+    ItemRange<voxel_int> voxels;
+    size_type num_volumes{0};
+
+    // Grid data
+    Dims dims{};
+    Real3 origin{};
+    Real3 width{};
+    SurfaceIndexerData surface_indexer_data;
+
+    //! Cursory check for validity
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return num_volumes > 0 && !voxels.empty()
+               && voxels.size() == dims[0] * dims[1] * dims[2]
+               && width[0] > 0 && width[1] > 0 && width[2] > 0;
+    }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Surface and volume offsets to convert between local and global indices.
@@ -343,7 +381,7 @@ struct BIHTreeData
  * units are present, then the \c simple_units data structure will just be
  * equal to a range (with the total number of universes present). Use
  * `universe_types` to switch on the type of universe; then `universe_indices`
- * to index into `simple_units` or `rect_arrays` or ...
+ * to index into `simple_units` or `rect_arrays` or `voxel_grids`.
  */
 template<Ownership W, MemSpace M>
 struct OrangeParamsData
@@ -364,6 +402,7 @@ struct OrangeParamsData
     UnivItems<size_type> universe_indices;
     Items<SimpleUnitRecord> simple_units;
     Items<RectArrayRecord> rect_arrays;
+    Items<VoxelGridRecord> voxel_grids;
     Items<TransformRecord> transforms;
 
     // BIH tree storage
@@ -381,6 +420,7 @@ struct OrangeParamsData
     Items<VolumeRecord> volume_records;
     Items<Daughter> daughters;
     Items<OrientedBoundingZoneRecord> obz_records;
+    Items<voxel_int> voxels;
 
     UniverseIndexerData<W, M> universe_indexer_data;
 
@@ -408,6 +448,7 @@ struct OrangeParamsData
         universe_indices = other.universe_indices;
         simple_units = other.simple_units;
         rect_arrays = other.rect_arrays;
+        voxel_grids = other.voxel_grids;
         transforms = other.transforms;
 
         bih_tree_data = other.bih_tree_data;
@@ -422,6 +463,7 @@ struct OrangeParamsData
         volume_records = other.volume_records;
         obz_records = other.obz_records;
         daughters = other.daughters;
+        voxels = other.voxels;
         universe_indexer_data = other.universe_indexer_data;
 
         CELER_ENSURE(static_cast<bool>(*this) == static_cast<bool>(other));
@@ -465,6 +507,10 @@ struct OrangeStateData
     StateItems<LocalSurfaceId> next_surf;
     StateItems<Sense> next_sense;
 
+    // Cached safety sphere in global coordinates {num_tracks}
+    StateItems<Real3> safety_pos;
+    StateItems<real_type> safety_radius;
+
     // State with dimensions {num_tracks, max_depth}
     Items<Real3> pos;
     Items<Real3> dir;
@@ -495,6 +541,8 @@ struct OrangeStateData
             && next_step.size() == this->size()
             && next_surf.size() == this->size()
             && next_sense.size() == this->size()
+            && safety_pos.size() == this->size()
+            && safety_radius.size() == this->size()
             && pos.size() == max_depth * this->size()
             && dir.size() == max_depth  * this->size()
             && vol.size() == max_depth  * this->size()
@@ -527,6 +575,9 @@ struct OrangeStateData
         next_surf = other.next_surf;
         next_sense = other.next_sense;
 
+        safety_pos = other.safety_pos;
+        safety_radius = other.safety_radius;
+
         pos = other.pos;
         dir = other.dir;
         vol = other.vol;
@@ -568,6 +619,9 @@ inline void resize(OrangeStateData<Ownership::value, M>* data,
     resize(&data->next_surf, num_tracks);
     resize(&data->next_sense, num_tracks);
 
+    resize(&data->safety_pos, num_tracks);
+    resize(&data->safety_radius, num_tracks);
+
     size_type level_states = params.scalars.max_depth * num_tracks;
     resize(&data->pos, level_states);
     resize(&data->dir, level_states);
@@ -40,6 +40,9 @@ struct GeoTraits<OrangeParams>
     //! Descriptive name for the geometry
     static constexpr inline char const* name = "ORANGE";
 
+    //! Whether host states can be navigated concurrently by multiple threads
+    static constexpr inline bool host_thread_safe = true;
+
     //! TO BE REMOVED: "native" file extension for this geometry
     static constexpr inline char const* ext = ".org.json";
 };
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
 #include <iosfwd>
 #include <map>
 #include <variant>
@@ -131,9 +132,46 @@ struct RectArrayInput
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Input definition for a regular voxel grid universe.
+ *
+ * Each voxel is assigned a single local volume (usually one per material), so
+ * that large medical phantoms need neither per-voxel volumes nor daughter
+ * universes. The grid must be placed in a parent volume whose boundaries
+ * coincide with the grid extents.
+ */
+struct VoxelGridInput
+{
+    using Dims = Array<size_type, 3>;
+
+    Dims dims{};  //!< Number of voxels along each axis
+    Real3 origin{};  //!< Lower corner of the grid
+    Real3 width{};  //!< Voxel width along each axis
+
+    // Local volume index of each voxel [x][y][z]
+    std::vector<voxel_int> voxels;
+
+    // Unit metadata
+    std::vector<Label> volume_labels;
+    Label label;
+
+    //! Whether the universe definition is valid
+    explicit operator bool() const
+    {
+        return !volume_labels.empty()
+               && voxels.size() == std::size_t(dims[0]) * dims[1] * dims[2]
+               && !voxels.empty()
+               && std::all_of(width.begin(), width.end(), [](real_type w) {
+                      return w > 0;
+                  });
+    }
+};
+
 //---------------------------------------------------------------------------//
 //! Possible types of universe inputs
-using VariantUniverseInput = std::variant<UnitInput, RectArrayInput>;
+using VariantUniverseInput
+    = std::variant<UnitInput, RectArrayInput, VoxelGridInput>;
 
 //---------------------------------------------------------------------------//
 /*!
@@ -146,6 +184,9 @@ struct OrangeInput
     //! Relative and absolute error for construction and transport
     Tolerance<> tol;
 
+    //! Reuse next-step and safety distances during navigation
+    bool cache_navigation{false};
+
     //! Whether the unit definition is valid
     explicit operator bool() const { return !universes.empty() && tol; }
 };
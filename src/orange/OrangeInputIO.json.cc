@@ -29,6 +29,7 @@
 
 #include "OrangeInput.hh"
 #include "OrangeTypes.hh"
+#include "VoxelGridIO.hh"
 #include "surf/SurfaceTypeTraits.hh"
 
 #include "detail/OrangeInputIOImpl.json.hh"
@@ -475,6 +476,56 @@ void to_json(nlohmann::json& j, RectArrayInput const& value)
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Read a voxel grid universe definition from an ORANGE input file.
+ *
+ * Voxels can be listed inline, but large grids should instead reference a
+ * compact binary voxel file (see \c read_voxel_grid ) with a \c file key.
+ */
+void from_json(nlohmann::json const& j, VoxelGridInput& value)
+{
+    if (auto iter = j.find("file"); iter != j.end())
+    {
+        value = read_voxel_grid(iter->get<std::string>());
+    }
+    else
+    {
+        j.at("dims").get_to(value.dims);
+        j.at("origin").get_to(value.origin);
+        j.at("width").get_to(value.width);
+        j.at("volume_labels").get_to(value.volume_labels);
+        j.at("voxels").get_to(value.voxels);
+    }
+
+    if (auto iter = j.find("md"); iter != j.end())
+    {
+        iter->at("name").get_to(value.label);
+    }
+    CELER_VALIDATE(value,
+                   << "voxel grid '" << value.label
+                   << "' is not properly constructed");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write a voxel grid universe definition to an ORANGE input file.
+ */
+void to_json(nlohmann::json& j, VoxelGridInput const& value)
+{
+    CELER_EXPECT(value);
+
+    j = nlohmann::json::object({
+        {"_type", "voxelgrid"},
+        {"md", nlohmann::json::object({{"name", value.label}})},
+        {"dims", value.dims},
+        {"origin", value.origin},
+        {"width", value.width},
+        {"volume_labels", value.volume_labels},
+        {"voxels", value.voxels},
+    });
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Read tolerances.
@@ -541,11 +592,15 @@ void from_json(nlohmann::json const& j, OrangeInput& value)
         auto const& uni_type = uni.at("_type").get<std::string>();
         if (uni_type == "unit" || uni_type == "simple unit")
         {
-            value.universes.push_back(uni.get<UnitInput>());
+            value.universes.emplace_back(uni.get<UnitInput>());
         }
         else if (uni_type == "rectarray" || uni_type == "rectangular array")
         {
-            value.universes.push_back(uni.get<RectArrayInput>());
+            value.universes.emplace_back(uni.get<RectArrayInput>());
+        }
+        else if (uni_type == "voxelgrid" || uni_type == "voxel grid")
+        {
+            value.universes.emplace_back(uni.get<VoxelGridInput>());
         }
         else
         {
@@ -564,6 +619,10 @@ void from_json(nlohmann::json const& j, OrangeInput& value)
         CELER_LOG(debug) << "No input tolerance provided: setting default "
                             "tolerance";
     }
+    if (auto iter = j.find("cache_navigation"); iter != j.end())
+    {
+        iter->get_to(value.cache_navigation);
+    }
     CELER_ENSURE(value);
 }
 
@@ -584,6 +643,10 @@ void to_json(nlohmann::json& j, OrangeInput const& value)
     {
         j["tol"] = value.tol;
     }
+    if (value.cache_navigation)
+    {
+        j["cache_navigation"] = value.cache_navigation;
+    }
     save_units(j);
 }
 
@@ -25,6 +25,9 @@ void to_json(nlohmann::json& j, UnitInput const& value);
 void from_json(nlohmann::json const& j, RectArrayInput& value);
 void to_json(nlohmann::json& j, RectArrayInput const& value);
 
+void from_json(nlohmann::json const& j, VoxelGridInput& value);
+void to_json(nlohmann::json& j, VoxelGridInput const& value);
+
 template<class T>
 void from_json(nlohmann::json const& j, Tolerance<>& value);
 template<class T>
@@ -42,6 +42,7 @@
 #include "detail/RectArrayInserter.hh"
 #include "detail/UnitInserter.hh"
 #include "detail/UniverseInserter.hh"
+#include "detail/VoxelGridInserter.hh"
 
 namespace celeritas
 {
@@ -157,6 +158,11 @@ OrangeParams::OrangeParams(OrangeInput&& input)
     HostVal<OrangeParamsData> host_data;
     host_data.scalars.tol = input.tol;
     host_data.scalars.max_depth = detail::DepthCalculator{input.universes}();
+    host_data.scalars.cache_navigation = input.cache_navigation;
+    if (host_data.scalars.cache_navigation)
+    {
+        CELER_LOG(info) << "Caching ORANGE next-step and safety distances";
+    }
 
     // Insert all universes
     {
@@ -168,7 +174,8 @@ OrangeParams::OrangeParams(OrangeInput&& input)
             &universe_labels, &surface_labels, &volume_labels, &host_data};
         Overload insert_universe{
             detail::UnitInserter{&insert_universe_base, &host_data},
-            detail::RectArrayInserter{&insert_universe_base, &host_data}};
+            detail::RectArrayInserter{&insert_universe_base, &host_data},
+            detail::VoxelGridInserter{&insert_universe_base, &host_data}};
 
         for (auto&& u : input.universes)
         {
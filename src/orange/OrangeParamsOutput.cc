@@ -71,6 +71,8 @@ void OrangeParamsOutput::output(JsonPimpl* j) const
         OPO_SAVE_SIZE(connectivity_records);
         OPO_SAVE_SIZE(volume_records);
         OPO_SAVE_SIZE(daughters);
+        OPO_SAVE_SIZE(voxel_grids);
+        OPO_SAVE_SIZE(voxels);
 #undef OPO_SAVE_SIZE
 
         // Save BIH sizes
@@ -52,6 +52,13 @@ namespace celeritas
  *
  * \c move_internal with a position \em should depend on the safety distance
  * but that's not yet implemented.
+ *
+ * If the \c cache_navigation option is enabled in \c OrangeInput , the
+ * distance to the next boundary is reused by \c find_next_step as long as the
+ * direction is unchanged, i.e. after a short physics-limited step. The most
+ * recent safety sphere is also saved: a subsequent \c find_safety with a
+ * maximum radius returns immediately if the current position is far enough
+ * inside the sphere.
  */
 class OrangeTrackView
 {
@@ -196,6 +203,9 @@ class OrangeTrackView
     inline CELER_FUNCTION Propagation
     find_next_step_impl(detail::Intersection isect);
 
+    // Calculate the safety distance over all levels
+    inline CELER_FUNCTION real_type find_safety_impl();
+
     // Create local sense reference
     inline CELER_FUNCTION Span<Sense> make_temp_sense() const;
 
@@ -214,6 +224,9 @@ class OrangeTrackView
     // Invalidate the next distance-to-boundary and surface
     inline CELER_FUNCTION void clear_next();
 
+    // Invalidate the cached safety distance
+    inline CELER_FUNCTION void clear_safety();
+
     // Assign the surface on the current level
     inline CELER_FUNCTION void
     surface(LevelId level, detail::OnLocalSurface surf);
@@ -345,6 +358,7 @@ OrangeTrackView::operator=(Initializer_t const& init)
     this->boundary(BoundaryResult::exiting);
     this->clear_surface();
     this->clear_next();
+    this->clear_safety();
 
     CELER_ENSURE(!this->has_next_step());
     return *this;
@@ -380,6 +394,7 @@ OrangeTrackView& OrangeTrackView::operator=(DetailedInitializer const& init)
     // Clear the next step information since we're changing direction or
     // initializing a new state
     this->clear_next();
+    this->clear_safety();
 
     // Transform direction from global to local
     Real3 localdir = init.dir;
@@ -536,6 +551,12 @@ CELER_FUNCTION Propagation OrangeTrackView::find_next_step()
         return {0, true};
     }
 
+    if (params_.scalars.cache_navigation && this->has_next_surface())
+    {
+        // Straight-line distance to the boundary is still valid
+        return {this->next_step(), true};
+    }
+
     // Find intersection at the top level: always the first simple unit
     auto global_isect = [this] {
         SimpleUnitTracker t{params_, SimpleUnitId{0}};
@@ -562,6 +583,19 @@ CELER_FUNCTION Propagation OrangeTrackView::find_next_step(real_type max_step)
         return {0, true};
     }
 
+    if (params_.scalars.cache_navigation && this->has_next_step())
+    {
+        // Reuse the previous search if it's still valid
+        if (this->has_next_surface() && this->next_step() <= max_step)
+        {
+            return {this->next_step(), true};
+        }
+        if (max_step <= this->next_step())
+        {
+            return {max_step, false};
+        }
+    }
+
     // Find intersection at the top level: always the first simple unit
     auto global_isect = [this, &max_step] {
         SimpleUnitTracker t{params_, SimpleUnitId{0}};
@@ -675,6 +709,7 @@ CELER_FUNCTION void OrangeTrackView::cross_boundary()
     // Cross surface by flipping the sense
     states_.sense[track_slot_] = flip_sense(this->sense());
     this->boundary(BoundaryResult::exiting);
+    this->clear_safety();
 
     // Create local state from post-crossing level and updated sense
     LevelId level{this->surface_level()};
@@ -999,15 +1034,52 @@ OrangeTrackView::find_next_step_impl(detail::Intersection isect)
 //---------------------------------------------------------------------------//
 /*!
  * Find the distance to the nearest boundary in any direction.
+ */
+CELER_FUNCTION real_type OrangeTrackView::find_safety()
+{
+    CELER_EXPECT(!this->is_on_boundary());
+
+    return this->find_safety_impl();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the distance to the nearest nearby boundary.
+ *
+ * Since we currently support only "simple" safety distances, we can't
+ * eliminate anything by checking only nearby surfaces. However, if the
+ * navigation cache is enabled and the previously calculated safety sphere
+ * still contains a sphere of the given radius around the current point, the
+ * remaining (conservative) safety distance is returned without calculation.
+ */
+CELER_FUNCTION real_type OrangeTrackView::find_safety(real_type max_step)
+{
+    CELER_EXPECT(!this->is_on_boundary());
+
+    if (params_.scalars.cache_navigation)
+    {
+        real_type const radius = states_.safety_radius[track_slot_];
+        real_type const remaining
+            = radius - distance(this->pos(), states_.safety_pos[track_slot_]);
+        if (remaining >= max_step)
+        {
+            return remaining;
+        }
+    }
+
+    return this->find_safety_impl();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the safety distance and save it if caching.
  *
  * The safety distance at a given point is the minimum safety distance over all
  * levels, since surface deduplication can potentionally elide bounding
  * surfaces at more deeply embedded levels.
  */
-CELER_FUNCTION real_type OrangeTrackView::find_safety()
+CELER_FUNCTION real_type OrangeTrackView::find_safety_impl()
 {
-    CELER_EXPECT(!this->is_on_boundary());
-
     TrackerVisitor visit_tracker{params_};
 
     real_type min_safety_dist = numeric_limits<real_type>::infinity();
@@ -1020,19 +1092,13 @@ CELER_FUNCTION real_type OrangeTrackView::find_safety()
             lsa.universe());
         min_safety_dist = celeritas::min(min_safety_dist, sd);
     }
-    return min_safety_dist;
-}
 
-//---------------------------------------------------------------------------//
-/*!
- * Find the distance to the nearest nearby boundary.
- *
- * Since we currently support only "simple" safety distances, we can't
- * eliminate anything by checking only nearby surfaces.
- */
-CELER_FUNCTION real_type OrangeTrackView::find_safety(real_type)
-{
-    return this->find_safety();
+    if (params_.scalars.cache_navigation)
+    {
+        states_.safety_pos[track_slot_] = this->pos();
+        states_.safety_radius[track_slot_] = min_safety_dist;
+    }
+    return min_safety_dist;
 }
 
 //---------------------------------------------------------------------------//
@@ -1122,6 +1188,15 @@ CELER_FUNCTION void OrangeTrackView::clear_next()
     CELER_ENSURE(!this->has_next_step() && !this->has_next_surface());
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Invalidate the cached safety sphere.
+ */
+CELER_FORCEINLINE_FUNCTION void OrangeTrackView::clear_safety()
+{
+    states_.safety_radius[track_slot_] = 0;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Assign the surface on the current level.
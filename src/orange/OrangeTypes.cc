@@ -131,6 +131,20 @@ char const* to_cstring(SurfaceType value)
     return to_cstring_impl(value);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get a string corresponding to a set of surface types.
+ */
+char const* to_cstring(SurfaceTypeSet value)
+{
+    static EnumStringMapper<SurfaceTypeSet> const to_cstring_impl{
+        "plane_aligned",
+        "cyl_centered",
+        "all",
+    };
+    return to_cstring_impl(value);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get a string corresponding to a transform type.
@@ -141,6 +155,7 @@ char const* to_cstring(TransformType value)
         "no_transformation",
         "translation",
         "transformation",
+        "signed_permutation",
     };
     return to_cstring_impl(value);
 }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <type_traits>
 #include <utility>
@@ -36,6 +37,9 @@ using fast_real_type = float;
 //! Integer type for volume CSG tree representation
 using logic_int = size_type;
 
+//! Compact local volume index of a single voxel in a voxel grid
+using voxel_int = std::uint16_t;
+
 //! Helper class for some template dispatch functions
 template<Axis T>
 using AxisTag = std::integral_constant<Axis, T>;
@@ -81,6 +85,9 @@ using TransformId = OpaqueId<struct TransformRecord>;
 //! Identifier for a relocatable set of volumes
 using UniverseId = OpaqueId<struct Universe_>;
 
+//! Opaque index for voxel grid data
+using VoxelGridId = OpaqueId<struct VoxelGridRecord>;
+
 //---------------------------------------------------------------------------//
 // ENUMERATIONS
 //---------------------------------------------------------------------------//
@@ -138,6 +145,23 @@ enum class SurfaceType : unsigned char
     size_  //!< Sentinel value for number of surface types
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Restricted set of surface types present in a unit.
+ *
+ * The sets are nested: each is a superset of the previous one. Units whose
+ * surfaces all belong to a small set can be tracked with a surface visitor
+ * specialized for those types rather than a switch over all surface types.
+ * See \c orange/surf/SurfaceTypeTraits.hh for the types in each set.
+ */
+enum class SurfaceTypeSet : unsigned char
+{
+    plane_aligned,  //!< Axis-aligned planes only (voxels, slabs)
+    cyl_centered,  //!< Axis-aligned planes and centered cylinders
+    all,  //!< Any surface type
+    size_
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Enumeration for mapping transform implementations to integers.
@@ -147,6 +171,7 @@ enum class TransformType : unsigned char
     no_transformation,  //!< Identity transform
     translation,  //!< Translation only
     transformation,  //!< Translation plus rotation
+    signed_permutation,  //!< Axis-aligned rotation without translation
     size_
 };
 
@@ -161,6 +186,7 @@ enum class UniverseType : unsigned char
 {
     simple,
     rect_array,
+    voxel_grid,
 #if 0
     hex_array,
     dode_array,
@@ -476,6 +502,9 @@ inline constexpr char to_char(Sense s)
 // Get a string corresponding to a surface type
 char const* to_cstring(SurfaceType);
 
+// Get a string corresponding to a set of surface types
+char const* to_cstring(SurfaceTypeSet);
+
 // Get a string corresponding to a transform type
 char const* to_cstring(TransformType);
 
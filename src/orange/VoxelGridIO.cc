@@ -0,0 +1,219 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/VoxelGridIO.cc
+//---------------------------------------------------------------------------//
+#include "VoxelGridIO.hh"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/io/Label.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Binary voxel file layout.
+ *
+ * All values are stored in native (on all supported platforms,
+ * little-endian) byte order:
+ * - magic string \c "ORGVOXEL" (8 bytes, no null terminator)
+ * - format version (u32)
+ * - universe name (u32 length followed by characters)
+ * - number of voxels along x, y, z (3 x u32)
+ * - lower corner of the grid and voxel widths (6 x f64)
+ * - number of volumes (u32), then each volume name (u32 length + characters)
+ * - number of runs (u64), then each run of identical voxels in [x][y][z]
+ *   order as a volume index (u16) and length (u32)
+ *
+ * Run-length encoding keeps large uniform regions (e.g., the air surrounding
+ * a phantom) from dominating the file size.
+ */
+constexpr char magic[] = "ORGVOXEL";
+constexpr std::size_t magic_size = sizeof(magic) - 1;
+constexpr std::uint32_t format_version = 1;
+
+using RunLength = std::uint32_t;
+
+//---------------------------------------------------------------------------//
+template<class T>
+void read_value(std::istream& is, T* value)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    is.read(reinterpret_cast<char*>(value), sizeof(T));
+    CELER_VALIDATE(is, << "unexpected end of voxel grid input");
+}
+
+template<class T>
+void write_value(std::ostream& os, T value)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    os.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+//---------------------------------------------------------------------------//
+std::string read_string(std::istream& is)
+{
+    std::uint32_t size{};
+    read_value(is, &size);
+    std::string result(size, '\0');
+    is.read(result.data(), size);
+    CELER_VALIDATE(is, << "unexpected end of voxel grid input");
+    return result;
+}
+
+void write_string(std::ostream& os, std::string const& s)
+{
+    write_value(os, static_cast<std::uint32_t>(s.size()));
+    os.write(s.data(), s.size());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read a voxel grid universe from a binary stream.
+ */
+VoxelGridInput read_voxel_grid(std::istream& is)
+{
+    char file_magic[magic_size];
+    is.read(file_magic, magic_size);
+    CELER_VALIDATE(is && std::memcmp(file_magic, magic, magic_size) == 0,
+                   << "input is not a binary voxel grid file");
+    std::uint32_t version{};
+    read_value(is, &version);
+    CELER_VALIDATE(version == format_version,
+                   << "unsupported voxel grid file version " << version
+                   << " (expected " << format_version << ")");
+
+    VoxelGridInput result;
+    result.label = Label::from_separator(read_string(is));
+
+    std::size_t num_voxels = 1;
+    for (auto ax : range(3))
+    {
+        std::uint32_t dim{};
+        read_value(is, &dim);
+        result.dims[ax] = dim;
+        num_voxels *= dim;
+    }
+    for (auto* arr : {&result.origin, &result.width})
+    {
+        for (auto ax : range(3))
+        {
+            double v{};
+            read_value(is, &v);
+            (*arr)[ax] = v;
+        }
+    }
+
+    std::uint32_t num_volumes{};
+    read_value(is, &num_volumes);
+    result.volume_labels.reserve(num_volumes);
+    for ([[maybe_unused]] auto i : range(num_volumes))
+    {
+        result.volume_labels.push_back(Label::from_separator(read_string(is)));
+    }
+
+    std::uint64_t num_runs{};
+    read_value(is, &num_runs);
+    result.voxels.reserve(num_voxels);
+    for ([[maybe_unused]] auto i : range(num_runs))
+    {
+        voxel_int vol{};
+        RunLength count{};
+        read_value(is, &vol);
+        read_value(is, &count);
+        CELER_VALIDATE(result.voxels.size() + count <= num_voxels,
+                       << "voxel grid '" << result.label
+                       << "' has more voxels than its dimensions allow");
+        result.voxels.insert(result.voxels.end(), count, vol);
+    }
+    CELER_VALIDATE(result.voxels.size() == num_voxels,
+                   << "voxel grid '" << result.label << "' has "
+                   << result.voxels.size() << " voxels but expected "
+                   << num_voxels);
+
+    CELER_ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read a voxel grid universe from a binary file.
+ */
+VoxelGridInput read_voxel_grid(std::string const& filename)
+{
+    std::ifstream infile(filename, std::ios::in | std::ios::binary);
+    CELER_VALIDATE(infile,
+                   << "failed to open voxel grid file at '" << filename
+                   << "'");
+    return read_voxel_grid(infile);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write a voxel grid universe to a binary stream.
+ */
+void write_voxel_grid(std::ostream& os, VoxelGridInput const& inp)
+{
+    CELER_EXPECT(inp);
+
+    os.write(magic, magic_size);
+    write_value(os, format_version);
+    write_string(os, to_string(inp.label));
+    for (auto ax : range(3))
+    {
+        write_value(os, static_cast<std::uint32_t>(inp.dims[ax]));
+    }
+    for (auto const* arr : {&inp.origin, &inp.width})
+    {
+        for (auto ax : range(3))
+        {
+            write_value(os, static_cast<double>((*arr)[ax]));
+        }
+    }
+
+    write_value(os, static_cast<std::uint32_t>(inp.volume_labels.size()));
+    for (auto const& label : inp.volume_labels)
+    {
+        write_string(os, to_string(label));
+    }
+
+    // Encode runs of identical voxels
+    std::vector<std::pair<voxel_int, RunLength>> runs;
+    for (voxel_int v : inp.voxels)
+    {
+        if (runs.empty() || runs.back().first != v
+            || runs.back().second == std::numeric_limits<RunLength>::max())
+        {
+            runs.push_back({v, 0});
+        }
+        ++runs.back().second;
+    }
+    write_value(os, static_cast<std::uint64_t>(runs.size()));
+    for (auto const& [vol, count] : runs)
+    {
+        write_value(os, vol);
+        write_value(os, count);
+    }
+    CELER_VALIDATE(os, << "failed to write voxel grid '" << inp.label << "'");
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,29 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/VoxelGridIO.hh
+//! \brief Read and write compact binary voxel grid files
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <iosfwd>
+#include <string>
+
+#include "OrangeInput.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// Read a voxel grid universe from a binary stream
+VoxelGridInput read_voxel_grid(std::istream& is);
+
+// Read a voxel grid universe from a binary file
+VoxelGridInput read_voxel_grid(std::string const& filename);
+
+// Write a voxel grid universe to a binary stream
+void write_voxel_grid(std::ostream& os, VoxelGridInput const& inp);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
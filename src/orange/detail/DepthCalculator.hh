@@ -43,6 +43,9 @@ class DepthCalculator
     // Calculate the depth of a rect array
     size_type operator()(RectArrayInput const& u);
 
+    //! Calculate the depth of a voxel grid, which has no daughters
+    size_type operator()(VoxelGridInput const&) { return 1; }
+
   private:
     ContainerVisitor<VecVarUniv const&> visit_univ_;
     std::size_t num_univ_{0};
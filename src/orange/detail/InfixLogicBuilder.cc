@@ -0,0 +1,338 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/InfixLogicBuilder.cc
+//---------------------------------------------------------------------------//
+#include "InfixLogicBuilder.hh"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Node in a simplified logic tree.
+ *
+ * Joins have at least two children, none of which is a join of the same
+ * type or a constant.
+ */
+struct LogicNode
+{
+    enum class Kind
+    {
+        face,
+        constant,
+        join
+    };
+
+    Kind kind{Kind::constant};
+    logic_int value{logic::ltrue};  //!< Face ID or join operator
+    bool negated{false};  //!< Complemented face, or "false" constant
+    std::vector<LogicNode> children;
+};
+
+//---------------------------------------------------------------------------//
+LogicNode make_face(logic_int face)
+{
+    LogicNode result;
+    result.kind = LogicNode::Kind::face;
+    result.value = face;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+LogicNode make_constant(bool value)
+{
+    LogicNode result;
+    result.negated = !value;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Negate a node, applying DeMorgan's laws to joins.
+ */
+LogicNode negate(LogicNode&& node)
+{
+    if (node.kind == LogicNode::Kind::join)
+    {
+        node.value = (node.value == logic::land ? logic::lor : logic::land);
+        for (auto& child : node.children)
+        {
+            child = negate(std::move(child));
+        }
+    }
+    else
+    {
+        node.negated = !node.negated;
+    }
+    return std::move(node);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Join two nodes, flattening and simplifying.
+ */
+LogicNode join(logic_int op, LogicNode&& left, LogicNode&& right)
+{
+    CELER_EXPECT(op == logic::land || op == logic::lor);
+
+    // Constant that determines the result: false for AND, true for OR
+    bool const absorbing = (op == logic::lor);
+
+    std::vector<LogicNode> operands;
+    for (LogicNode* node : {&left, &right})
+    {
+        if (node->kind == LogicNode::Kind::join && node->value == op)
+        {
+            std::move(node->children.begin(),
+                      node->children.end(),
+                      std::back_inserter(operands));
+        }
+        else
+        {
+            operands.push_back(std::move(*node));
+        }
+    }
+
+    LogicNode result;
+    result.kind = LogicNode::Kind::join;
+    result.value = op;
+    for (LogicNode& node : operands)
+    {
+        if (node.kind == LogicNode::Kind::constant)
+        {
+            if (!node.negated == absorbing)
+            {
+                return make_constant(absorbing);
+            }
+            // Identity element (true for AND, false for OR) is dropped
+            continue;
+        }
+        if (node.kind == LogicNode::Kind::face)
+        {
+            auto iter = std::find_if(
+                result.children.begin(),
+                result.children.end(),
+                [&node](LogicNode const& other) {
+                    return other.kind == LogicNode::Kind::face
+                           && other.value == node.value;
+                });
+            if (iter != result.children.end())
+            {
+                if (iter->negated != node.negated)
+                {
+                    // Complementary faces: A & ~A, A | ~A
+                    return make_constant(absorbing);
+                }
+                // Duplicate face
+                continue;
+            }
+        }
+        result.children.push_back(std::move(node));
+    }
+
+    if (result.children.empty())
+    {
+        return make_constant(!absorbing);
+    }
+    if (result.children.size() == 1)
+    {
+        return std::move(result.children.front());
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the relative cost of evaluating each face.
+ */
+InfixLogicBuilder::InfixLogicBuilder(SpanConstCost face_costs)
+    : face_costs_{face_costs}
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert postfix logic into simplified, reordered infix logic.
+ */
+auto InfixLogicBuilder::operator()(SpanConstLogic postfix) const -> VecLogic
+{
+    CELER_EXPECT(!postfix.empty());
+
+    // Build a simplified tree from the postfix expression
+    std::vector<LogicNode> stack;
+    for (logic_int lgc : postfix)
+    {
+        if (!logic::is_operator_token(lgc))
+        {
+            CELER_EXPECT(lgc < face_costs_.size());
+            stack.push_back(make_face(lgc));
+        }
+        else if (lgc == logic::ltrue)
+        {
+            stack.push_back(make_constant(true));
+        }
+        else if (lgc == logic::lnot)
+        {
+            CELER_VALIDATE(!stack.empty(),
+                           << "invalid logic definition: missing operand");
+            stack.back() = negate(std::move(stack.back()));
+        }
+        else
+        {
+            CELER_VALIDATE(lgc == logic::land || lgc == logic::lor,
+                           << "invalid logic definition: unexpected token");
+            CELER_VALIDATE(stack.size() >= 2,
+                           << "invalid logic definition: missing operand");
+            LogicNode right = std::move(stack.back());
+            stack.pop_back();
+            stack.back() = join(lgc, std::move(stack.back()), std::move(right));
+        }
+    }
+    CELER_VALIDATE(stack.size() == 1,
+                   << "invalid logic definition: operators do not balance");
+
+    // Reorder so that the cheapest operands are evaluated first
+    auto sort_by_cost = [this](auto&& self, LogicNode* node) -> size_type {
+        switch (node->kind)
+        {
+            case LogicNode::Kind::face:
+                return face_costs_[node->value];
+            case LogicNode::Kind::constant:
+                return 0;
+            case LogicNode::Kind::join:
+                break;
+        }
+
+        std::vector<std::pair<size_type, LogicNode>> costs;
+        for (LogicNode& child : node->children)
+        {
+            size_type cost = self(self, &child);
+            costs.emplace_back(cost, std::move(child));
+        }
+        std::stable_sort(
+            costs.begin(), costs.end(), [](auto const& a, auto const& b) {
+                return a.first < b.first;
+            });
+
+        size_type total{0};
+        for (auto i : range(costs.size()))
+        {
+            total += costs[i].first;
+            node->children[i] = std::move(costs[i].second);
+        }
+        return total;
+    };
+    LogicNode& root = stack.front();
+    sort_by_cost(sort_by_cost, &root);
+
+    VecLogic result;
+    if (root.kind == LogicNode::Kind::constant && root.negated)
+    {
+        // Logic can never be satisfied
+        return result;
+    }
+
+    // Write explicit infix notation
+    auto emit = [&result](auto&& self, LogicNode const& node, bool outer) {
+        switch (node.kind)
+        {
+            case LogicNode::Kind::face:
+                if (node.negated)
+                {
+                    result.push_back(logic::lnot);
+                }
+                result.push_back(node.value);
+                return;
+            case LogicNode::Kind::constant:
+                CELER_ASSERT(!node.negated);
+                result.push_back(logic::ltrue);
+                return;
+            case LogicNode::Kind::join:
+                break;
+        }
+
+        if (!outer)
+        {
+            result.push_back(logic::lopen);
+        }
+        for (auto i : range(node.children.size()))
+        {
+            if (i != 0)
+            {
+                result.push_back(node.value);
+            }
+            self(self, node.children[i], false);
+        }
+        if (!outer)
+        {
+            result.push_back(logic::lclose);
+        }
+    };
+    emit(emit, root, true);
+
+    CELER_ENSURE(!result.empty());
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Estimate the relative cost of calculating the sense of a surface type.
+ *
+ * These are roughly the number of floating point operations needed to
+ * evaluate the quadric expression.
+ */
+size_type calc_sense_cost(SurfaceType st)
+{
+    switch (st)
+    {
+        case SurfaceType::px:
+        case SurfaceType::py:
+        case SurfaceType::pz:
+            return 1;
+        case SurfaceType::cxc:
+        case SurfaceType::cyc:
+        case SurfaceType::czc:
+        case SurfaceType::p:
+            return 3;
+        case SurfaceType::sc:
+            return 4;
+        case SurfaceType::cx:
+        case SurfaceType::cy:
+        case SurfaceType::cz:
+            return 5;
+        case SurfaceType::s:
+        case SurfaceType::kx:
+        case SurfaceType::ky:
+        case SurfaceType::kz:
+            return 6;
+        case SurfaceType::sq:
+            return 8;
+        case SurfaceType::gq:
+            return 12;
+        case SurfaceType::inv:
+            return 20;
+        case SurfaceType::size_:
+            break;
+    }
+    CELER_ASSERT_UNREACHABLE();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
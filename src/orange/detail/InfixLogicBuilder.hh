@@ -0,0 +1,69 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/InfixLogicBuilder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+#include "corecel/cont/Span.hh"
+
+#include "../OrangeTypes.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Precompile postfix volume logic for lazy, short-circuiting evaluation.
+ *
+ * The postfix logic from the unit input is parsed into a tree, and then:
+ * - negations are pushed down to the faces with DeMorgan's laws, since the
+ *   \c InfixEvaluator can only negate single faces;
+ * - nested joins of the same type are flattened, constants are folded, and
+ *   duplicate or complementary faces in a join are eliminated; and
+ * - the operands of each join are stably sorted by the estimated cost of
+ *   evaluating them, so that cheap surfaces (e.g., axis-aligned planes) can
+ *   short-circuit the evaluation of expensive ones.
+ *
+ * The result is an explicit infix expression suitable for the \c
+ * InfixEvaluator, which calculates a surface sense only when it's needed.
+ * Each join except the outermost is parenthesized. An empty result means the
+ * logic can never be satisfied (e.g., the "nowhere" logic of a background
+ * volume), which the infix notation cannot represent.
+ */
+class InfixLogicBuilder
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using VecLogic = std::vector<logic_int>;
+    using SpanConstLogic = Span<logic_int const>;
+    using SpanConstCost = Span<size_type const>;
+    //!@}
+
+  public:
+    // Construct with the relative cost of evaluating each face
+    explicit InfixLogicBuilder(SpanConstCost face_costs);
+
+    // Convert postfix logic into simplified, reordered infix logic
+    VecLogic operator()(SpanConstLogic postfix) const;
+
+  private:
+    SpanConstCost face_costs_;
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+
+// Estimate the relative cost of calculating the sense of a surface type
+size_type calc_sense_cost(SurfaceType st);
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -88,6 +88,11 @@ VariantTransform import_transform(nlohmann::json const& src)
     {
         return NoTransformation{};
     }
+    else if (data.size() == 1)
+    {
+        return SignedPermutation{
+            SignedPermutation::StorageSpan{make_span(data)}};
+    }
     else if (data.size() == 3)
     {
         return Translation{Translation::StorageSpan{make_span(data)}};
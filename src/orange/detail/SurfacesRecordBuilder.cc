@@ -7,8 +7,11 @@
 //---------------------------------------------------------------------------//
 #include "SurfacesRecordBuilder.hh"
 
+#include <algorithm>
 #include <variant>
 
+#include "orange/surf/SurfaceTypeTraits.hh"
+
 namespace celeritas
 {
 namespace detail
@@ -37,8 +40,11 @@ auto SurfacesRecordBuilder::operator()(VecSurface const& surfaces) -> result_typ
     auto begin_types = types_.size_id();
     auto begin_real_ids = real_ids_.size_id();
 
+    // Smallest set of types that includes every surface (sets are nested)
+    auto type_set = SurfaceTypeSet::plane_aligned;
+
     // Functor to save the surface type and data, and the data offset
-    auto emplace_surface = [this](auto&& s) {
+    auto emplace_surface = [this, &type_set](auto&& s) {
         if constexpr (std::remove_reference_t<decltype(s)>::surface_type()
                       == SurfaceType::inv)
         {
@@ -47,6 +53,7 @@ auto SurfacesRecordBuilder::operator()(VecSurface const& surfaces) -> result_typ
             CELER_NOT_IMPLEMENTED("runtime involute support");
         }
         types_.push_back(s.surface_type());
+        type_set = std::max(type_set, to_surface_type_set(s.surface_type()));
         auto data = s.data();
         auto real_range = reals_.insert_back(data.begin(), data.end());
         real_ids_.push_back(*real_range.begin());
@@ -62,6 +69,7 @@ auto SurfacesRecordBuilder::operator()(VecSurface const& surfaces) -> result_typ
     result_type result;
     result.types = {begin_types, types_.size_id()};
     result.data_offsets = {begin_real_ids, real_ids_.size_id()};
+    result.type_set = type_set;
 
     CELER_ENSURE(types_.size() == real_ids_.size());
     return result;
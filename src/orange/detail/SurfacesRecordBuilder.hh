@@ -25,7 +25,9 @@ namespace detail
 /*!
  * Convert a vector of surfaces into type-deleted local surface data.
  *
- * The input surfaces should already be deduplicated.
+ * The input surfaces should already be deduplicated. The record also stores
+ * the smallest set of surface types present so that trackers can specialize
+ * surface visitation for units that only have simple surfaces.
  */
 class SurfacesRecordBuilder
 {
@@ -0,0 +1,130 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/TransformRecordInserter.cc
+//---------------------------------------------------------------------------//
+#include "TransformRecordInserter.hh"
+
+#include "corecel/Assert.hh"
+
+#include "../transform/TransformHasher.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a transform to the most compact exactly equivalent type.
+ */
+struct TransformCompressor
+{
+    //! Other transforms are already as compact as possible
+    template<class T>
+    VariantTransform operator()(T const& t) const
+    {
+        return t;
+    }
+
+    //! Remove a translation that has no effect
+    VariantTransform operator()(Translation const& t) const
+    {
+        if (t.translation() == Real3{0, 0, 0})
+        {
+            return NoTransformation{};
+        }
+        return t;
+    }
+
+    //! Replace a full transformation with a simpler one if possible
+    VariantTransform operator()(Transformation const& t) const
+    {
+        if (t.rotation() == Transformation{}.rotation())
+        {
+            return (*this)(Translation{t.translation()});
+        }
+        if (t.translation() == Real3{0, 0, 0})
+        {
+            if (auto sp = try_make_permutation(t.rotation()))
+            {
+                return (*this)(*sp);
+            }
+        }
+        return t;
+    }
+
+    //! Remove an identity permutation
+    VariantTransform operator()(SignedPermutation const& sp) const
+    {
+        if (sp == SignedPermutation{})
+        {
+            return NoTransformation{};
+        }
+        return sp;
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with pointers to target data.
+ */
+TransformRecordInserter::TransformRecordInserter(
+    Items<TransformRecord>* transforms, Items<real_type>* reals)
+    : transforms_{transforms}, reals_{reals}
+{
+    CELER_EXPECT(transforms && reals);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from a transform variant, reusing an existing equal transform.
+ */
+TransformId TransformRecordInserter::operator()(VariantTransform const& tr)
+{
+    CELER_ASSUME(!tr.valueless_by_exception());
+    VariantTransform compressed = std::visit(TransformCompressor{}, tr);
+
+    auto [iter, inserted]
+        = cache_.insert({std::move(compressed), transforms_.size_id()});
+    if (!inserted)
+    {
+        // Return the ID of the existing identical transform
+        return iter->second;
+    }
+
+    TransformRecord record;
+    std::visit(
+        [this, &record](auto const& t) {
+            record.type = t.transform_type();
+            auto data = t.data();
+            record.data_offset
+                = *reals_.insert_back(data.begin(), data.end()).begin();
+        },
+        iter->first);
+
+    CELER_ASSERT(record);
+    TransformId result = transforms_.push_back(record);
+    CELER_ENSURE(result == iter->second);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the hash of a transform.
+ */
+std::size_t TransformRecordInserter::HashTransform::operator()(
+    VariantTransform const& vt) const
+{
+    return visit(TransformHasher{}, vt);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <unordered_map>
+
 #include "corecel/Macros.hh"
 #include "corecel/data/Collection.hh"
 #include "corecel/data/CollectionBuilder.hh"
@@ -21,10 +23,18 @@ namespace detail
 {
 //---------------------------------------------------------------------------//
 /*!
- * Construct a compressed transform from a variant.
+ * Construct a compressed, deduplicated transform from a variant.
+ *
+ * Each transform is first converted to the most compact type that represents
+ * it \em exactly: a transformation with an identity rotation becomes a
+ * translation, one with no translation and an axis-aligned rotation becomes a
+ * signed permutation, and a zero translation becomes no transformation. This
+ * reduces both storage and the number of floating point operations needed to
+ * apply the transform during tracking. (Simplification that requires a
+ * tolerance is done during construction by \c TransformSimplifier.)
  *
- * TODO: deduplicate transforms via hashes? Define special compressed transform
- * for 90-degree rotations?
+ * Identical transforms, such as the placements of repeated daughter
+ * universes, are then deduplicated with a hash table and share a single ID.
  */
 class TransformRecordInserter
 {
@@ -37,75 +47,26 @@ class TransformRecordInserter
 
   public:
     // Construct with pointers to target data
-    inline TransformRecordInserter(Items<TransformRecord>* transforms,
-                                   Items<real_type>* reals);
+    TransformRecordInserter(Items<TransformRecord>* transforms,
+                            Items<real_type>* reals);
 
     // Return a transform ID from a transform variant
-    inline TransformId operator()(VariantTransform const& tr);
-
-    // Construct a transform using known type
-    template<class T>
-    inline TransformId operator()(T const& tr);
+    TransformId operator()(VariantTransform const& tr);
 
   private:
-    TransformId null_transform_;
-    CollectionBuilder<TransformRecord> transforms_;
-    DedupeCollectionBuilder<real_type> reals_;
-};
-
-//---------------------------------------------------------------------------//
-// INLINE DEFINITIONS
-//---------------------------------------------------------------------------//
-/*!
- * Construct with pointers to target data.
- */
-TransformRecordInserter::TransformRecordInserter(
-    Items<TransformRecord>* transforms, Items<real_type>* reals)
-    : transforms_{transforms}, reals_{reals}
-{
-    CELER_EXPECT(transforms && reals);
-}
+    //// TYPES ////
 
-//---------------------------------------------------------------------------//
-/*!
- * Construct from a transform variant.
- */
-TransformId TransformRecordInserter::operator()(VariantTransform const& tr)
-{
-    CELER_ASSUME(!tr.valueless_by_exception());
-    return std::visit(*this, tr);
-}
-
-//---------------------------------------------------------------------------//
-/*!
- * Construct from a transform with a known type.
- */
-template<class T>
-TransformId TransformRecordInserter::operator()(T const& tr)
-{
-    /*!
-     * \todo Add equality and hash for TransformRecord and replace this with
-     * just a dedupe collection builder.
-     */
-    if constexpr (std::is_same_v<T, NoTransformation>)
+    struct HashTransform
     {
-        // Reuse the same null transform ID everywhere
-        if (null_transform_)
-        {
-            return null_transform_;
-        }
-        // Save the transform ID for later
-        null_transform_ = transforms_.size_id();
-    }
+        std::size_t operator()(VariantTransform const&) const;
+    };
 
-    TransformRecord record;
-    record.type = tr.transform_type();
-    auto data = tr.data();
-    record.data_offset = *reals_.insert_back(data.begin(), data.end()).begin();
+    //// DATA ////
 
-    CELER_ASSERT(record);
-    return transforms_.push_back(record);
-}
+    CollectionBuilder<TransformRecord> transforms_;
+    DedupeCollectionBuilder<real_type> reals_;
+    std::unordered_map<VariantTransform, TransformId, HashTransform> cache_;
+};
 
 //---------------------------------------------------------------------------//
 }  // namespace detail
@@ -24,6 +24,7 @@
 #include "corecel/math/Algorithms.hh"
 #include "corecel/sys/Environment.hh"
 
+#include "InfixLogicBuilder.hh"
 #include "UniverseInserter.hh"
 #include "../OrangeInput.hh"
 #include "../surf/LocalSurfaceVisitor.hh"
@@ -121,6 +122,17 @@ struct NumIntersectionGetter
     }
 };
 
+//---------------------------------------------------------------------------//
+//! Return the relative cost of calculating a surface's sense
+struct SenseCostGetter
+{
+    template<class S>
+    size_type operator()(S const&) const
+    {
+        return calc_sense_cost(S::surface_type());
+    }
+};
+
 //---------------------------------------------------------------------------//
 //! Construct surface labels, empty if needed
 std::vector<Label> make_surface_labels(UnitInput& inp)
@@ -388,12 +400,14 @@ VolumeRecord UnitInserter::insert_volume(SurfacesRecord const& surf_record,
     // Mark as 'simple safety' if all the surfaces are simple
     bool simple_safety = true;
     size_type max_intersections = 0;
+    std::vector<size_type> face_costs;
 
     for (LocalSurfaceId sid : v.faces)
     {
         simple_safety = simple_safety
                         && visit_surface(SimpleSafetyGetter{}, sid);
         max_intersections += visit_surface(NumIntersectionGetter{}, sid);
+        face_costs.push_back(visit_surface(SenseCostGetter{}, sid));
     }
 
     static logic_int const nowhere_logic[] = {logic::ltrue, logic::lnot};
@@ -417,8 +431,11 @@ VolumeRecord UnitInserter::insert_volume(SurfacesRecord const& surf_record,
     VolumeRecord output;
     output.faces
         = local_surface_ids_.insert_back(v.faces.begin(), v.faces.end());
-    output.logic
-        = logic_ints_.insert_back(input_logic.begin(), input_logic.end());
+    {
+        // Precompile the postfix input into infix for lazy sense evaluation
+        auto logic = InfixLogicBuilder{make_span(face_costs)}(input_logic);
+        output.logic = logic_ints_.insert_back(logic.begin(), logic.end());
+    }
     output.max_intersections = static_cast<logic_int>(max_intersections);
     output.flags = v.flags;
     if (simple_safety)
@@ -436,8 +453,7 @@ VolumeRecord UnitInserter::insert_volume(SurfacesRecord const& surf_record,
                            << "': replacing with unreachable volume";
 
         output.faces = {};
-        output.logic = logic_ints_.insert_back(std::begin(nowhere_logic),
-                                               std::end(nowhere_logic));
+        output.logic = {};
         output.max_intersections = 0;
         output.flags = VolumeRecord::implicit_vol
                        | VolumeRecord::Flags::simple_safety;
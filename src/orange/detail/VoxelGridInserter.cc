@@ -0,0 +1,109 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/VoxelGridInserter.cc
+//---------------------------------------------------------------------------//
+#include "VoxelGridInserter.hh"
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/Collection.hh"
+
+#include "UniverseInserter.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from full parameter data.
+ */
+VoxelGridInserter::VoxelGridInserter(UniverseInserter* insert_universe,
+                                     Data* orange_data)
+    : insert_universe_{insert_universe}
+    , voxel_grids_{&orange_data->voxel_grids}
+    , voxels_{&orange_data->voxels}
+{
+    CELER_EXPECT(insert_universe && orange_data);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create a voxel grid and return its ID.
+ */
+UniverseId VoxelGridInserter::operator()(VoxelGridInput const& inp)
+{
+    CELER_VALIDATE(inp,
+                   << "voxel grid '" << inp.label
+                   << "' is not properly constructed");
+
+    auto num_volumes = inp.volume_labels.size();
+    CELER_VALIDATE(num_volumes <= static_cast<std::size_t>(
+                       std::numeric_limits<voxel_int>::max()) + 1,
+                   << "too many volumes (" << num_volumes
+                   << ") in voxel grid '" << inp.label << "'");
+    auto max_voxel = *std::max_element(inp.voxels.begin(), inp.voxels.end());
+    CELER_VALIDATE(max_voxel < num_volumes,
+                   << "voxel volume index " << max_voxel
+                   << " in voxel grid '" << inp.label
+                   << "' exceeds the number of volumes (" << num_volumes
+                   << ")");
+
+    VoxelGridRecord record;
+    VoxelGridRecord::SurfaceIndexerData::Sizes sizes;
+    std::vector<Label> surface_labels;
+    for (auto ax : range(Axis::size_))
+    {
+        auto i = to_int(ax);
+        record.dims[i] = inp.dims[i];
+        record.origin[i] = inp.origin[i];
+        record.width[i] = inp.width[i];
+        sizes[i] = inp.dims[i] + 1;
+
+        // Create surface labels
+        for (auto p : range(sizes[i]))
+        {
+            Label sl;
+            sl.name = std::string("{" + std::string(1, to_char(ax)) + ","
+                                  + std::to_string(p) + "}");
+            sl.ext = inp.label.name;
+            surface_labels.push_back(std::move(sl));
+        }
+    }
+    record.surface_indexer_data
+        = VoxelGridRecord::SurfaceIndexerData::from_sizes(sizes);
+    record.num_volumes = num_volumes;
+    record.voxels = voxels_.insert_back(inp.voxels.begin(), inp.voxels.end());
+
+    // Volume labels are scoped by the universe
+    std::vector<Label> volume_labels = inp.volume_labels;
+    for (auto& vl : volume_labels)
+    {
+        if (vl.ext.empty())
+        {
+            vl.ext = inp.label.name;
+        }
+    }
+
+    // Add voxel grid record
+    CELER_ASSERT(record);
+    voxel_grids_.push_back(record);
+
+    // Construct universe
+    return (*insert_universe_)(UniverseType::voxel_grid,
+                               inp.label,
+                               std::move(surface_labels),
+                               std::move(volume_labels));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
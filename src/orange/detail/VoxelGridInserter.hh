@@ -0,0 +1,50 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/VoxelGridInserter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Types.hh"
+#include "corecel/data/CollectionBuilder.hh"
+
+#include "../OrangeData.hh"
+#include "../OrangeInput.hh"
+#include "../OrangeTypes.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+class UniverseInserter;
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a VoxelGridInput to a VoxelGridRecord.
+ */
+class VoxelGridInserter
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Data = HostVal<OrangeParamsData>;
+    //!@}
+
+  public:
+    // Construct with universe inserter and parameter data
+    VoxelGridInserter(UniverseInserter* insert_universe, Data* orange_data);
+
+    // Create a voxel grid and return its ID
+    UniverseId operator()(VoxelGridInput const& inp);
+
+  private:
+    UniverseInserter* insert_universe_;
+
+    CollectionBuilder<VoxelGridRecord> voxel_grids_;
+    CollectionBuilder<voxel_int> voxels_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -29,6 +29,11 @@ namespace celeritas
     [&pos](auto const& s) { return s.calc_sense(pos); },
     surface_id);
  \endcode
+ *
+ * If the surface types of a unit are known to be restricted (see \c
+ * SurfacesRecord::type_set), passing the corresponding \c SurfaceTypeList
+ * replaces the switch over all surface types with a few comparisons (or none,
+ * for a single type).
  */
 class LocalSurfaceVisitor
 {
@@ -53,6 +58,11 @@ class LocalSurfaceVisitor
     inline CELER_FUNCTION decltype(auto)
     operator()(F&& typed_visitor, LocalSurfaceId t);
 
+    // Apply the function to a surface whose type is in the given list
+    template<class F, SurfaceType... STs>
+    inline CELER_FUNCTION decltype(auto)
+    operator()(F&& typed_visitor, LocalSurfaceId t, SurfaceTypeList<STs...>);
+
   private:
     //// TYPES ////
 
@@ -123,6 +133,27 @@ LocalSurfaceVisitor::operator()(F&& func, LocalSurfaceId id)
         },
         this->get_item(params_.surface_types, surfaces_.types, id));
 }
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the function to a surface whose type is in the given list.
+ */
+template<class F, SurfaceType... STs>
+CELER_FUNCTION decltype(auto)
+LocalSurfaceVisitor::operator()(F&& func,
+                                LocalSurfaceId id,
+                                SurfaceTypeList<STs...> types)
+{
+    CELER_EXPECT(id < surfaces_.size());
+
+    return visit_surface_type(
+        [this, &func, id](auto s_traits) {
+            using S = typename decltype(s_traits)::type;
+            return func(this->make_surface<S>(id));
+        },
+        this->get_item(params_.surface_types, surfaces_.types, id),
+        types);
+}
 #endif
 
 //---------------------------------------------------------------------------//
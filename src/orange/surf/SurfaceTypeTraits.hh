@@ -101,5 +101,130 @@ visit_surface_type(F&& func, SurfaceType st)
 #undef ORANGE_ST_VISIT_CASE
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Compile-time list of surface types.
+ *
+ * An empty list denotes an unrestricted set of surface types.
+ */
+template<SurfaceType... STs>
+struct SurfaceTypeList
+{
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Map a set of surface types to a compile-time list.
+ */
+template<SurfaceTypeSet S>
+struct SurfaceTypeSetTraits;
+
+template<>
+struct SurfaceTypeSetTraits<SurfaceTypeSet::plane_aligned>
+{
+    using types
+        = SurfaceTypeList<SurfaceType::px, SurfaceType::py, SurfaceType::pz>;
+};
+
+template<>
+struct SurfaceTypeSetTraits<SurfaceTypeSet::cyl_centered>
+{
+    using types = SurfaceTypeList<SurfaceType::px,
+                                  SurfaceType::py,
+                                  SurfaceType::pz,
+                                  SurfaceType::cxc,
+                                  SurfaceType::cyc,
+                                  SurfaceType::czc>;
+};
+
+template<>
+struct SurfaceTypeSetTraits<SurfaceTypeSet::all>
+{
+    using types = SurfaceTypeList<>;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the smallest set of surface types that includes the given type.
+ */
+CELER_CONSTEXPR_FUNCTION SurfaceTypeSet to_surface_type_set(SurfaceType st)
+{
+    switch (st)
+    {
+        case SurfaceType::px:
+        case SurfaceType::py:
+        case SurfaceType::pz:
+            return SurfaceTypeSet::plane_aligned;
+        case SurfaceType::cxc:
+        case SurfaceType::cyc:
+        case SurfaceType::czc:
+            return SurfaceTypeSet::cyl_centered;
+        default:
+            return SurfaceTypeSet::all;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Expand a run-time surface type, restricted to a list, into a class.
+ *
+ * Since the type must be in the list, the final candidate is assumed without
+ * checking, so a single-type list has no branching at all. An empty list
+ * dispatches over all surface types.
+ */
+template<class F>
+CELER_CONSTEXPR_FUNCTION decltype(auto)
+visit_surface_type(F&& func, SurfaceType st, SurfaceTypeList<>)
+{
+    return visit_surface_type(celeritas::forward<F>(func), st);
+}
+
+template<class F, SurfaceType ST, SurfaceType... STs>
+CELER_CONSTEXPR_FUNCTION decltype(auto)
+visit_surface_type(F&& func, SurfaceType st, SurfaceTypeList<ST, STs...>)
+{
+    if constexpr (sizeof...(STs) == 0)
+    {
+        CELER_ASSUME(st == ST);
+        return celeritas::forward<F>(func)(SurfaceTypeTraits<ST>{});
+    }
+    else
+    {
+        if (st == ST)
+        {
+            return celeritas::forward<F>(func)(SurfaceTypeTraits<ST>{});
+        }
+        return visit_surface_type(
+            celeritas::forward<F>(func), st, SurfaceTypeList<STs...>{});
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Expand a run-time set of surface types into a compile-time traits class.
+ *
+ * The \c func argument should be a functor that takes a single argument which
+ * is a SurfaceTypeSetTraits instance.
+ */
+template<class F>
+CELER_CONSTEXPR_FUNCTION decltype(auto)
+visit_surface_type_set(F&& func, SurfaceTypeSet sts)
+{
+#define ORANGE_STS_VISIT_CASE(SET)          \
+    case SurfaceTypeSet::SET:               \
+        return celeritas::forward<F>(func)( \
+            SurfaceTypeSetTraits<SurfaceTypeSet::SET>{})
+
+    switch (sts)
+    {
+        ORANGE_STS_VISIT_CASE(plane_aligned);
+        ORANGE_STS_VISIT_CASE(cyl_centered);
+        ORANGE_STS_VISIT_CASE(all);
+        default:
+            CELER_ASSERT_UNREACHABLE();
+    }
+#undef ORANGE_STS_VISIT_CASE
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
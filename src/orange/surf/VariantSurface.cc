@@ -39,6 +39,12 @@ struct VariantTransformDispatcher
         return std::visit(
             return_as<VariantSurface>(detail::SurfaceTransformer{left}), right);
     }
+
+    //! Apply a signed permutation by promoting it to a transformation
+    VariantSurface operator()(SignedPermutation const& left) const
+    {
+        return (*this)(Transformation{left});
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -90,6 +90,24 @@ auto SignedPermutation::permutation() const -> SignedAxes
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the inverse during preprocessing.
+ *
+ * The inverse of a permutation matrix is its transpose: each row's nonzero
+ * entry is moved to the row given by its column.
+ */
+SignedPermutation SignedPermutation::calc_inverse() const
+{
+    SignedAxes const perm = this->permutation();
+    SignedAxes result;
+    for (auto ax : range(Axis::size_))
+    {
+        result[perm[ax].second] = {perm[ax].first, ax};
+    }
+    return SignedPermutation{result};
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get a view to the data for type-deleted storage.
@@ -136,5 +154,47 @@ SignedPermutation make_permutation(Axis ax, QuarterTurn theta)
     return SignedPermutation{r};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Make a permutation from a rotation matrix if it is exactly representable.
+ *
+ * The matrix must have exactly one nonzero entry of \f$\pm 1\f$ in each row
+ * and column, and it must be a proper rotation (no reflection). Since the
+ * result is used to replace a full transformation, no tolerance is applied:
+ * a matrix that is only approximately a permutation is rejected.
+ */
+std::optional<SignedPermutation>
+try_make_permutation(SquareMatrixReal3 const& rot)
+{
+    SignedPermutation::SignedAxes result;
+    for (auto ax : range(Axis::size_))
+    {
+        int num_nonzero{0};
+        for (auto oax : range(Axis::size_))
+        {
+            real_type const v = rot[to_int(ax)][to_int(oax)];
+            if (v == 0)
+            {
+                continue;
+            }
+            if ((v != 1 && v != -1) || ++num_nonzero > 1)
+            {
+                return std::nullopt;
+            }
+            result[ax] = {v < 0 ? '-' : '+', oax};
+        }
+        if (num_nonzero == 0)
+        {
+            return std::nullopt;
+        }
+    }
+    if (determinant(rot) != 1)
+    {
+        // Duplicate columns or a reflection
+        return std::nullopt;
+    }
+    return SignedPermutation{result};
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
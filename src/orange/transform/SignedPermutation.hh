@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <optional>
+
 #include "corecel/cont/EnumArray.hh"
 #include "corecel/cont/Range.hh"
 #include "corecel/cont/Span.hh"
@@ -66,6 +68,12 @@ class SignedPermutation
     using UIntT = short unsigned int;
     //!@}
 
+    //! Transform type identifier
+    static CELER_CONSTEXPR_FUNCTION TransformType transform_type()
+    {
+        return TransformType::signed_permutation;
+    }
+
   public:
     // Construct with an identity permutation
     SignedPermutation();
@@ -104,6 +112,9 @@ class SignedPermutation
     [[nodiscard]] inline CELER_FUNCTION Real3
     rotate_down(Real3 const& parent_dir) const;
 
+    // Calculate the inverse during preprocessing
+    SignedPermutation calc_inverse() const;
+
   private:
     //// DATA ////
 
@@ -122,6 +133,10 @@ class SignedPermutation
 // Make a permutation by rotating about the given axis
 SignedPermutation make_permutation(Axis ax, QuarterTurn qtr);
 
+// Make a permutation from a rotation matrix if it is exactly representable
+std::optional<SignedPermutation>
+try_make_permutation(SquareMatrixReal3 const& rot);
+
 //!@{
 //! Host-only comparators
 inline bool operator==(SignedPermutation const& a, SignedPermutation const& b)
@@ -9,6 +9,7 @@
 
 #include "corecel/cont/ArrayIO.hh"
 
+#include "SignedPermutation.hh"
 #include "Transformation.hh"
 #include "Translation.hh"
 
@@ -33,5 +34,21 @@ std::ostream& operator<<(std::ostream& os, Transformation const& tr)
     return os;
 }
 
+std::ostream& operator<<(std::ostream& os, SignedPermutation const& tr)
+{
+    auto const perm = tr.permutation();
+    os << '{';
+    for (auto ax : range(Axis::size_))
+    {
+        if (ax != Axis::x)
+        {
+            os << ", ";
+        }
+        os << perm[ax].first << to_char(perm[ax].second);
+    }
+    os << '}';
+    return os;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -20,6 +20,7 @@ namespace celeritas
 std::ostream& operator<<(std::ostream&, NoTransformation const&);
 std::ostream& operator<<(std::ostream&, Translation const&);
 std::ostream& operator<<(std::ostream&, Transformation const&);
+std::ostream& operator<<(std::ostream&, SignedPermutation const&);
 
 //!@}
 //---------------------------------------------------------------------------//
@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #include "TransformSimplifier.hh"
 
+#include <cmath>
+
 #include "corecel/math/ArrayUtils.hh"
 #include "orange/MatrixUtils.hh"
 
@@ -28,7 +30,7 @@ VariantTransform TransformSimplifier::operator()(Translation const& t)
 
 //---------------------------------------------------------------------------//
 /*!
- * Simplify, possibly to translation or no transform.
+ * Simplify, possibly to translation, permutation, or no transform.
  *
  * See the derivation in the class documentation.
  */
@@ -40,8 +42,42 @@ VariantTransform TransformSimplifier::operator()(Transformation const& t)
         // Rotation results in no more then epsilon movement
         return (*this)(Translation{t.translation()});
     }
+    if (norm(t.translation()) <= eps_)
+    {
+        // Snap nearly-integer matrix elements and check for a permutation
+        auto rot = t.rotation();
+        for (auto& row : rot)
+        {
+            for (auto& v : row)
+            {
+                real_type const rounded = std::round(v);
+                if (std::fabs(v - rounded) > eps_)
+                {
+                    return t;
+                }
+                v = rounded;
+            }
+        }
+        if (auto sp = try_make_permutation(rot))
+        {
+            return (*this)(*sp);
+        }
+    }
     return t;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Signed permutation may simplify to no transformation.
+ */
+VariantTransform TransformSimplifier::operator()(SignedPermutation const& sp)
+{
+    if (sp == SignedPermutation{})
+    {
+        return NoTransformation{};
+    }
+    return sp;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
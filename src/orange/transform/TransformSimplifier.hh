@@ -41,6 +41,11 @@ namespace celeritas
  *
  * Note that this means no rotational simplifications may be performed when the
  * geometry tolerance is less than the square root of machine precision.
+ *
+ * A transformation with no translation whose rotation matrix elements are all
+ * within \f$\epsilon\f$ of zero or unity is stored as a *signed
+ * permutation*, which requires a single value and no floating point
+ * operations to apply.
  */
 class TransformSimplifier
 {
@@ -54,9 +59,12 @@ class TransformSimplifier
     // Translation may simplify to no transformation
     VariantTransform operator()(Translation const& nt);
 
-    // Simplify, possibly to translation or no transform
+    // Simplify, possibly to translation, permutation, or no transform
     VariantTransform operator()(Transformation const& nt);
 
+    // Signed permutation may simplify to no transformation
+    VariantTransform operator()(SignedPermutation const& sp);
+
   private:
     real_type eps_;
 };
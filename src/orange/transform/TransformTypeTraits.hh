@@ -15,6 +15,7 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 
 class NoTransformation;
+class SignedPermutation;
 class Transformation;
 class Translation;
 
@@ -35,6 +36,7 @@ struct TransformTypeTraits;
 ORANGE_TRANSFORM_TRAITS(no_transformation, NoTransformation);
 ORANGE_TRANSFORM_TRAITS(translation, Translation);
 ORANGE_TRANSFORM_TRAITS(transformation, Transformation);
+ORANGE_TRANSFORM_TRAITS(signed_permutation, SignedPermutation);
 
 #undef ORANGE_TRANSFORM_TRAITS
 
@@ -59,6 +61,7 @@ visit_transform_type(F&& func, TransformType st)
         ORANGE_TT_VISIT_CASE(no_transformation);
         ORANGE_TT_VISIT_CASE(translation);
         ORANGE_TT_VISIT_CASE(transformation);
+        ORANGE_TT_VISIT_CASE(signed_permutation);
         default:
             CELER_ASSERT_UNREACHABLE();
     }
@@ -11,6 +11,7 @@
 #include "orange/OrangeData.hh"
 
 #include "NoTransformation.hh"
+#include "SignedPermutation.hh"
 #include "TransformTypeTraits.hh"
 #include "Transformation.hh"
 #include "Translation.hh"
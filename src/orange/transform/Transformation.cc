@@ -12,6 +12,7 @@
 #include "corecel/math/SoftEqual.hh"
 #include "orange/MatrixUtils.hh"
 
+#include "SignedPermutation.hh"
 #include "Translation.hh"
 
 namespace celeritas
@@ -63,6 +64,21 @@ Transformation::Transformation(Translation const& tr)
 {
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Promote from a signed permutation.
+ */
+Transformation::Transformation(SignedPermutation const& sp)
+    : rot_{Real3{0, 0, 0}, Real3{0, 0, 0}, Real3{0, 0, 0}}, tra_{0, 0, 0}
+{
+    auto const perm = sp.permutation();
+    for (auto ax : range(Axis::size_))
+    {
+        auto const& [sign, new_ax] = perm[ax];
+        rot_[to_int(ax)][to_int(new_ax)] = (sign == '-' ? -1 : 1);
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Calculate the inverse during preprocessing.
@@ -45,6 +45,12 @@ struct VariantTransformDispatcher
             return_as<VariantTransform>(detail::TransformTransformer{left}),
             right);
     }
+
+    //! Apply a signed permutation by promoting it to a transformation
+    VariantTransform operator()(SignedPermutation const& left) const
+    {
+        return (*this)(Transformation{left});
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -58,6 +64,17 @@ calc_transform(NoTransformation const&, BoundingBox<T> const& bbox)
     return bbox;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a signed permutation to a bounding box.
+ */
+template<class T>
+BoundingBox<T>
+calc_transform(SignedPermutation const& sp, BoundingBox<T> const& bbox)
+{
+    return calc_transform(Transformation{sp}, bbox);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace
 
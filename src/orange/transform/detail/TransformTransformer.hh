@@ -11,6 +11,7 @@
 #include "orange/MatrixUtils.hh"
 
 #include "../NoTransformation.hh"
+#include "../SignedPermutation.hh"
 #include "../Transformation.hh"
 #include "../Translation.hh"
 
@@ -68,6 +69,7 @@ class TransformTransformer
     inline Transformation operator()(Mat3 const&) const;
     inline Transformation operator()(Transformation const&) const;
     inline Transformation operator()(Translation const&) const;
+    inline Transformation operator()(SignedPermutation const&) const;
     //!@}
 
   private:
@@ -104,6 +106,16 @@ Transformation TransformTransformer::operator()(Translation const& other) const
                           tr_.transform_up(other.translation())};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a transformation to a signed permutation.
+ */
+Transformation
+TransformTransformer::operator()(SignedPermutation const& other) const
+{
+    return (*this)(Transformation{other});
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace celeritas
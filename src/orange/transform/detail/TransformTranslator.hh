@@ -12,6 +12,7 @@
 #include "orange/MatrixUtils.hh"
 
 #include "../NoTransformation.hh"
+#include "../SignedPermutation.hh"
 #include "../Transformation.hh"
 #include "../Translation.hh"
 
@@ -76,6 +77,8 @@ class TransformTranslator
 
     inline Translation operator()(Translation const&) const;
 
+    inline Transformation operator()(SignedPermutation const&) const;
+
   private:
     Translation tr_;
 };
@@ -107,6 +110,16 @@ Translation TransformTranslator::operator()(Translation const& tl) const
     return Translation{tl.translation() + tr_.translation()};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a translation to a signed permutation.
+ */
+Transformation
+TransformTranslator::operator()(SignedPermutation const& sp) const
+{
+    return (*this)(Transformation{sp});
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace celeritas
@@ -14,7 +14,7 @@
 #include "orange/surf/LocalSurfaceVisitor.hh"
 
 #include "detail/InfixEvaluator.hh"
-#include "detail/LogicEvaluator.hh"
+#include "detail/LazySenseCalculator.hh"
 #include "detail/SenseCalculator.hh"
 #include "detail/SurfaceFunctors.hh"
 #include "detail/Types.hh"
@@ -30,6 +30,10 @@ namespace celeritas
  * comprised of surfaces. It is a faster but less "user-friendly" version of
  * the masked unit tracker because it requires all volumes to be exactly
  * defined by their connected surfaces. It does *not* check for overlaps.
+ *
+ * The loops over volume faces for intersection and safety are specialized on
+ * the set of surface types in the unit, so that units with only axis-aligned
+ * planes (and centered cylinders) skip the general surface type dispatch.
  */
 class SimpleUnitTracker
 {
@@ -165,18 +169,24 @@ SimpleUnitTracker::initialize(LocalState const& state) const -> Initialization
     CELER_EXPECT(params_);
     CELER_EXPECT(!state.surface && !state.volume);
 
-    detail::SenseCalculator calc_senses(
-        this->make_surface_visitor(), state.pos, state.temp_sense);
+    auto visit = this->make_surface_visitor();
 
     // Use the BIH to locate a position that's inside, and save whether it's on
     // a surface in the found volume
     bool on_surface{false};
     auto is_inside
-        = [this, &calc_senses, &on_surface](LocalVolumeId id) -> bool {
+        = [this, &visit, &state, &on_surface](LocalVolumeId id) -> bool {
         VolumeView vol = this->make_local_volume(id);
-        auto logic_state = calc_senses(vol);
-        on_surface = static_cast<bool>(logic_state.face);
-        return detail::LogicEvaluator(vol.logic())(logic_state.senses);
+        auto logic = vol.logic();
+        if (logic.empty())
+        {
+            // Volume is never reachable by a logical test
+            return false;
+        }
+        detail::LazySenseCalculator calc_sense(visit, vol, state.pos);
+        bool inside = detail::InfixEvaluator(logic)(calc_sense);
+        on_surface = static_cast<bool>(calc_sense.face());
+        return inside;
     };
     LocalVolumeId id = this->find_volume_where(state.pos, is_inside);
 
@@ -202,12 +212,11 @@ CELER_FUNCTION auto
 SimpleUnitTracker::cross_boundary(LocalState const& state) const -> Initialization
 {
     CELER_EXPECT(state.surface && state.volume);
-    detail::SenseCalculator calc_senses(
-        this->make_surface_visitor(), state.pos, state.temp_sense);
+    auto visit = this->make_surface_visitor();
 
     detail::OnLocalSurface on_surface;
-    auto is_inside = [this, &state, &calc_senses, &on_surface](
-                         LocalVolumeId const& id) -> bool {
+    auto is_inside
+        = [this, &visit, &state, &on_surface](LocalVolumeId id) -> bool {
         if (id == state.volume)
         {
             // Cannot cross surface into the same volume
@@ -215,13 +224,19 @@ SimpleUnitTracker::cross_boundary(LocalState const& state) const -> Initializati
         }
 
         VolumeView vol = this->make_local_volume(id);
-        auto logic_state
-            = calc_senses(vol, detail::find_face(vol, state.surface));
+        auto logic = vol.logic();
+        if (logic.empty())
+        {
+            // Volume is never reachable by a logical test
+            return false;
+        }
+        detail::LazySenseCalculator calc_sense(
+            visit, vol, state.pos, detail::find_face(vol, state.surface));
 
-        if (detail::LogicEvaluator(vol.logic())(logic_state.senses))
+        if (detail::InfixEvaluator(logic)(calc_sense))
         {
             // Inside: find and save the local surface ID, and end the search
-            on_surface = get_surface(vol, logic_state.face);
+            on_surface = get_surface(vol, calc_sense.face());
             return true;
         }
         return false;
@@ -309,10 +324,16 @@ CELER_FUNCTION real_type SimpleUnitTracker::safety(Real3 const& pos,
     real_type result = numeric_limits<real_type>::infinity();
     LocalSurfaceVisitor visit_surface(params_, unit_record_.surfaces);
     detail::CalcSafetyDistance calc_safety{pos};
-    for (LocalSurfaceId surface : vol.faces())
-    {
-        result = celeritas::min(result, visit_surface(calc_safety, surface));
-    }
+    visit_surface_type_set(
+        [&](auto sts_traits) {
+            using Types = typename decltype(sts_traits)::types;
+            for (LocalSurfaceId surface : vol.faces())
+            {
+                result = celeritas::min(
+                    result, visit_surface(calc_safety, surface, Types{}));
+            }
+        },
+        unit_record_.surfaces.type_set);
 
     CELER_ENSURE(result >= 0);
     return result;
@@ -409,10 +430,16 @@ SimpleUnitTracker::intersect_impl(LocalState const& state,
         vol.simple_intersection(),
         state.temp_next};
     LocalSurfaceVisitor visit_surface(params_, unit_record_.surfaces);
-    for (LocalSurfaceId surface : vol.faces())
-    {
-        visit_surface(calc_intersections, surface);
-    }
+    visit_surface_type_set(
+        [&](auto sts_traits) {
+            // Specialize the loop for units with only simple surface types
+            using Types = typename decltype(sts_traits)::types;
+            for (LocalSurfaceId surface : vol.faces())
+            {
+                visit_surface(calc_intersections, surface, Types{});
+            }
+        },
+        unit_record_.surfaces.type_set);
     CELER_ASSERT(calc_intersections.face_idx() == vol.num_faces());
     size_type num_isect = calc_intersections.isect_idx();
     CELER_ASSERT(num_isect <= vol.max_intersections());
@@ -533,8 +560,11 @@ SimpleUnitTracker::complex_intersect(LocalState const& state,
         vol, detail::find_face(vol, state.surface));
 
     // Current senses should put us inside the volume
-    detail::LogicEvaluator is_inside(vol.logic());
-    CELER_ASSERT(is_inside(logic_state.senses));
+    detail::InfixEvaluator is_inside(vol.logic());
+    auto eval_sense = [&senses = logic_state.senses](FaceId f) {
+        return static_cast<bool>(senses[f.unchecked_get()]);
+    };
+    CELER_ASSERT(is_inside(eval_sense));
 
     // Loop over distances and surface indices to cross by iterating over
     // temp_next.isect[:num_isect].
@@ -549,7 +579,7 @@ SimpleUnitTracker::complex_intersect(LocalState const& state,
         // Flip the sense of the face being crossed
         Sense new_sense = flip_sense(logic_state.senses[face.get()]);
         logic_state.senses[face.unchecked_get()] = new_sense;
-        if (!is_inside(logic_state.senses))
+        if (!is_inside(eval_sense))
         {
             // Flipping this sense puts us outside the current volume: in
             // other words, only after crossing all the internal surfaces along
@@ -622,8 +652,11 @@ CELER_FUNCTION auto SimpleUnitTracker::background_intersect(
             VolumeView vol = this->make_local_volume(vid);
             auto logic_state = detail::SenseCalculator{
                 this->make_surface_visitor(), pos, state.temp_sense}(vol);
+            auto eval_sense = [&senses = logic_state.senses](FaceId f) {
+                return static_cast<bool>(senses[f.unchecked_get()]);
+            };
 
-            if (detail::LogicEvaluator{vol.logic()}(logic_state.senses))
+            if (detail::InfixEvaluator{vol.logic()}(eval_sense))
             {
                 // We are in this new volume by crossing the tested surface.
                 // Get the sense corresponding to this "crossed" surface.
@@ -13,6 +13,7 @@
 #include "RectArrayTracker.hh"
 #include "SimpleUnitTracker.hh"
 #include "UniverseTypeTraits.hh"
+#include "VoxelGridTracker.hh"
 
 namespace celeritas
 {
@@ -16,6 +16,7 @@ namespace celeritas
 struct SimpleUnitRecord;
 class SimpleUnitTracker;
 class RectArrayTracker;
+class VoxelGridTracker;
 
 //---------------------------------------------------------------------------//
 /*!
@@ -34,6 +35,7 @@ struct UniverseTypeTraits;
 
 ORANGE_UNIV_TRAITS(simple, SimpleUnit);
 ORANGE_UNIV_TRAITS(rect_array, RectArray);
+ORANGE_UNIV_TRAITS(voxel_grid, VoxelGrid);
 
 #undef ORANGE_UNIV_TRAITS
 
@@ -57,6 +59,7 @@ visit_universe_type(F&& func, UniverseType ut)
     {
         ORANGE_UT_VISIT_CASE(simple);
         ORANGE_UT_VISIT_CASE(rect_array);
+        ORANGE_UT_VISIT_CASE(voxel_grid);
         default:
             CELER_ASSERT_UNREACHABLE();
     }
@@ -59,7 +59,7 @@ class VolumeView
     // Get all surface IDs for the volume
     CELER_FORCEINLINE_FUNCTION LdgSpan<LocalSurfaceId const> faces() const;
 
-    // Get logic definition
+    // Get infix logic definition, empty if the volume is unreachable
     CELER_FORCEINLINE_FUNCTION LdgSpan<logic_int const> logic() const;
 
     // Get the number of total intersections
@@ -162,6 +162,10 @@ CELER_FUNCTION LdgSpan<LocalSurfaceId const> VolumeView::faces() const
 //---------------------------------------------------------------------------//
 /*!
  * Get logic definition.
+ *
+ * The input postfix logic is precompiled to infix, simplified, and reordered
+ * so that cheaper surfaces are tested first. It is empty if the volume can
+ * never be entered by a logical test (e.g., a background volume).
  */
 CELER_FUNCTION LdgSpan<logic_int const> VolumeView::logic() const
 {
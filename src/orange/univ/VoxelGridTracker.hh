@@ -0,0 +1,423 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/univ/VoxelGridTracker.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/HyperslabIndexer.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/math/NumericLimits.hh"
+#include "orange/OrangeData.hh"
+
+#include "detail/RaggedRightIndexer.hh"
+#include "detail/Types.hh"
+#include "detail/Utils.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Track a particle within a regular grid of single-volume voxels.
+ *
+ * Each local volume of this universe is the union of all voxels assigned to
+ * it (typically, all voxels of a single material), so a track only reaches a
+ * "surface" when it enters a voxel of a different volume. The distance to the
+ * next surface is found with a 3D digital differential analyzer (DDA) that
+ * walks voxel by voxel along the ray, skipping over runs of voxels in the
+ * current volume without returning to the navigator.
+ *
+ * The internal planes are numbered like the surfaces of a \c
+ * RectArrayTracker. The outer planes of the grid are never reported as
+ * intersections since they must coincide with the boundary of the parent
+ * volume, and points outside the grid are assigned to the nearest voxel.
+ */
+class VoxelGridTracker
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using ParamsRef = NativeCRef<OrangeParamsData>;
+    using Initialization = detail::Initialization;
+    using Intersection = detail::Intersection;
+    using LocalState = detail::LocalState;
+    using VolumeIndexer = HyperslabIndexer<3>;
+    using SurfaceIndexer = detail::RaggedRightIndexer<3>;
+    using SurfaceInverseIndexer = detail::RaggedRightInverseIndexer<3>;
+    using Coords = Array<size_type, 3>;
+    //!@}
+
+  public:
+    // Construct with parameters (unit definitions and this one's ID)
+    inline CELER_FUNCTION
+    VoxelGridTracker(ParamsRef const& params, VoxelGridId vid);
+
+    //// ACCESSORS ////
+
+    //! Number of local volumes
+    CELER_FUNCTION LocalVolumeId::size_type num_volumes() const
+    {
+        return record_.num_volumes;
+    }
+
+    //! Number of local surfaces
+    CELER_FUNCTION LocalSurfaceId::size_type num_surfaces() const
+    {
+        size_type num_surfs = 0;
+        for (auto ax : range(Axis::size_))
+        {
+            num_surfs += record_.dims[to_int(ax)] + 1;
+        }
+        return num_surfs;
+    }
+
+    //! Voxel grids never have embedded universes
+    CELER_FUNCTION DaughterId daughter(LocalVolumeId) const { return {}; }
+
+    ////// OPERATIONS ////
+
+    // Find the local volume from a position
+    inline CELER_FUNCTION Initialization
+    initialize(LocalState const& state) const;
+
+    // Calculate distance-to-intercept for the next surface
+    inline CELER_FUNCTION Intersection intersect(LocalState const& state) const;
+
+    // Calculate distance-to-intercept for the next surface, with max distance
+    inline CELER_FUNCTION Intersection intersect(LocalState const& state,
+                                                 real_type max_dist) const;
+
+    // Find the local volume given a post-crossing state
+    inline CELER_FUNCTION Initialization
+    cross_boundary(LocalState const& state) const;
+
+    // Calculate closest distance to a surface in any direction
+    inline CELER_FUNCTION real_type safety(Real3 const& pos,
+                                           LocalVolumeId vol) const;
+
+    // Calculate the local surface normal
+    inline CELER_FUNCTION Real3 normal(Real3 const& pos,
+                                       LocalSurfaceId surf) const;
+
+  private:
+    //// DATA ////
+    ParamsRef const& params_;
+    VoxelGridRecord const& record_;
+
+    //// METHODS ////
+
+    // Calculate distance-to-intercept for the next surface.
+    template<class F>
+    inline CELER_FUNCTION Intersection intersect_impl(LocalState const&,
+                                                      F) const;
+
+    // Find the voxel containing a point, resolving ties along the direction
+    inline CELER_FUNCTION Coords find_coords(LocalState const& state) const;
+
+    // Find the voxel index along a single axis
+    inline CELER_FUNCTION size_type find_coord(Axis ax,
+                                               real_type pos,
+                                               real_type dir) const;
+
+    // Get the local volume of a voxel
+    inline CELER_FUNCTION LocalVolumeId volume(Coords const& coords) const;
+
+    // Get the position of a grid plane
+    inline CELER_FUNCTION real_type plane(size_type ax, size_type idx) const;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with reference to persistent parameter data.
+ */
+CELER_FUNCTION
+VoxelGridTracker::VoxelGridTracker(ParamsRef const& params, VoxelGridId vid)
+    : params_(params), record_(params.voxel_grids[vid])
+{
+    CELER_EXPECT(params_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the local volume from a position.
+ *
+ * Points exactly on an internal plane are assigned to the voxel the track is
+ * heading into.
+ */
+CELER_FUNCTION auto
+VoxelGridTracker::initialize(LocalState const& state) const -> Initialization
+{
+    CELER_EXPECT(params_);
+    CELER_EXPECT(!state.surface && !state.volume);
+
+    return {this->volume(this->find_coords(state)), {}};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the local volume given a post-crossing state.
+ */
+CELER_FUNCTION auto
+VoxelGridTracker::cross_boundary(LocalState const& state) const
+    -> Initialization
+{
+    CELER_EXPECT(state.surface && state.volume);
+
+    return {this->volume(this->find_coords(state)), state.surface};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate distance-to-intercept for the next surface.
+ */
+CELER_FUNCTION auto
+VoxelGridTracker::intersect(LocalState const& state) const -> Intersection
+{
+    Intersection result = this->intersect_impl(state, detail::IsFinite{});
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate distance-to-intercept for the next surface, with max distance.
+ */
+CELER_FUNCTION auto
+VoxelGridTracker::intersect(LocalState const& state,
+                            real_type max_dist) const -> Intersection
+{
+    CELER_EXPECT(max_dist > 0);
+    Intersection result
+        = this->intersect_impl(state, detail::IsNotFurtherThan{max_dist});
+    if (!result)
+    {
+        result.distance = max_dist;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate nearest distance to a surface in any direction.
+ *
+ * This is the distance to the nearest internal face of the voxel containing
+ * the point, which underestimates the distance to the next volume.
+ */
+CELER_FUNCTION real_type VoxelGridTracker::safety(Real3 const& pos,
+                                                  LocalVolumeId volid) const
+{
+    CELER_EXPECT(volid && volid.get() < this->num_volumes());
+
+    real_type min_dist = numeric_limits<real_type>::infinity();
+    for (auto ax : range(Axis::size_))
+    {
+        auto i = to_int(ax);
+        size_type coord = this->find_coord(ax, pos[i], 0);
+        if (coord > 0)
+        {
+            min_dist = min(min_dist, pos[i] - this->plane(i, coord));
+        }
+        if (coord + 1 < record_.dims[i])
+        {
+            min_dist = min(min_dist, this->plane(i, coord + 1) - pos[i]);
+        }
+    }
+
+    return clamp_to_nonneg(min_dist);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the local surface normal.
+ */
+CELER_FUNCTION auto
+VoxelGridTracker::normal(Real3 const&, LocalSurfaceId surf) const -> Real3
+{
+    CELER_EXPECT(surf && surf.get() < this->num_surfaces());
+    SurfaceInverseIndexer to_axis(record_.surface_indexer_data);
+
+    Real3 normal{0, 0, 0};
+    normal[to_axis(surf.unchecked_get())[0]] = 1;
+
+    return normal;
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate distance-to-intercept for the next surface.
+ *
+ * Starting from the current voxel, step into the neighboring voxel whose
+ * shared face is closest along the ray until a voxel belonging to a
+ * different volume is found, the ray leaves the grid, or the distance is no
+ * longer valid.
+ */
+template<class F>
+CELER_FUNCTION auto
+VoxelGridTracker::intersect_impl(LocalState const& state,
+                                 F is_valid) const -> Intersection
+{
+    CELER_EXPECT(state.volume && state.volume.get() < this->num_volumes());
+
+    auto const voxels = params_.voxels[record_.voxels];
+    Coords coords = this->find_coords(state);
+    size_type index = VolumeIndexer{record_.dims}(coords);
+    Coords const strides{record_.dims[1] * record_.dims[2], record_.dims[2], 1};
+
+    // Distance along the ray to the next plane along each axis
+    Real3 next_dist;
+    for (auto ax : range(3))
+    {
+        auto dir = state.dir[ax];
+        if (dir == 0)
+        {
+            next_dist[ax] = numeric_limits<real_type>::infinity();
+            continue;
+        }
+        auto target = this->plane(ax, coords[ax] + static_cast<int>(dir > 0));
+        next_dist[ax] = clamp_to_nonneg((target - state.pos[ax]) / dir);
+    }
+
+    while (true)
+    {
+        // Find the closest plane
+        size_type ax = 0;
+        if (next_dist[1] < next_dist[ax])
+        {
+            ax = 1;
+        }
+        if (next_dist[2] < next_dist[ax])
+        {
+            ax = 2;
+        }
+
+        real_type dist = next_dist[ax];
+        if (!is_valid(dist))
+        {
+            // Past the maximum search distance
+            return {};
+        }
+
+        bool const positive = state.dir[ax] > 0;
+        size_type const target_coord = coords[ax] + static_cast<int>(positive);
+        if (target_coord == 0 || target_coord == record_.dims[ax])
+        {
+            // Leaving the grid: the parent volume boundary is next
+            return {};
+        }
+
+        // Step into the adjacent voxel
+        if (positive)
+        {
+            ++coords[ax];
+            index += strides[ax];
+        }
+        else
+        {
+            --coords[ax];
+            index -= strides[ax];
+        }
+
+        if (voxels[index] != state.volume.unchecked_get())
+        {
+            // Entering a different volume
+            Intersection result;
+            result.distance = dist;
+            SurfaceIndexer to_index(record_.surface_indexer_data);
+            result.surface = detail::OnLocalSurface(
+                LocalSurfaceId(to_index({ax, target_coord})),
+                positive ? Sense::inside : Sense::outside);
+            return result;
+        }
+
+        // Same volume: continue to the next plane along this axis
+        auto target = this->plane(ax, coords[ax] + static_cast<int>(positive));
+        next_dist[ax] = (target - state.pos[ax]) / state.dir[ax];
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the voxel containing a point, resolving ties along the direction.
+ *
+ * If the track is on a surface, the voxel along that axis is given by the
+ * plane index and the post-crossing sense rather than the floating point
+ * position.
+ */
+CELER_FUNCTION auto
+VoxelGridTracker::find_coords(LocalState const& state) const -> Coords
+{
+    Coords result;
+    for (auto ax : range(Axis::size_))
+    {
+        result[to_int(ax)] = this->find_coord(
+            ax, state.pos[to_int(ax)], state.dir[to_int(ax)]);
+    }
+
+    if (state.surface)
+    {
+        SurfaceInverseIndexer to_coords(record_.surface_indexer_data);
+        auto surf_coords = to_coords(state.surface.id().unchecked_get());
+        size_type ax = surf_coords[0];
+        size_type plane = surf_coords[1];
+        CELER_ASSERT(plane > 0 && plane < record_.dims[ax]);
+
+        // NOTE: the surface sense is the POST crossing value
+        result[ax] = plane - (state.surface.sense() == Sense::inside ? 1 : 0);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the voxel index along a single axis.
+ *
+ * Points outside the grid are assigned to the nearest voxel, and points
+ * exactly on a plane are assigned to the voxel in the direction of travel.
+ */
+CELER_FUNCTION size_type VoxelGridTracker::find_coord(Axis ax,
+                                                      real_type pos,
+                                                      real_type dir) const
+{
+    auto i = to_int(ax);
+    real_type u = (pos - record_.origin[i]) / record_.width[i];
+    real_type coord = std::floor(u);
+    if (dir < 0 && coord == u)
+    {
+        coord -= 1;
+    }
+    real_type const max_coord = record_.dims[i] - 1;
+    return static_cast<size_type>(clamp(coord, real_type{0}, max_coord));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the local volume of a voxel.
+ */
+CELER_FUNCTION LocalVolumeId
+VoxelGridTracker::volume(Coords const& coords) const
+{
+    auto index = VolumeIndexer{record_.dims}(coords);
+    return LocalVolumeId{params_.voxels[record_.voxels][index]};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the position of a grid plane.
+ */
+CELER_FUNCTION real_type VoxelGridTracker::plane(size_type ax,
+                                                 size_type idx) const
+{
+    return record_.origin[ax] + idx * record_.width[ax];
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,94 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/univ/detail/LazySenseCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "orange/surf/LocalSurfaceVisitor.hh"
+
+#include "SurfaceFunctors.hh"
+#include "../VolumeView.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the sense of a single face on demand.
+ *
+ * This is used with the \c InfixEvaluator so that only the senses needed to
+ * determine whether a point is inside a volume are calculated. Like the
+ * \c SenseCalculator, it remembers the first evaluated face that the
+ * point is exactly on, and uses the known sense of a face that the point
+ * is logically on.
+ */
+class LazySenseCalculator
+{
+  public:
+    // Construct from persistent data, the volume, and the current position
+    inline CELER_FUNCTION LazySenseCalculator(LocalSurfaceVisitor const& visit,
+                                              VolumeView const& vol,
+                                              Real3 const& pos,
+                                              OnFace face = {});
+
+    // Calculate the sense of a face, as used by the infix evaluator
+    inline CELER_FUNCTION bool operator()(FaceId face_id);
+
+    //! The first face encountered that we are "on"
+    CELER_FUNCTION OnFace face() const { return face_; }
+
+  private:
+    LocalSurfaceVisitor visit_;
+    VolumeView const& vol_;
+    Real3 const& pos_;
+    OnFace face_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from persistent data, the volume, and the current position.
+ */
+CELER_FUNCTION
+LazySenseCalculator::LazySenseCalculator(LocalSurfaceVisitor const& visit,
+                                         VolumeView const& vol,
+                                         Real3 const& pos,
+                                         OnFace face)
+    : visit_{visit}, vol_{vol}, pos_{pos}, face_{face}
+{
+    CELER_EXPECT(!face_ || face_.id() < vol_.num_faces());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the sense of a face.
+ */
+CELER_FUNCTION bool LazySenseCalculator::operator()(FaceId face_id)
+{
+    CELER_EXPECT(face_id < vol_.num_faces());
+
+    if (face_ && face_id == face_.id())
+    {
+        // Sense is known a priori
+        return static_cast<bool>(face_.sense());
+    }
+
+    SignedSense ss = visit_(CalcSense{pos_}, vol_.get_surface(face_id));
+    Sense result = to_sense(ss);
+    if (!face_ && ss == SignedSense::on)
+    {
+        // This is the first face that we're exactly on: save it
+        face_ = {face_id, result};
+    }
+    return static_cast<bool>(result);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
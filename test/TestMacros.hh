@@ -84,6 +84,13 @@
 #    define TEST_IF_CELERITAS_DOUBLE(name) DISABLED_##name
 #endif
 
+//! Construct a test name that is disabled unless physics tables are double
+#if CELERITAS_TABLE_REAL_TYPE == CELERITAS_TABLE_REAL_TYPE_DOUBLE
+#    define TEST_IF_CELERITAS_DOUBLE_TABLES(name) name
+#else
+#    define TEST_IF_CELERITAS_DOUBLE_TABLES(name) DISABLED_##name
+#endif
+
 //! Construct a test name that is disabled when Geant4 is disabled
 #if CELERITAS_USE_GEANT4
 #    define TEST_IF_CELERITAS_GEANT(name) name
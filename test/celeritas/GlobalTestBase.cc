@@ -136,6 +136,7 @@ auto GlobalTestBase::build_core() -> SPConstCore
     // Build along-step action to add to the stepping loop
     auto&& along_step = this->along_step();
     CELER_ASSERT(along_step);
+    inp.along_step_neutral = this->build_along_step_neutral();
 
     if (insert_status_checker_)
     {
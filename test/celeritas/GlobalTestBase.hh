@@ -168,6 +168,9 @@ class GlobalTestBase : public Test
     [[nodiscard]] virtual SPConstOpticalMaterial build_optical_material() = 0;
     [[nodiscard]] virtual SPConstScintillation build_scintillation() = 0;
 
+    //! Optional registered action that replaces the neutral along-step
+    virtual SPConstAction build_along_step_neutral() { return nullptr; }
+
     // Do not insert StatusChecker
     void disable_status_checker();
 
@@ -5,11 +5,18 @@
 //---------------------------------------------------------------------------//
 //! \file celeritas/em/MollerBhabha.test.cc
 //---------------------------------------------------------------------------//
+#include <algorithm>
+#include <memory>
+
 #include "corecel/Types.hh"
 #include "corecel/cont/Range.hh"
 #include "corecel/math/ArrayUtils.hh"
 #include "celeritas/Quantities.hh"
+#include "celeritas/em/distribution/BhabhaEnergyDistribution.hh"
+#include "celeritas/em/distribution/EnergyFractionTableDistribution.hh"
+#include "celeritas/em/distribution/MollerEnergyDistribution.hh"
 #include "celeritas/em/interactor/MollerBhabhaInteractor.hh"
+#include "celeritas/em/model/MollerBhabhaModel.hh"
 #include "celeritas/mat/MaterialTrackView.hh"
 #include "celeritas/phys/CutoffView.hh"
 #include "celeritas/phys/InteractionIO.hh"
@@ -54,10 +61,9 @@ class MollerBhabhaInteractorTest : public InteractorHostTestBase
         this->set_cutoff_params(cutoff_inp);
 
         // Set MollerBhabhaData
-        auto const& params = *this->particle_params();
-        data_.ids.electron = params.find(pdg::electron());
-        data_.ids.positron = params.find(pdg::positron());
-        data_.electron_mass = params.get(data_.ids.electron).mass();
+        model_ = std::make_shared<MollerBhabhaModel>(ActionId{0},
+                                                     *this->particle_params());
+        data_ = model_->host_ref();
     }
 
     void sanity_check(Interaction const& interaction) const
@@ -84,7 +90,8 @@ class MollerBhabhaInteractorTest : public InteractorHostTestBase
     }
 
   protected:
-    MollerBhabhaData data_;
+    std::shared_ptr<MollerBhabhaModel> model_;
+    HostCRef<MollerBhabhaData> data_;
 };
 
 struct SampleInit
@@ -388,6 +395,112 @@ TEST_F(MollerBhabhaInteractorTest, stress_test)
 
     EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
 }
+//---------------------------------------------------------------------------//
+TEST_F(MollerBhabhaInteractorTest, tabulated)
+{
+    int const num_samples = 50000;
+
+    MollerBhabhaModel::Options opts;
+    opts.tabulated = true;
+    MollerBhabhaModel model(ActionId{0}, *this->particle_params(), opts);
+    auto const& table = model.host_ref().table;
+    ASSERT_TRUE(table);
+
+    RandomEngine& rng = this->rng();
+    CutoffView cutoff_view(this->cutoff_params()->host_ref(), MaterialId{0});
+    MevEnergy const cutoff = cutoff_view.energy(data_.ids.electron);
+
+    // Maximum distance between the empirical CDFs of two samples
+    auto calc_ks_distance = [](std::vector<double> a, std::vector<double> b) {
+        std::sort(a.begin(), a.end());
+        std::sort(b.begin(), b.end());
+        double result = 0;
+        for (std::size_t i = 0, j = 0; i < a.size() && j < b.size();)
+        {
+            if (a[i] <= b[j])
+            {
+                ++i;
+            }
+            else
+            {
+                ++j;
+            }
+            result = std::max(result,
+                              std::fabs(double(i) / a.size()
+                                        - double(j) / b.size()));
+        }
+        return result;
+    };
+
+    std::vector<double> ks_distance;
+    std::vector<double> avg_engine_samples;
+    for (auto particle : {pdg::electron(), pdg::positron()})
+    {
+        bool const is_moller = (particle == pdg::electron());
+        TwodGridData const& grid = is_moller ? table.moller : table.bhabha;
+        for (real_type inc_e : {2.0001e-3, 1e-2, 1.0, 1e2, 1e5})
+        {
+            MevEnergy const inc_energy{inc_e};
+            ASSERT_TRUE(EnergyFractionTableDistribution::in_range(
+                grid, table.reals, cutoff, inc_energy));
+
+            // Sample with rejection
+            std::vector<double> expected(num_samples);
+            MollerEnergyDistribution sample_moller(
+                data_.electron_mass, cutoff, inc_energy);
+            BhabhaEnergyDistribution sample_bhabha(
+                data_.electron_mass, cutoff, inc_energy);
+            for (auto& eps : expected)
+            {
+                eps = is_moller ? sample_moller(rng) : sample_bhabha(rng);
+            }
+            rng.reset_count();
+
+            // Sample from the table
+            std::vector<double> actual(num_samples);
+            EnergyFractionTableDistribution sample_table(
+                grid, table.reals, cutoff, inc_energy);
+            for (auto& eps : actual)
+            {
+                eps = sample_table(rng);
+                EXPECT_GE(eps * inc_e, cutoff.value() * (1 - 1e-12));
+                EXPECT_LE(eps, is_moller ? 0.5 : 1);
+            }
+            avg_engine_samples.push_back(double(rng.exchange_count())
+                                         / num_samples);
+            ks_distance.push_back(calc_ks_distance(expected, actual));
+        }
+    }
+
+    // Two-sample Kolmogorov-Smirnov distance is below the 99% critical value
+    // of 1.63 * sqrt(2 / n)
+    for (double d : ks_distance)
+    {
+        EXPECT_LT(d, 0.0103);
+    }
+    // Each sample uses a single canonical random number
+    static double const expected_avg_engine_samples[]
+        = {2, 2, 2, 2, 2, 2, 2, 2, 2, 2};
+    EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
+
+    // Check the full interaction with tabulated sampling
+    this->resize_secondaries(2 * 4);
+    for (auto particle : {pdg::electron(), pdg::positron()})
+    {
+        for (real_type inc_e : {5e-3, 1.0, 1e3, 1e5})
+        {
+            this->set_inc_particle(particle, MevEnergy{inc_e});
+            MollerBhabhaInteractor mb_interact(model.host_ref(),
+                                               this->particle_track(),
+                                               cutoff_view,
+                                               this->direction(),
+                                               this->secondary_allocator());
+            Interaction result = mb_interact(rng);
+            this->sanity_check(result);
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
@@ -190,14 +190,26 @@ TEST_F(RootJsonDumperTest, all)
   "region_id" : 0,
   "phys_material_id" : 1,
   "name" : "box0x125555be0",
-  "solid_name" : "box0x125555b70"
+  "solid_name" : "box0x125555b70",
+  "user_limits" : {
+    "_typename" : "celeritas::ImportUserLimits",
+    "max_step" : 0,
+    "max_time" : 0,
+    "min_energy" : 0
+  }
 }, {
   "_typename" : "celeritas::ImportVolume",
   "geo_material_id" : 1,
   "region_id" : 0,
   "phys_material_id" : 0,
   "name" : "World0x125555f10",
-  "solid_name" : "World0x125555ea0"
+  "solid_name" : "World0x125555ea0",
+  "user_limits" : {
+    "_typename" : "celeritas::ImportUserLimits",
+    "max_step" : 0,
+    "max_time" : 0,
+    "min_energy" : 0
+  }
 }],
 "particles" : [{
   "_typename" : "celeritas::ImportParticle",
@@ -0,0 +1,367 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/geo/NavigationBenchmark.test.cc
+//---------------------------------------------------------------------------//
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/ArrayIO.hh"
+#include "corecel/cont/EnumArray.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/sys/Environment.hh"
+#include "geocel/Types.hh"
+#include "geocel/UnitUtils.hh"
+#include "celeritas/AllGeoTypedTestBase.hh"
+#include "celeritas/random/distribution/IsotropicDistribution.hh"
+#include "celeritas/random/distribution/UniformBoxDistribution.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// HELPER CLASSES
+//---------------------------------------------------------------------------//
+//! Timed navigation operation
+enum class NavOp
+{
+    initialize,
+    find_next_step,
+    move_to_boundary,
+    cross_boundary,
+    find_safety,
+    size_
+};
+
+char const* to_cstring(NavOp op)
+{
+    static char const* const strings[] = {
+        "initialize",
+        "find_next_step",
+        "move_to_boundary",
+        "cross_boundary",
+        "find_safety",
+    };
+    CELER_EXPECT(op < NavOp::size_);
+    return strings[static_cast<int>(op)];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Estimate the cost of bracketing an operation with two clock reads.
+ *
+ * The median over many empty measurements is robust to preemption and is
+ * subtracted from each timed operation, since it is comparable to the cost of
+ * the fastest navigation calls.
+ */
+double calibrate_clock_overhead()
+{
+    using Clock = std::chrono::steady_clock;
+    constexpr std::size_t num_samples = 10001;
+
+    std::vector<double> samples(num_samples);
+    for (double& s : samples)
+    {
+        auto start = Clock::now();
+        std::chrono::duration<double> elapsed = Clock::now() - start;
+        s = elapsed.count();
+    }
+    auto median = samples.begin() + num_samples / 2;
+    std::nth_element(samples.begin(), median, samples.end());
+    return *median;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Latencies of a single navigation operation.
+ */
+struct NavOpTimes
+{
+    std::vector<double> seconds;
+
+    nlohmann::json to_json() const
+    {
+        nlohmann::json result = {{"count", seconds.size()}};
+        if (seconds.empty())
+        {
+            return result;
+        }
+
+        std::vector<double> sorted = seconds;
+        std::sort(sorted.begin(), sorted.end());
+        auto percentile = [&sorted](double frac) {
+            auto idx = static_cast<std::size_t>(frac * (sorted.size() - 1));
+            return sorted[idx] * 1e9;
+        };
+
+        double total = 0;
+        for (double s : sorted)
+        {
+            total += s;
+        }
+
+        result["total_sec"] = total;
+        result["ops_per_sec"] = total > 0 ? sorted.size() / total : 0.0;
+        result["latency_ns"] = {
+            {"min", sorted.front() * 1e9},
+            {"mean", total * 1e9 / sorted.size()},
+            {"p50", percentile(0.5)},
+            {"p90", percentile(0.9)},
+            {"p99", percentile(0.99)},
+            {"max", sorted.back() * 1e9},
+        };
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+/*!
+ * Time geometry navigation along random rays.
+ *
+ * Each history starts at a point sampled uniformly in the world bounding box
+ * with an isotropic direction and is transported to the exterior, with a
+ * safety calculation halfway along each step. Every call to the track view is
+ * timed individually so that the latency distribution (not just the mean
+ * throughput) can be compared between geometry implementations on identical
+ * workloads. The calibrated overhead of reading the clock is subtracted from
+ * each measurement.
+ *
+ * The number of histories can be increased for production benchmarking with
+ * the \c GEO_BENCHMARK_HISTORIES environment variable, and the JSON results
+ * are written to the directory given by \c GEO_BENCHMARK_OUTPUT if set.
+ */
+template<class HP>
+class NavigationBenchmark : public AllGeoTypedTestBase<HP>
+{
+  protected:
+    using GeoTrackView = typename GenericGeoTestBase<HP>::GeoTrackView;
+    using Clock = std::chrono::steady_clock;
+    using TimesArray = EnumArray<NavOp, NavOpTimes>;
+
+    struct Result
+    {
+        size_type num_histories{0};
+        size_type num_outside{0};
+        size_type num_steps{0};
+        double clock_overhead{0};  //!< Subtracted from each time [s]
+        TimesArray times;
+    };
+
+    void SetUp() override
+    {
+        if (CELERITAS_UNITS != CELERITAS_UNITS_CGS
+            && this->geo_name() == "ORANGE")
+        {
+            GTEST_SKIP() << "ORANGE currently requires CGS [cm]";
+        }
+    }
+
+    static size_type num_histories()
+    {
+        std::string const& str = celeritas::getenv("GEO_BENCHMARK_HISTORIES");
+        return str.empty() ? 256 : std::stoul(str);
+    }
+
+    Result run(size_type num_histories);
+    void write(Result const& result) const;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport random rays through the geometry, timing each operation.
+ */
+template<class HP>
+auto NavigationBenchmark<HP>::run(size_type num_histories) -> Result
+{
+    constexpr int max_steps = 10000;
+
+    auto const& bbox = this->geometry()->bbox();
+    for (auto ax : range(3))
+    {
+        CELER_VALIDATE(std::isfinite(bbox.lower()[ax])
+                           && std::isfinite(bbox.upper()[ax]),
+                       << "geometry '" << this->geometry_basename()
+                       << "' has an unbounded world volume");
+    }
+
+    std::mt19937 rng;
+    UniformBoxDistribution<real_type> sample_pos(bbox.lower(), bbox.upper());
+    IsotropicDistribution<real_type> sample_dir;
+    GeoTrackView geo = this->make_geo_track_view();
+
+    Result result;
+    result.clock_overhead = calibrate_clock_overhead();
+    auto timed = [&result](NavOp op, auto&& func) {
+        auto start = Clock::now();
+        auto record = [&] {
+            std::chrono::duration<double> elapsed = Clock::now() - start;
+            result.times[op].seconds.push_back(
+                std::max(elapsed.count() - result.clock_overhead, 0.0));
+        };
+        if constexpr (std::is_void_v<decltype(func())>)
+        {
+            func();
+            record();
+        }
+        else
+        {
+            auto retval = func();
+            record();
+            return retval;
+        }
+    };
+
+    for (size_type i = 0; i < num_histories; ++i)
+    {
+        GeoTrackInitializer const init{sample_pos(rng), sample_dir(rng)};
+        timed(NavOp::initialize, [&] { geo = init; });
+        ++result.num_histories;
+        if (geo.is_outside())
+        {
+            // Bounding box is larger than the world volume
+            ++result.num_outside;
+            continue;
+        }
+        timed(NavOp::find_safety, [&geo] { return geo.find_safety(); });
+
+        for (int step = 0; step < max_steps && !geo.is_outside(); ++step)
+        {
+            auto next = timed(NavOp::find_next_step,
+                              [&geo] { return geo.find_next_step(); });
+            if (!next.boundary)
+            {
+                ADD_FAILURE() << "failed to find the next boundary at "
+                              << geo.pos();
+                break;
+            }
+            if (next.distance > real_type(from_cm(1e-7)))
+            {
+                geo.move_internal(next.distance / 2);
+                timed(NavOp::find_next_step,
+                      [&geo] { return geo.find_next_step(); });
+                timed(NavOp::find_safety, [&geo] { return geo.find_safety(); });
+            }
+            timed(NavOp::move_to_boundary, [&geo] { geo.move_to_boundary(); });
+            timed(NavOp::cross_boundary, [&geo] { geo.cross_boundary(); });
+            ++result.num_steps;
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Log a summary and optionally write the full results as JSON.
+ */
+template<class HP>
+void NavigationBenchmark<HP>::write(Result const& result) const
+{
+    nlohmann::json ops = nlohmann::json::object();
+    for (auto op : range(NavOp::size_))
+    {
+        ops[to_cstring(op)] = result.times[op].to_json();
+    }
+
+    nlohmann::json j = {
+        {"geometry", this->geo_name()},
+        {"model", this->geometry_basename()},
+        {"num_histories", result.num_histories},
+        {"num_outside", result.num_outside},
+        {"num_steps", result.num_steps},
+        {"clock_overhead_ns", result.clock_overhead * 1e9},
+        {"ops", std::move(ops)},
+    };
+
+    CELER_LOG(info) << "Subtracted clock overhead of "
+                    << result.clock_overhead * 1e9 << " ns per operation";
+    for (auto op : range(NavOp::size_))
+    {
+        auto const& op_json = j["ops"][to_cstring(op)];
+        if (op_json.contains("ops_per_sec"))
+        {
+            CELER_LOG(info)
+                << this->geo_name() << " " << this->geometry_basename() << " "
+                << to_cstring(op) << ": "
+                << op_json["ops_per_sec"].get<double>() << " ops/s, median "
+                << op_json["latency_ns"]["p50"].get<double>() << " ns";
+        }
+    }
+
+    std::string const& outdir = celeritas::getenv("GEO_BENCHMARK_OUTPUT");
+    if (!outdir.empty())
+    {
+        std::string filename = outdir + "/nav-" + this->geometry_basename()
+                               + "-" + this->geo_name() + ".json";
+        std::ofstream outf(filename);
+        CELER_VALIDATE(outf,
+                       << "failed to open benchmark output file '"
+                       << filename << "'");
+        outf << j.dump(1) << std::endl;
+        CELER_LOG(info) << "Wrote navigation benchmark to " << filename;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// MODELS
+//---------------------------------------------------------------------------//
+
+#define DEFINE_NAV_BENCHMARK(CLASSNAME, BASENAME)                        \
+    template<class HP>                                                   \
+    class CLASSNAME : public NavigationBenchmark<HP>                     \
+    {                                                                    \
+        std::string geometry_basename() const final { return BASENAME; } \
+    };                                                                   \
+    TYPED_TEST_SUITE(CLASSNAME, AllGeoTestingTypes, AllGeoTestingTypeNames);
+
+DEFINE_NAV_BENCHMARK(SimpleCmsNavigationBenchmark, "simple-cms")
+DEFINE_NAV_BENCHMARK(TestEm3NavigationBenchmark, "testem3-flat")
+DEFINE_NAV_BENCHMARK(ThreeSpheresNavigationBenchmark, "three-spheres")
+
+#undef DEFINE_NAV_BENCHMARK
+
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(SimpleCmsNavigationBenchmark, random_rays)
+{
+    auto result = this->run(this->num_histories());
+    EXPECT_GT(result.num_steps, 0);
+    EXPECT_EQ(result.num_histories,
+              result.times[NavOp::initialize].seconds.size());
+    EXPECT_EQ(result.num_steps,
+              result.times[NavOp::cross_boundary].seconds.size());
+    this->write(result);
+}
+
+TYPED_TEST(TestEm3NavigationBenchmark, random_rays)
+{
+    auto result = this->run(this->num_histories());
+    EXPECT_GT(result.num_steps, 0);
+    this->write(result);
+}
+
+TYPED_TEST(ThreeSpheresNavigationBenchmark, random_rays)
+{
+    auto result = this->run(this->num_histories());
+    EXPECT_GT(result.num_steps, 0);
+    this->write(result);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -6,6 +6,8 @@
 //! \file celeritas/alongstep.test.cc
 //---------------------------------------------------------------------------//
 #include <fstream>
+#include <string>
+#include <vector>
 
 #include "corecel/Config.hh"
 
@@ -18,10 +20,12 @@
 #include "celeritas/TestEm3Base.hh"
 #include "celeritas/alongstep/AlongStepRZMapFieldMscAction.hh"
 #include "celeritas/alongstep/AlongStepUniformMscAction.hh"
+#include "celeritas/alongstep/AlongStepWoodcockAction.hh"
 #include "celeritas/em/params/UrbanMscParams.hh"
 #include "celeritas/ext/GeantPhysicsOptions.hh"
 #include "celeritas/field/RZMapFieldInput.hh"
 #include "celeritas/field/UniformFieldData.hh"
+#include "celeritas/geo/GeoParams.hh"
 #include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"
 
@@ -42,6 +46,37 @@ class KnAlongStepTest : public SimpleTestBase, public AlongStepTestBase
 {
 };
 
+class KnWoodcockAlongStepTest : public KnAlongStepTest
+{
+  public:
+    SPConstAction build_along_step() override
+    {
+        // Region encloses the Al "inner" box and some of the vacuum "world"
+        auto const& volumes = this->geometry()->volumes();
+        AlongStepWoodcockAction::Region region;
+        region.bbox = BBox{{-10, -10, -10}, {10, 10, 10}};
+        for (auto const& name : region_volumes)
+        {
+            region.volumes.push_back(volumes.find_unique(name));
+        }
+        AlongStepWoodcockAction::Input inp;
+        inp.regions.push_back(std::move(region));
+
+        auto& action_reg = *this->action_reg();
+        auto result = std::make_shared<AlongStepWoodcockAction>(
+            action_reg.next_id(), *this->geomaterial(), inp);
+        action_reg.insert(result);
+        return result;
+    }
+
+    SPConstAction build_along_step_neutral() override
+    {
+        return this->along_step();
+    }
+
+    std::vector<std::string> region_volumes{"inner", "world"};
+};
+
 class MockAlongStepTest : public MockTestBase, public AlongStepTestBase
 {
 };
@@ -206,7 +241,86 @@ TEST_F(KnAlongStepTest, basic)
     }
 }
 
-TEST_F(MockAlongStepTest, basic)
+TEST_F(KnWoodcockAlongStepTest, basic)
+{
+    size_type num_tracks = 10;
+    Input inp;
+    inp.particle_id = this->particle()->find(pdg::gamma());
+    {
+        // Collision inside the Al box is the same as with analog tracking
+        inp.energy = MevEnergy{1};
+        auto result = this->run(inp, num_tracks);
+        EXPECT_SOFT_EQ(0, result.eloss);
+        EXPECT_SOFT_EQ(1, result.displacement);
+        EXPECT_SOFT_EQ(1, result.angle);
+        EXPECT_SOFT_EQ(3.3356409519815202e-11, result.time);
+        EXPECT_SOFT_EQ(1, result.step);
+        EXPECT_EQ("physics-discrete-select", result.action);
+    }
+    {
+        // Virtual collisions in vacuum and exit the region, continuing to the
+        // world boundary rather than stopping at the Al box
+        inp.energy = MevEnergy{10};
+        auto result = this->run(inp, num_tracks);
+        EXPECT_SOFT_EQ(0, result.eloss);
+        EXPECT_SOFT_EQ(500, result.displacement);
+        EXPECT_SOFT_EQ(1, result.angle);
+        EXPECT_SOFT_EQ(1.6678204759908e-08, result.time);
+        EXPECT_SOFT_EQ(500, result.step);
+        EXPECT_EQ("geo-boundary", result.action);
+    }
+    {
+        // Start in vacuum and collide in Al without stopping at the boundary
+        inp.energy = MevEnergy{1};
+        inp.position = {0, 0, -8};
+        inp.phys_mfp = 4;
+        auto result = this->run(inp, num_tracks);
+        EXPECT_SOFT_EQ(4, result.displacement);
+        EXPECT_SOFT_EQ(4, result.step);
+        EXPECT_EQ("physics-discrete-select", result.action);
+    }
+    {
+        // Outside the region: ordinary tracking stops at the boundary
+        inp.position = {0, 0, -20};
+        auto result = this->run(inp, num_tracks);
+        EXPECT_SOFT_EQ(15, result.displacement);
+        EXPECT_SOFT_EQ(15, result.step);
+        EXPECT_EQ("geo-boundary", result.action);
+    }
+}
+
+TEST_F(KnWoodcockAlongStepTest, all_materials)
+{
+    // Without volumes, the majorant is over all materials in the problem
+    region_volumes.clear();
+
+    Input inp;
+    inp.particle_id = this->particle()->find(pdg::gamma());
+    inp.energy = MevEnergy{1};
+    auto result = this->run(inp, 10);
+    EXPECT_SOFT_EQ(1, result.step);
+    EXPECT_EQ("physics-discrete-select", result.action);
+}
+
+TEST_F(KnWoodcockAlongStepTest, missing_material)
+{
+    // Majorant excludes the Al box that the tracks start in
+    region_volumes = {"world"};
+
+    Input inp;
+    inp.particle_id = this->particle()->find(pdg::gamma());
+    inp.energy = MevEnergy{1};
+    ScopedLogStorer scoped_log{&celeritas::self_logger(), LogLevel::error};
+    auto result = this->run(inp, 10);
+    EXPECT_EQ("tracking-cut", result.action);
+    ASSERT_FALSE(scoped_log.empty());
+    EXPECT_EQ(
+        "Track started in material 0 that is missing from its Woodcock "
+        "tracking region",
+        scoped_log.messages().front());
+}
+
+TEST_F(MockAlongStepTest, TEST_IF_CELERITAS_DOUBLE_TABLES(basic))
 {
     size_type num_tracks = 10;
     Input inp;
@@ -252,7 +366,7 @@ TEST_F(MockAlongStepTest, basic)
     }
 }
 
-TEST_F(MockAlongStepFieldTest, TEST_IF_CELERITAS_DOUBLE(basic))
+TEST_F(MockAlongStepFieldTest, TEST_IF_CELERITAS_DOUBLE_TABLES(basic))
 {
     size_type num_tracks = 10;
     Input inp;
@@ -16,10 +16,14 @@
 #include "corecel/cont/Span.hh"
 #include "corecel/data/AuxParamsRegistry.hh"
 #include "corecel/io/LogContextException.hh"
+#include "corecel/io/OutputInterface.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/sys/ActionRegistry.hh"
 #include "geocel/UnitUtils.hh"
+#include "celeritas/alongstep/AlongStepGeneralLinearAction.hh"
 #include "celeritas/alongstep/AlongStepUniformMscAction.hh"
+#include "celeritas/global/ActionSequence.hh"
+#include "celeritas/global/ActionSequenceOutput.hh"
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/global/CoreState.hh"
 #include "celeritas/phys/ParticleParams.hh"
@@ -27,6 +31,7 @@
 #include "celeritas/random/RngEngine.hh"
 #include "celeritas/track/SimParams.hh"
 #include "celeritas/track/SimTrackView.hh"
+#include "celeritas/track/TrackInitParams.hh"
 
 #include "DummyAction.hh"
 #include "StepperTestBase.hh"
@@ -80,6 +85,31 @@ class SimpleComptonTest : public SimpleTestBase, public StepperTestBase
     size_type max_steps_{0};
 };
 
+class SimpleComptonSortedTest : public SimpleComptonTest
+{
+  public:
+    SPConstTrackInit build_init() override
+    {
+        TrackInitParams::Input input;
+        input.capacity = 4096;
+        input.max_events = 4096;
+        input.track_order = TrackOrder::reindex_particle_type;
+        return std::make_shared<TrackInitParams>(input);
+    }
+
+    SPConstAction build_along_step() override
+    {
+        auto result = AlongStepGeneralLinearAction::from_params(
+            this->action_reg()->next_id(),
+            *this->material(),
+            *this->particle(),
+            nullptr,
+            false);
+        this->action_reg()->insert(result);
+        return result;
+    }
+};
+
 class StepperOrderTest : public SimpleComptonTest
 {
   public:
@@ -239,6 +269,140 @@ TEST_F(SimpleComptonTest, TEST_IF_CELER_DEVICE(device))
     EXPECT_EQ(3, result.calc_emptying_step());
 }
 
+TEST_F(SimpleComptonSortedTest, host)
+{
+    constexpr auto M = MemSpace::host;
+    size_type num_primaries = 32;
+    size_type num_tracks = 64;
+
+    Stepper<M> step(this->make_stepper_input(num_tracks));
+    auto result = this->run(step, num_primaries);
+
+    // Reindexing tracks shouldn't change the results
+    if (this->is_default_build())
+    {
+        EXPECT_EQ(919, result.num_step_iters());
+        EXPECT_SOFT_EQ(53.8125, result.calc_avg_steps_per_primary());
+        EXPECT_EQ(RunResult::StepCount({1, 6}), result.calc_queue_hwm());
+    }
+    EXPECT_EQ(3, result.calc_emptying_step());
+}
+
+TEST_F(SimpleComptonSortedTest, along_step_ranges)
+{
+    constexpr auto M = MemSpace::host;
+    size_type num_tracks = 16;
+
+    Stepper<M> step(this->make_stepper_input(num_tracks));
+    auto const primaries = this->make_primaries(4);
+    step(make_span(primaries));
+    for ([[maybe_unused]] auto i : range(4))
+    {
+        step();
+    }
+
+    auto const& state = dynamic_cast<CoreState<M> const&>(step.state());
+    auto const& scalars = this->core()->host_ref().scalars;
+    auto neutral = state.get_action_range(scalars.along_step_neutral_action);
+    auto charged = state.get_action_range(scalars.along_step_user_action);
+    EXPECT_EQ(num_tracks, neutral.size() + charged.size());
+
+    // Every active track in the neutral range is a photon
+    auto const& state_ref = state.ref();
+    for (ThreadId tid : neutral)
+    {
+        TrackSlotId slot{state_ref.track_slots[tid]};
+        if (state_ref.sim.status[slot] == TrackStatus::alive)
+        {
+            EXPECT_EQ(scalars.along_step_neutral_action,
+                      state_ref.sim.along_step_action[slot]);
+        }
+    }
+    for (ThreadId tid : charged)
+    {
+        TrackSlotId slot{state_ref.track_slots[tid]};
+        if (state_ref.sim.status[slot] == TrackStatus::alive)
+        {
+            EXPECT_EQ(scalars.along_step_user_action,
+                      state_ref.sim.along_step_action[slot]);
+        }
+    }
+}
+
+TEST_F(SimpleComptonSortedTest, extra_along_step)
+{
+    // Register a third along-step action after the user action
+    EXPECT_TRUE(this->along_step());
+    auto& aux_reg = this->aux_reg();
+    auto dummy_params = std::make_shared<DummyParams>(aux_reg->next_id());
+    aux_reg->insert(dummy_params);
+    auto& action_reg = this->action_reg();
+    action_reg->insert(std::make_shared<DummyAction>(action_reg->next_id(),
+                                                     StepActionOrder::along,
+                                                     "dummy-along",
+                                                     dummy_params->aux_id()));
+
+    EXPECT_THROW(Stepper<MemSpace::host>(this->make_stepper_input(16)),
+                 RuntimeError);
+}
+
+TEST_F(SimpleComptonSortedTest, action_counts)
+{
+    constexpr auto M = MemSpace::host;
+    size_type num_tracks = 16;
+    size_type num_steps = 5;
+
+    auto input = this->make_stepper_input(num_tracks);
+    input.action_times = true;
+    input.action_counts = true;
+    Stepper<M> step(std::move(input));
+    auto const primaries = this->make_primaries(4);
+    step(make_span(primaries));
+    for ([[maybe_unused]] auto i : range(num_steps - 1))
+    {
+        step();
+    }
+
+    auto const& actions = step.actions();
+    ASSERT_TRUE(actions.action_counts());
+    EXPECT_FALSE(actions.perf_counters());
+
+    auto const& scalars = this->core()->host_ref().scalars;
+    auto const& step_actions = actions.actions().step();
+    auto const& tracks = actions.accum_tracks();
+    ASSERT_EQ(step_actions.size(), tracks.size());
+    std::size_t along_tracks{0};
+    std::size_t pre_tracks{0};
+    for (auto i : range(step_actions.size()))
+    {
+        auto aid = step_actions[i]->action_id();
+        if (aid == scalars.along_step_neutral_action
+            || aid == scalars.along_step_user_action)
+        {
+            // Along-step actions count only tracks that selected them
+            along_tracks += tracks[i];
+        }
+        else if (step_actions[i]->order() == StepActionOrder::pre)
+        {
+            // Pre-step actions count all active tracks
+            pre_tracks = tracks[i];
+        }
+    }
+    EXPECT_GT(pre_tracks, 0);
+    EXPECT_LT(pre_tracks, num_steps * num_tracks);
+    EXPECT_EQ(pre_tracks, along_tracks);
+
+    // Write combined output
+    ActionSequenceOutput out;
+    out.accumulate(actions);
+    out.accumulate(actions);
+    auto str = to_string(out);
+    EXPECT_NE(std::string::npos, str.find("\"time_per_track\""))
+        << str;
+    EXPECT_NE(std::string::npos, str.find("\"num_streams\":2")) << str;
+    EXPECT_EQ(std::string::npos, str.find("\"cycles\"")) << str;
+}
+
 TEST_F(SimpleComptonTest, reseed)
 {
     constexpr auto M = MemSpace::host;
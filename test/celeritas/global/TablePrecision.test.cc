@@ -0,0 +1,113 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/TablePrecision.test.cc
+//---------------------------------------------------------------------------//
+#include <vector>
+
+#include "corecel/Config.hh"
+
+#include "corecel/cont/Range.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+#include "celeritas/user/SimpleCalo.hh"
+
+#include "StepperTestBase.hh"
+#include "celeritas_test.hh"
+#include "../SimpleTestBase.hh"
+#include "../user/CaloTestBase.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+/*!
+ * Compare step-level observables against double-precision physics tables.
+ *
+ * Gammas undergo Compton scattering in the inner box of the simple test
+ * problem, so the energy deposited and the number of steps depend on the
+ * tabulated cross sections. The reference values were generated with
+ * double-precision table storage: the same problem built with
+ * \c CELERITAS_TABLE_REAL_TYPE set to \c float must reproduce them to within
+ * the tolerances below.
+ */
+class SimpleTablePrecisionTest : public SimpleTestBase,
+                                 public StepperTestBase,
+                                 public CaloTestBase
+{
+  public:
+    std::vector<Primary> make_primaries(size_type count) const override
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        CELER_ASSERT(p.particle_id);
+        p.energy = units::MevEnergy{10};
+        p.position = {0, 0, 0};
+        p.time = 0;
+
+        std::vector<Primary> result(count, p);
+        for (auto i : range(count))
+        {
+            // Spread the directions over an octant
+            real_type const frac = real_type(i) / count;
+            result[i].direction = make_unit_vector(Real3{1, frac, 1 - frac});
+            result[i].event_id = EventId{i};
+        }
+        return result;
+    }
+
+    size_type max_average_steps() const override { return 1000; }
+
+    VecString get_detector_names() const final { return {"inner"}; }
+
+    void SetUp() override { CaloTestBase::SetUp(); }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(SimpleTablePrecisionTest, observables)
+{
+    if (!this->is_default_build())
+    {
+        GTEST_SKIP() << "Reference values require the default build";
+    }
+
+    size_type const num_primaries = 64;
+    Stepper<MemSpace::host> step(this->make_stepper_input(num_primaries));
+    auto result = StepperTestBase::run(step, num_primaries);
+    ASSERT_TRUE(result);
+
+    auto edep = calo_->calc_total_energy_deposition();
+    double avg_steps = result.calc_avg_steps_per_primary();
+
+    // Results with double-precision tables
+    static double const expected_edep[] = {0.0777595112949319};
+    double const expected_avg_steps = 281.8125;
+
+    // Single-precision storage rounds each table value by about 6e-8: the
+    // accumulated observables must be within a small multiple of that
+    double const edep_tol
+        = CELERITAS_TABLE_REAL_TYPE == CELERITAS_TABLE_REAL_TYPE_DOUBLE
+              ? 1e-12
+              : 1e-5;
+    double const steps_tol
+        = CELERITAS_TABLE_REAL_TYPE == CELERITAS_TABLE_REAL_TYPE_DOUBLE
+              ? 1e-12
+              : 1e-3;
+    EXPECT_VEC_NEAR(expected_edep, edep, edep_tol);
+    EXPECT_SOFT_NEAR(expected_avg_steps, avg_steps, steps_tol);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,104 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/UserActionTestBase.cc
+//---------------------------------------------------------------------------//
+#include "UserActionTestBase.hh"
+
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/io/LogContextException.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Transport copies of a primary and return the last step counts.
+ *
+ * A new stepper is created for each run.
+ */
+StepperResult UserActionTestBase::run(Primary const& primary,
+                                      size_type num_primaries,
+                                      size_type num_steps)
+{
+    CELER_EXPECT(num_primaries > 0 && num_steps > 0);
+
+    StepperInput step_inp;
+    step_inp.params = this->core();
+    step_inp.stream_id = StreamId{0};
+    step_inp.num_track_slots = this->num_track_slots();
+    stepper_ = std::make_unique<Stepper<MemSpace::host>>(step_inp);
+
+    std::vector<Primary> primaries(num_primaries, primary);
+    auto& step = *stepper_;
+
+    LogContextException log_context{this->output_reg().get()};
+    StepperResult result;
+    CELER_TRY_HANDLE(result = step(make_span(primaries)), log_context);
+    while (--num_steps > 0)
+    {
+        CELER_TRY_HANDLE(result = step(), log_context);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access the state after the last run.
+ */
+auto UserActionTestBase::state() const -> StateRef const&
+{
+    CELER_EXPECT(stepper_);
+    return stepper_->state_ref();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Energy deposited over all tracks in the last step [MeV].
+ */
+real_type UserActionTestBase::calc_edep() const
+{
+    auto const& state = this->state();
+    real_type result = 0;
+    for (auto tid : range(TrackSlotId{state.size()}))
+    {
+        result += state.physics.state[tid].energy_deposition;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of alive tracks, optionally of a single particle type.
+ */
+size_type UserActionTestBase::count_alive(ParticleId pid) const
+{
+    return this->find_alive(pid).size();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Slots of alive tracks, optionally of a single particle type.
+ */
+std::vector<TrackSlotId> UserActionTestBase::find_alive(ParticleId pid) const
+{
+    auto const& state = this->state();
+    std::vector<TrackSlotId> result;
+    for (auto tid : range(TrackSlotId{state.size()}))
+    {
+        if (state.sim.status[tid] == TrackStatus::alive
+            && (!pid || state.particles.particle_id[tid] == pid))
+        {
+            result.push_back(tid);
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,81 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/UserActionTestBase.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "celeritas/GlobalTestBase.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Take a few steps on host to test the effect of user actions.
+ *
+ * Tracking cuts, variance reduction, and other user post-step actions are
+ * tested by transporting copies of a single primary for a small number of
+ * steps and examining the track states afterward.
+ *
+ * This class must be virtual so that it can be used as a mixin to other class
+ * definitions.
+ *
+ * Example:
+ * \code
+    class WeightWindowTest : public SimpleTestBase, public UserActionTestBase
+    {
+    };
+
+    TEST_F(WeightWindowTest, roulette)
+    {
+        Primary p = ...;
+        this->run(p, 64);
+        EXPECT_GT(64, this->count_alive(p.particle_id));
+    }
+ * \endcode
+ */
+class UserActionTestBase : virtual public GlobalTestBase
+{
+  public:
+    using StateRef = HostRef<CoreStateData>;
+
+    // Transport copies of a primary and return the last step counts
+    StepperResult run(Primary const& primary,
+                      size_type num_primaries,
+                      size_type num_steps = 1);
+
+    // Access the state after the last run
+    StateRef const& state() const;
+
+    // Energy deposited over all tracks in the last step [MeV]
+    real_type calc_edep() const;
+
+    // Number of alive tracks, optionally of a single particle type
+    size_type count_alive(ParticleId pid = {}) const;
+
+    // Slots of alive tracks, optionally of a single particle type
+    std::vector<TrackSlotId> find_alive(ParticleId pid = {}) const;
+
+  protected:
+    //! Number of track slots in the stepper
+    virtual size_type num_track_slots() const { return 512; }
+
+  private:
+    std::unique_ptr<Stepper<MemSpace::host>> stepper_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -23,7 +23,7 @@ namespace test
 void CalculatorTestBase::build(real_type emin, real_type emax, size_type count)
 {
     this->build({emin, emax}, count, [](real_type energy) { return energy; });
-    CELER_ENSURE(soft_equal(emax, value_ref_[data_.value].back()));
+    CELER_ENSURE(soft_equal(emax, real_type(value_ref_[data_.value].back())));
 }
 
 //---------------------------------------------------------------------------//
@@ -29,10 +29,12 @@ class CalculatorTestBase : public Test
   public:
     //!@{
     //! \name Type aliases
-    using Values = Collection<real_type, Ownership::value, MemSpace::host>;
-    using Data
-        = Collection<real_type, Ownership::const_reference, MemSpace::host>;
-    using SpanReal = Span<real_type>;
+    using Values
+        = Collection<table_real_type, Ownership::value, MemSpace::host>;
+    using Data = Collection<table_real_type,
+                            Ownership::const_reference,
+                            MemSpace::host>;
+    using SpanReal = Span<table_real_type>;
     using XsFunc = std::function<real_type(real_type)>;
     using Real2 = Array<real_type, 2>;
     //!@}
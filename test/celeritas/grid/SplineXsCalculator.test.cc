@@ -70,7 +70,7 @@ TEST_F(SplineXsCalculatorTest, simple)
     }
 }
 
-TEST_F(SplineXsCalculatorTest, scaled_lowest)
+TEST_F(SplineXsCalculatorTest, TEST_IF_CELERITAS_DOUBLE_TABLES(scaled_lowest))
 {
     // Energy from .1 to 1e4 MeV with 5 grid points; XS should be constant
     // since the constructor fills it with E
@@ -119,7 +119,7 @@ TEST_F(SplineXsCalculatorTest, scaled_middle)
     std::fill(xs.begin(), xs.begin() + 3, 1.0);
 
     // Change constant to 3 just to shake things up
-    for (real_type& x : xs)
+    for (auto& x : xs)
     {
         x *= 3;
     }
@@ -183,7 +183,8 @@ TEST_F(SplineXsCalculatorTest, scaled_highest)
     EXPECT_SOFT_EQ(100, value_as<Energy>(calc.energy_max()));
 }
 
-TEST_F(SplineXsCalculatorTest, quadratic_simple)
+TEST_F(SplineXsCalculatorTest,
+       TEST_IF_CELERITAS_DOUBLE_TABLES(quadratic_simple))
 {
     auto reference_xs
         = [](real_type energy) { return real_type{0.1} * ipow<2>(energy); };
@@ -217,7 +218,8 @@ TEST_F(SplineXsCalculatorTest, quadratic_simple)
     }
 }
 
-TEST_F(SplineXsCalculatorTest, quadratic_scaled_lowest)
+TEST_F(SplineXsCalculatorTest,
+       TEST_IF_CELERITAS_DOUBLE_TABLES(quadratic_scaled_lowest))
 {
     auto reference_xs
         = [](real_type energy) { return real_type{0.1} * ipow<2>(energy); };
@@ -246,7 +248,8 @@ TEST_F(SplineXsCalculatorTest, quadratic_scaled_lowest)
     }
 }
 
-TEST_F(SplineXsCalculatorTest, quadratic_scaled_middle)
+TEST_F(SplineXsCalculatorTest,
+       TEST_IF_CELERITAS_DOUBLE_TABLES(quadratic_scaled_middle))
 {
     auto reference_xs
         = [](real_type energy) { return real_type{0.1} * ipow<2>(energy); };
@@ -275,7 +278,8 @@ TEST_F(SplineXsCalculatorTest, quadratic_scaled_middle)
     }
 }
 
-TEST_F(SplineXsCalculatorTest, quadratic_scaled_highest)
+TEST_F(SplineXsCalculatorTest,
+       TEST_IF_CELERITAS_DOUBLE_TABLES(quadratic_scaled_highest))
 {
     auto reference_xs
         = [](real_type energy) { return real_type{0.1} * ipow<2>(energy); };
@@ -304,7 +308,7 @@ TEST_F(SplineXsCalculatorTest, quadratic_scaled_highest)
     }
 }
 
-TEST_F(SplineXsCalculatorTest, cubic_simple)
+TEST_F(SplineXsCalculatorTest, TEST_IF_CELERITAS_DOUBLE_TABLES(cubic_simple))
 {
     auto reference_xs
         = [](real_type energy) { return real_type{0.01} * ipow<3>(energy); };
@@ -335,7 +339,8 @@ TEST_F(SplineXsCalculatorTest, cubic_simple)
     }
 }
 
-TEST_F(SplineXsCalculatorTest, cubic_scaled_lowest)
+TEST_F(SplineXsCalculatorTest,
+       TEST_IF_CELERITAS_DOUBLE_TABLES(cubic_scaled_lowest))
 {
     auto reference_xs
         = [](real_type energy) { return real_type{0.01} * ipow<3>(energy); };
@@ -363,7 +368,8 @@ TEST_F(SplineXsCalculatorTest, cubic_scaled_lowest)
     }
 }
 
-TEST_F(SplineXsCalculatorTest, cubic_scaled_middle)
+TEST_F(SplineXsCalculatorTest,
+       TEST_IF_CELERITAS_DOUBLE_TABLES(cubic_scaled_middle))
 {
     auto reference_xs
         = [](real_type energy) { return real_type{0.01} * ipow<3>(energy); };
@@ -391,7 +397,8 @@ TEST_F(SplineXsCalculatorTest, cubic_scaled_middle)
     }
 }
 
-TEST_F(SplineXsCalculatorTest, cubic_scaled_highest)
+TEST_F(SplineXsCalculatorTest,
+       TEST_IF_CELERITAS_DOUBLE_TABLES(cubic_scaled_highest))
 {
     auto reference_xs
         = [](real_type energy) { return real_type{0.1} * ipow<3>(energy); };
@@ -9,9 +9,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 #include "corecel/cont/Range.hh"
 #include "corecel/data/CollectionBuilder.hh"
+#include "corecel/grid/UniformGrid.hh"
 #include "corecel/io/Repr.hh"
 
 #include "CalculatorTestBase.hh"
@@ -66,7 +68,7 @@ TEST_F(XsCalculatorTest, simple)
     EXPECT_SOFT_EQ(1e5, value_as<Energy>(calc.energy_max()));
 }
 
-TEST_F(XsCalculatorTest, scaled_lowest)
+TEST_F(XsCalculatorTest, TEST_IF_CELERITAS_DOUBLE_TABLES(scaled_lowest))
 {
     // Energy from .1 to 1e4 MeV with 6 grid points and values of 1
     this->build({0.1, 1e4}, 6, [](real_type) { return real_type{1}; });
@@ -131,7 +133,7 @@ TEST_F(XsCalculatorTest, scaled_middle)
     EXPECT_SOFT_EQ(1e4, value_as<Energy>(calc.energy_max()));
 }
 
-TEST_F(XsCalculatorTest, scaled_linear)
+TEST_F(XsCalculatorTest, TEST_IF_CELERITAS_DOUBLE_TABLES(scaled_linear))
 {
     auto reference_xs = [](real_type energy) {
         auto result = 100 + energy * 10;
@@ -180,6 +182,34 @@ TEST_F(XsCalculatorTest, scaled_highest)
     EXPECT_SOFT_EQ(100, value_as<Energy>(calc.energy_max()));
 }
 
+TEST_F(XsCalculatorTest, table_precision)
+{
+    // Smooth cross section spanning many decades: values are stored with the
+    // (possibly reduced) table precision but interpolated in full precision
+    auto calc_xs = [](real_type e) { return 1 / std::sqrt(e) + e / 1000; };
+    this->build({1e-3, 1e8}, 221, calc_xs);
+    this->convert_to_prime(110);
+
+    XsCalculator calc(this->data(), this->values());
+    UniformGrid loge{this->data().log_energy};
+
+    // Values at grid points are exact up to the storage precision
+    real_type const tol
+        = 16 * std::numeric_limits<table_real_type>::epsilon();
+    for (auto i : range(loge.size()))
+    {
+        real_type e = std::exp(loge[i]);
+        EXPECT_SOFT_NEAR(calc_xs(e), calc(Energy{e}), tol) << "at E=" << e;
+    }
+
+    // Midpoints have interpolation error independent of the storage type
+    for (auto i : range(loge.size() - 1))
+    {
+        real_type e = std::exp((loge[i] + loge[i + 1]) / 2);
+        EXPECT_SOFT_NEAR(calc_xs(e), calc(Energy{e}), 0.01) << "at E=" << e;
+    }
+}
+
 TEST_F(XsCalculatorTest, TEST_IF_CELERITAS_DEBUG(scaled_off_the_end))
 {
     // values of 1, 10, 100 --> actual xs = {1, 10, 100}
@@ -0,0 +1,280 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/ParameterizedShower.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/phys/ParameterizedShowerAction.hh"
+
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas/geo/GeoMaterialParams.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/UserActionTestBase.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+#include "celeritas/phys/detail/ShowerSpotSampler.hh"
+#include "celeritas/user/MeshCalo.hh"
+
+#include "DiagnosticRngEngine.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// SPOT SAMPLER
+//---------------------------------------------------------------------------//
+
+class ShowerSpotSamplerTest : public ::celeritas::test::Test
+{
+  protected:
+    using Energy = units::MevEnergy;
+
+    void SetUp() override
+    {
+        // Approximate properties of lead
+        lead_.radiation_length = 0.5612;
+        lead_.moliere_radius = 1.602;
+        lead_.critical_energy = Energy{7.43};
+        lead_.zeff = 82;
+    }
+
+    ShowerProfileParameters profile_;
+    ShowerMaterial lead_;
+    DiagnosticRngEngine<std::mt19937> rng_;
+};
+
+TEST_F(ShowerSpotSamplerTest, num_spots)
+{
+    detail::ShowerSpotSampler sample{
+        profile_, lead_, Energy{10000}, false, 100000};
+    EXPECT_EQ(3081, sample.num_spots());
+    EXPECT_SOFT_EQ((std::log(10000 / 7.43) - 0.858) * 0.5612,
+                   sample.depth_max());
+
+    detail::ShowerSpotSampler sample_capped{
+        profile_, lead_, Energy{10000}, false, 1000};
+    EXPECT_EQ(1000, sample_capped.num_spots());
+
+    // Photon showers peak one radiation length later
+    detail::ShowerSpotSampler sample_photon{
+        profile_, lead_, Energy{10000}, true, 1000};
+    EXPECT_SOFT_EQ(sample.depth_max() + 0.5612, sample_photon.depth_max());
+}
+
+TEST_F(ShowerSpotSamplerTest, low_energy)
+{
+    // Below the critical energy there is no shower profile
+    detail::ShowerSpotSampler sample{profile_, lead_, Energy{5}, false, 1000};
+    EXPECT_EQ(1, sample.num_spots());
+    EXPECT_VEC_EQ((Real3{0, 0, 0}), sample(rng_));
+    EXPECT_EQ(0, rng_.count());
+}
+
+TEST_F(ShowerSpotSamplerTest, profile)
+{
+    detail::ShowerSpotSampler sample{
+        profile_, lead_, Energy{10000}, false, 1000};
+
+    size_type const num_samples = 10000;
+    real_type sum_depth = 0;
+    size_type num_contained = 0;
+    for ([[maybe_unused]] auto i : range(num_samples))
+    {
+        Real3 pos = sample(rng_);
+        EXPECT_GT(pos[2], 0);
+        sum_depth += pos[2];
+        if (std::hypot(pos[0], pos[1]) < 2 * lead_.moliere_radius)
+        {
+            ++num_contained;
+        }
+    }
+
+    // Mean depth of the gamma distribution is alpha / (alpha - 1) T
+    real_type const alpha = 0.21 + (0.492 + 2.38 / 82) * std::log(10000 / 7.43);
+    EXPECT_SOFT_NEAR(alpha / (alpha - 1) * sample.depth_max(),
+                     sum_depth / num_samples,
+                     0.02);
+    // Most of the energy is within two Moliere radii
+    EXPECT_SOFT_NEAR(0.95, real_type(num_contained) / num_samples, 0.05);
+}
+
+//---------------------------------------------------------------------------//
+// ACTION
+//---------------------------------------------------------------------------//
+
+class ParameterizedShowerTest : public SimpleTestBase, public UserActionTestBase
+{
+  protected:
+    using Input = ParameterizedShowerAction::Input;
+    using MevEnergy = units::MevEnergy;
+
+    struct RunResult
+    {
+        size_type num_inner_gammas{0};  //!< Alive gammas in the aluminum
+        size_type num_gammas{0};  //!< All alive gammas
+        real_type edep{0};  //!< Energy deposited in the step [MeV]
+    };
+
+    //! Put the inner box in a "calo" region
+    SPConstGeoMaterial build_geomaterial() override
+    {
+        GeoMaterialParams::Input input;
+        input.geometry = this->geometry();
+        input.materials = this->material();
+        input.volume_to_mat = {MaterialId{0}, MaterialId{1}, MaterialId{}};
+        input.volume_labels
+            = {Label{"inner"}, Label{"world"}, Label{"[EXTERIOR]"}};
+        input.volume_to_region = {RegionId{0}, RegionId{}, RegionId{}};
+        input.region_labels = {Label{"calo"}};
+        return std::make_shared<GeoMaterialParams>(std::move(input));
+    }
+
+    //! Input for showers from gammas in the region
+    Input make_input() const
+    {
+        Input result;
+        result.regions = {"calo"};
+        result.particles = {pdg::gamma()};
+        result.min_energy = MevEnergy{0.1};
+        return result;
+    }
+
+    //! Transport 1 MeV gammas from 1 cm inside the box for one step
+    RunResult run(size_type num_primaries)
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        p.energy = MevEnergy{1};
+        p.position = {4, 0, 0};
+        p.direction = {1, 0, 0};
+        p.event_id = EventId{0};
+        UserActionTestBase::run(p, num_primaries);
+
+        RunResult result;
+        result.edep = this->calc_edep();
+        auto const& state = this->state();
+        for (auto tid : this->find_alive(p.particle_id))
+        {
+            ++result.num_gammas;
+            if (state.materials.state[tid].material_id == MaterialId{0})
+            {
+                ++result.num_inner_gammas;
+            }
+        }
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+
+TEST_F(ParameterizedShowerTest, errors)
+{
+    auto const& core = *this->core();
+    Input inp;
+    EXPECT_THROW(ParameterizedShowerAction::make_and_insert(core, inp),
+                 RuntimeError);
+
+    inp.regions = {"absorber"};
+    EXPECT_THROW(ParameterizedShowerAction::make_and_insert(core, inp),
+                 RuntimeError);
+
+    // Positrons are not defined
+    inp.regions = {"calo"};
+    EXPECT_THROW(ParameterizedShowerAction::make_and_insert(core, inp),
+                 RuntimeError);
+
+    inp = this->make_input();
+    inp.max_energy = inp.min_energy;
+    EXPECT_THROW(ParameterizedShowerAction::make_and_insert(core, inp),
+                 RuntimeError);
+
+    inp = this->make_input();
+    inp.max_spots = 0;
+    EXPECT_THROW(ParameterizedShowerAction::make_and_insert(core, inp),
+                 RuntimeError);
+}
+
+TEST_F(ParameterizedShowerTest, data)
+{
+    auto action = ParameterizedShowerAction::make_and_insert(
+        *this->core(), this->make_input());
+
+    auto const& data = action->host_ref();
+    EXPECT_EQ(1, data.num_regions);
+    EXPECT_EQ(2, data.num_particles);
+    ASSERT_EQ(2, data.min_energy.size());
+    EXPECT_SOFT_EQ(0.1, data.min_energy[ItemId<MevEnergy>{0}].value());
+    EXPECT_SOFT_EQ(0, data.min_energy[ItemId<MevEnergy>{1}].value());
+
+    ASSERT_EQ(2, data.materials.size());
+    ShowerMaterial const& al = data.materials[MaterialId{0}];
+    ASSERT_TRUE(al);
+    EXPECT_SOFT_EQ(13, al.zeff);
+    EXPECT_SOFT_EQ(610 / 14.24, al.critical_energy.value());
+    EXPECT_SOFT_EQ(21.2052 / al.critical_energy.value(),
+                   al.moliere_radius / al.radiation_length);
+    EXPECT_FALSE(data.materials[MaterialId{1}]);
+}
+
+TEST_F(ParameterizedShowerTest, no_shower)
+{
+    auto result = this->run(128);
+    EXPECT_EQ(128, result.num_gammas);
+    EXPECT_GT(result.num_inner_gammas, 0);
+    EXPECT_LT(result.num_inner_gammas, 128);
+}
+
+TEST_F(ParameterizedShowerTest, local)
+{
+    ParameterizedShowerAction::make_and_insert(*this->core(),
+                                               this->make_input());
+
+    // Gammas that interacted in the region are replaced by showers and
+    // deposited locally
+    auto result = this->run(128);
+    EXPECT_EQ(0, result.num_inner_gammas);
+    EXPECT_GT(result.num_gammas, 0);
+    EXPECT_LT(result.num_gammas, 128);
+    EXPECT_GT(result.edep, 0);
+}
+
+TEST_F(ParameterizedShowerTest, mesh)
+{
+    MeshCaloInput mesh_inp;
+    mesh_inp.lower = {-5, -5, -5};
+    mesh_inp.upper = {5, 5, 5};
+    mesh_inp.num_bins = {10, 1, 1};
+    auto mesh = std::make_shared<MeshCalo>(mesh_inp, 1);
+
+    auto inp = this->make_input();
+    inp.mesh = mesh;
+    ParameterizedShowerAction::make_and_insert(*this->core(), inp);
+
+    // Shower energy is on the mesh rather than deposited in the step
+    auto result = this->run(128);
+    EXPECT_EQ(0, result.num_inner_gammas);
+    EXPECT_SOFT_EQ(0, result.edep);
+
+    auto edep = mesh->calc_total_energy_deposition();
+    real_type total = std::accumulate(edep.begin(), edep.end(), real_type{0});
+    EXPECT_GT(total, 0);
+    EXPECT_LT(total, 128);
+    for (auto i : range(4))
+    {
+        // Showers start in the positive half of the box
+        EXPECT_EQ(0, edep[i]) << "bin " << i;
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -142,7 +142,7 @@ TEST_F(PhysicsParamsTest, output)
         GTEST_SKIP() << "Test results are based on CGS units";
     }
     EXPECT_JSON_EQ(
-        R"json({"_category":"internal","_label":"physics","models":{"label":["mock-model-1","mock-model-2","mock-model-3","mock-model-4","mock-model-5","mock-model-6","mock-model-7","mock-model-8","mock-model-9","mock-model-10","mock-model-11"],"process_id":[0,0,1,2,2,2,3,3,4,4,5]},"options":{"fixed_step_limiter":0.0,"linear_loss_limit":0.01,"lowest_electron_energy":[0.001,"MeV"],"max_step_over_range":0.2,"min_eprime_over_e":0.8,"min_range":0.1,"spline_eloss_order":1},"processes":{"label":["scattering","absorption","purrs","hisses","meows","barks"]},"sizes":{"integral_xs":8,"model_groups":8,"model_ids":11,"process_groups":5,"process_ids":8,"reals":257,"value_grid_ids":89,"value_grids":89,"value_tables":29}})json",
+        R"json({"_category":"internal","_label":"physics","models":{"label":["mock-model-1","mock-model-2","mock-model-3","mock-model-4","mock-model-5","mock-model-6","mock-model-7","mock-model-8","mock-model-9","mock-model-10","mock-model-11"],"process_id":[0,0,1,2,2,2,3,3,4,4,5]},"options":{"fixed_step_limiter":0.0,"linear_loss_limit":0.01,"lowest_electron_energy":[0.001,"MeV"],"max_step_over_range":0.2,"min_eprime_over_e":0.8,"min_range":0.1,"spline_eloss_order":1},"processes":{"label":["scattering","absorption","purrs","hisses","meows","barks"]},"sizes":{"integral_xs":8,"model_groups":8,"model_ids":11,"process_groups":5,"process_ids":8,"reals":39,"table_values":218,"value_grid_ids":89,"value_grids":89,"value_tables":29}})json",
         to_string(out));
 }
 
@@ -444,7 +444,7 @@ TEST_F(PhysicsTrackViewHostTest, value_grids)
     EXPECT_VEC_EQ(expected_grid_ids, grid_ids);
 }
 
-TEST_F(PhysicsTrackViewHostTest, calc_xs)
+TEST_F(PhysicsTrackViewHostTest, TEST_IF_CELERITAS_DOUBLE_TABLES(calc_xs))
 {
     // Cross sections: same across particle types, constant in energy, scale
     // according to material number density
@@ -468,7 +468,8 @@ TEST_F(PhysicsTrackViewHostTest, calc_xs)
     EXPECT_VEC_SOFT_EQ(expected_xs, xs);
 }
 
-TEST_F(PhysicsTrackViewHostTest, calc_eloss_range)
+TEST_F(PhysicsTrackViewHostTest,
+       TEST_IF_CELERITAS_DOUBLE_TABLES(calc_eloss_range))
 {
     // Default range and scaling
     EXPECT_SOFT_EQ(0.1 * units::centimeter, params_ref.scalars.min_range);
@@ -524,7 +525,7 @@ TEST_F(PhysicsTrackViewHostTest, calc_eloss_range)
     EXPECT_VEC_SOFT_EQ(expected_step, step);
 }
 
-TEST_F(PhysicsTrackViewHostTest, use_integral)
+TEST_F(PhysicsTrackViewHostTest, TEST_IF_CELERITAS_DOUBLE_TABLES(use_integral))
 {
     {
         // No energy loss tables
@@ -620,7 +621,8 @@ TEST_F(PhysicsTrackViewHostTest, element_selector)
     }
 }
 
-TEST_F(PhysicsTrackViewHostTest, cuda_surrogate)
+TEST_F(PhysicsTrackViewHostTest,
+       TEST_IF_CELERITAS_DOUBLE_TABLES(cuda_surrogate))
 {
     std::vector<real_type> step;
     for (char const* particle : {"gamma", "anti-celeriton"})
@@ -648,7 +650,8 @@ TEST_F(PhysicsTrackViewHostTest, cuda_surrogate)
     EXPECT_VEC_SOFT_EQ(expected_step, step);
 }
 
-TEST_F(PhysicsTrackViewHostTest, calc_spline_xs)
+TEST_F(PhysicsTrackViewHostTest,
+       TEST_IF_CELERITAS_DOUBLE_TABLES(calc_spline_xs))
 {
     // Cross sections: same across particle types, constant in energy, scale
     // according to material number density
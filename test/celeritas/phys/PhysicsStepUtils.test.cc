@@ -100,7 +100,8 @@ class PhysicsStepUtilsTest : public MockTestBase
 // TESTS
 //---------------------------------------------------------------------------//
 
-TEST_F(PhysicsStepUtilsTest, calc_physics_step_limit)
+TEST_F(PhysicsStepUtilsTest,
+       TEST_IF_CELERITAS_DOUBLE_TABLES(calc_physics_step_limit))
 {
     MaterialTrackView material(
         this->material()->host_ref(), mat_state.ref(), TrackSlotId{0});
@@ -217,7 +218,8 @@ TEST_F(PhysicsStepUtilsTest, calc_physics_step_limit)
     }
 }
 
-TEST_F(PhysicsStepUtilsTest, calc_mean_energy_loss)
+TEST_F(PhysicsStepUtilsTest,
+       TEST_IF_CELERITAS_DOUBLE_TABLES(calc_mean_energy_loss))
 {
     MaterialTrackView material(
         this->material()->host_ref(), mat_state.ref(), TrackSlotId{0});
@@ -280,7 +282,7 @@ TEST_F(PhysicsStepUtilsTest, calc_mean_energy_loss)
 }
 
 TEST_F(PhysicsStepUtilsTest,
-       TEST_IF_CELERITAS_DOUBLE(select_discrete_interaction))
+       TEST_IF_CELERITAS_DOUBLE_TABLES(select_discrete_interaction))
 {
     MaterialTrackView material(
         this->material()->host_ref(), mat_state.ref(), TrackSlotId{0});
@@ -413,7 +415,8 @@ class StepLimiterTest : public PhysicsStepUtilsTest
     }
 };
 
-TEST_F(StepLimiterTest, calc_physics_step_limit)
+TEST_F(StepLimiterTest,
+       TEST_IF_CELERITAS_DOUBLE_TABLES(calc_physics_step_limit))
 {
     MaterialTrackView material(
         this->material()->host_ref(), mat_state.ref(), TrackSlotId{0});
@@ -470,7 +473,8 @@ class SplinePhysicsStepUtilsTest : public PhysicsStepUtilsTest
     }
 };
 
-TEST_F(SplinePhysicsStepUtilsTest, calc_mean_energy_loss)
+TEST_F(SplinePhysicsStepUtilsTest,
+       TEST_IF_CELERITAS_DOUBLE_TABLES(calc_mean_energy_loss))
 {
     MaterialTrackView material(
         this->material()->host_ref(), mat_state.ref(), TrackSlotId{0});
@@ -533,5 +537,105 @@ TEST_F(SplinePhysicsStepUtilsTest, calc_mean_energy_loss)
 }
 //---------------------------------------------------------------------------//
 
+class GammaGeneralPhysicsStepUtilsTest : public PhysicsStepUtilsTest
+{
+    PhysicsOptions build_physics_options() const override
+    {
+        PhysicsOptions opts;
+        opts.gamma_general = true;
+        return opts;
+    }
+};
+
+TEST_F(GammaGeneralPhysicsStepUtilsTest,
+       TEST_IF_CELERITAS_DOUBLE_TABLES(calc_physics_step_limit))
+{
+    MaterialTrackView material(
+        this->material()->host_ref(), mat_state.ref(), TrackSlotId{0});
+    ParticleTrackView particle(
+        this->particle()->host_ref(), par_state.ref(), TrackSlotId{0});
+    PhysicsStepView pstep = this->step_view();
+    auto discrete_action
+        = this->physics()->host_ref().scalars.discrete_action();
+
+    // Compare against the sum of the separate process cross sections
+    for (auto mat_id : range(MaterialId{this->material()->size()}))
+    {
+        MaterialView mat_view(this->material()->host_ref(), mat_id);
+        for (real_type energy : {1e-5, 1e-2, 1.0, 50.0})
+        {
+            PhysicsTrackView phys = this->init_track(
+                &material, mat_id, &particle, "gamma", MevEnergy{energy});
+            EXPECT_TRUE(phys.general_xs_grid(particle.energy()));
+
+            real_type expected_xs = 0;
+            for (auto ppid :
+                 range(ParticleProcessId{phys.num_particle_processes()}))
+            {
+                expected_xs
+                    += phys.calc_xs(ppid, mat_view, particle.energy());
+            }
+
+            phys.interaction_mfp(1);
+            StepLimit step
+                = calc_physics_step_limit(material, particle, phys, pstep);
+            EXPECT_EQ(discrete_action, step.action);
+            EXPECT_SOFT_EQ(expected_xs, pstep.macro_xs());
+            EXPECT_SOFT_EQ(1 / expected_xs, step.step);
+        }
+    }
+
+    // Other particles are unaffected
+    PhysicsTrackView phys = this->init_track(
+        &material, MaterialId{1}, &particle, "celeriton", MevEnergy{10});
+    EXPECT_FALSE(phys.general_xs_grid(particle.energy()));
+    phys.interaction_mfp(1e-4);
+    StepLimit step = calc_physics_step_limit(material, particle, phys, pstep);
+    EXPECT_SOFT_EQ(1.e-4 / 9.e-3, to_cm(step.step));
+}
+
+TEST_F(GammaGeneralPhysicsStepUtilsTest,
+       TEST_IF_CELERITAS_DOUBLE(select_discrete_interaction))
+{
+    MaterialTrackView material(
+        this->material()->host_ref(), mat_state.ref(), TrackSlotId{0});
+    ParticleTrackView particle(
+        this->particle()->host_ref(), par_state.ref(), TrackSlotId{0});
+    PhysicsStepView pstep = this->step_view();
+    auto const model_offset
+        = this->physics()->host_ref().scalars.model_to_action;
+
+    MaterialView mat_view(this->material()->host_ref(), MaterialId{1});
+    PhysicsTrackView phys = this->init_track(
+        &material, MaterialId{1}, &particle, "gamma", MevEnergy{1});
+    phys.interaction_mfp(1);
+    calc_physics_step_limit(material, particle, phys, pstep);
+
+    // Testing cheat.
+    PhysicsTrackView::PhysicsStateRef state_shortcut(phys_state.ref());
+    state_shortcut.state[TrackSlotId{0}].interaction_mfp = 0;
+
+    // Scattering (model 0) is one third of the total, absorption (model 2)
+    // is the remainder
+    int const num_samples = 10000;
+    std::vector<int> counts(3, 0);
+    for ([[maybe_unused]] int i : range(num_samples))
+    {
+        auto action = select_discrete_interaction(
+            mat_view, particle, phys, pstep, this->rng());
+        auto model_idx = action.unchecked_get() - model_offset;
+        ASSERT_LT(model_idx, counts.size());
+        ++counts[model_idx];
+    }
+    EXPECT_EQ(0, counts[1]);
+    EXPECT_SOFT_NEAR(
+        1.0 / 3, static_cast<real_type>(counts[0]) / num_samples, 0.05);
+
+    // Only a single random number is used per selection
+    EXPECT_EQ(2 * num_samples, this->rng().count());
+}
+
+//---------------------------------------------------------------------------//
+
 }  // namespace test
 }  // namespace celeritas
@@ -0,0 +1,158 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/RangeRejection.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/phys/RangeRejectionAction.hh"
+
+#include <vector>
+
+#include "celeritas/MockTestBase.hh"
+#include "celeritas/geo/GeoMaterialParams.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/UserActionTestBase.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class RangeRejectionTest : public MockTestBase, public UserActionTestBase
+{
+  protected:
+    using Input = RangeRejectionAction::Input;
+    using MevEnergy = units::MevEnergy;
+
+    struct RunResult
+    {
+        size_type num_electrons{0};  //!< Alive electrons
+        real_type edep{0};  //!< Energy deposited in the step [MeV]
+    };
+
+    //! Put the outer shell in an "absorber" region
+    SPConstGeoMaterial build_geomaterial() override
+    {
+        GeoMaterialParams::Input input;
+        input.geometry = this->geometry();
+        input.materials = this->material();
+        input.volume_to_mat
+            = {MaterialId{0}, MaterialId{2}, MaterialId{1}, MaterialId{3}};
+        input.volume_labels = {
+            Label{"inner"}, Label{"middle"}, Label{"outer"}, Label{"world"}};
+        input.volume_to_region
+            = {RegionId{}, RegionId{}, RegionId{0}, RegionId{}};
+        input.region_labels = {Label{"absorber"}};
+        return std::make_shared<GeoMaterialParams>(std::move(input));
+    }
+
+    //! Transport electrons from the middle of the outer shell for one step
+    RunResult run(size_type num_primaries, MevEnergy energy)
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::electron());
+        p.energy = energy;
+        p.position = {4.5, 0, 0};
+        p.direction = {0, 1, 0};
+        p.event_id = EventId{0};
+        UserActionTestBase::run(p, num_primaries);
+
+        RunResult result;
+        result.num_electrons = this->count_alive(p.particle_id);
+        result.edep = this->calc_edep();
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(RangeRejectionTest, errors)
+{
+    auto const& core = *this->core();
+    Input inp;
+    EXPECT_THROW(RangeRejectionAction::make_and_insert(core, inp),
+                 RuntimeError);
+
+    inp.regions = {"calo"};
+    EXPECT_THROW(RangeRejectionAction::make_and_insert(core, inp),
+                 RuntimeError);
+
+    inp.regions = {"absorber"};
+    inp.particles = {pdg::proton()};
+    EXPECT_THROW(RangeRejectionAction::make_and_insert(core, inp),
+                 RuntimeError);
+
+    inp.particles = {};
+    EXPECT_THROW(RangeRejectionAction::make_and_insert(core, inp),
+                 RuntimeError);
+
+    inp.particles = {pdg::electron()};
+    inp.max_energy = MevEnergy{0};
+    EXPECT_THROW(RangeRejectionAction::make_and_insert(core, inp),
+                 RuntimeError);
+}
+
+TEST_F(RangeRejectionTest, data)
+{
+    Input inp;
+    inp.regions = {"absorber"};
+    inp.max_energy = MevEnergy{2};
+    auto action = RangeRejectionAction::make_and_insert(*this->core(), inp);
+
+    auto const& data = action->host_ref();
+    auto const num_particles = this->particle()->size();
+    EXPECT_EQ(1, data.num_regions);
+    EXPECT_EQ(num_particles, data.num_particles);
+    ASSERT_EQ(num_particles, data.max_energy.size());
+    auto electron = this->particle()->find(pdg::electron());
+    for (auto i : range(data.max_energy.size()))
+    {
+        EXPECT_SOFT_EQ(i == electron.get() ? 2 : 0,
+                       data.max_energy[ItemId<MevEnergy>{i}].value());
+    }
+}
+
+TEST_F(RangeRejectionTest, no_rejection)
+{
+    auto result = this->run(16, MevEnergy{1});
+    EXPECT_EQ(16, result.num_electrons);
+}
+
+TEST_F(RangeRejectionTest, above_limit)
+{
+    Input inp;
+    inp.regions = {"absorber"};
+    inp.max_energy = MevEnergy{0.01};
+    RangeRejectionAction::make_and_insert(*this->core(), inp);
+
+    // Electrons slowed down in the step but are still above the limit
+    auto result = this->run(16, MevEnergy{1});
+    EXPECT_EQ(16, result.num_electrons);
+}
+
+TEST_F(RangeRejectionTest, rejection)
+{
+    Input inp;
+    inp.regions = {"absorber"};
+    RangeRejectionAction::make_and_insert(*this->core(), inp);
+
+    // All electrons are far from the boundary: their energy is deposited
+    auto result = this->run(16, MevEnergy{1});
+    EXPECT_EQ(0, result.num_electrons);
+    EXPECT_SOFT_EQ(16, result.edep);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
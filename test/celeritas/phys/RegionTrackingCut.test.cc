@@ -0,0 +1,210 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/RegionTrackingCut.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/phys/RegionTrackingCutAction.hh"
+
+#include <vector>
+
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas/geo/GeoMaterialParams.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/UserActionTestBase.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+#include "celeritas/user/SimpleCalo.hh"
+#include "celeritas/user/StepCollector.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class RegionTrackingCutTest : public SimpleTestBase, public UserActionTestBase
+{
+  protected:
+    using Input = RegionTrackingCutAction::Input;
+    using MevEnergy = units::MevEnergy;
+
+    struct RunResult
+    {
+        size_type num_inner_gammas{0};  //!< Alive gammas in the aluminum
+        size_type num_gammas{0};  //!< All alive gammas
+        real_type edep{0};  //!< Energy deposited in the step [MeV]
+    };
+
+    //! Put the inner box in a "calo" region
+    SPConstGeoMaterial build_geomaterial() override
+    {
+        GeoMaterialParams::Input input;
+        input.geometry = this->geometry();
+        input.materials = this->material();
+        input.volume_to_mat = {MaterialId{0}, MaterialId{1}, MaterialId{}};
+        input.volume_labels
+            = {Label{"inner"}, Label{"world"}, Label{"[EXTERIOR]"}};
+        input.volume_to_region = {RegionId{0}, RegionId{}, RegionId{}};
+        input.region_labels = {Label{"calo"}};
+        return std::make_shared<GeoMaterialParams>(std::move(input));
+    }
+
+    //! Transport 1 MeV gammas from 1 cm inside the box for one step
+    RunResult run(size_type num_primaries)
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        p.energy = MevEnergy{1};
+        p.position = {4, 0, 0};
+        p.direction = {1, 0, 0};
+        p.event_id = EventId{0};
+        UserActionTestBase::run(p, num_primaries);
+
+        RunResult result;
+        result.edep = this->calc_edep();
+        auto const& state = this->state();
+        for (auto tid : this->find_alive(p.particle_id))
+        {
+            ++result.num_gammas;
+            if (state.materials.state[tid].material_id == MaterialId{0})
+            {
+                ++result.num_inner_gammas;
+            }
+        }
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(RegionTrackingCutTest, regions)
+{
+    auto const& geo = *this->geometry();
+    auto const& geo_mat = *this->geomaterial();
+    ASSERT_EQ(1, geo_mat.regions().size());
+    EXPECT_EQ(RegionId{0}, geo_mat.regions().find_unique("calo"));
+    EXPECT_EQ(RegionId{0},
+              geo_mat.region_id(geo.volumes().find_unique("inner")));
+    EXPECT_EQ(RegionId{},
+              geo_mat.region_id(geo.volumes().find_unique("world")));
+}
+
+TEST_F(RegionTrackingCutTest, errors)
+{
+    auto const& core = *this->core();
+    Input inp;
+    EXPECT_THROW(RegionTrackingCutAction::make_and_insert(core, inp),
+                 RuntimeError);
+
+    inp.regions["absorber"][pdg::gamma()].min_energy = MevEnergy{1};
+    EXPECT_THROW(RegionTrackingCutAction::make_and_insert(core, inp),
+                 RuntimeError);
+
+    inp.regions.clear();
+    inp.regions["calo"][pdg::proton()].min_energy = MevEnergy{1};
+    EXPECT_THROW(RegionTrackingCutAction::make_and_insert(core, inp),
+                 RuntimeError);
+
+    inp.regions.clear();
+    inp.regions["calo"][pdg::gamma()].min_energy = MevEnergy{-1};
+    EXPECT_THROW(RegionTrackingCutAction::make_and_insert(core, inp),
+                 RuntimeError);
+
+    inp.regions.clear();
+    inp.volumes[VolumeId{100}].max_time = 1;
+    EXPECT_THROW(RegionTrackingCutAction::make_and_insert(core, inp),
+                 RuntimeError);
+}
+
+TEST_F(RegionTrackingCutTest, data)
+{
+    Input inp;
+    inp.regions["calo"][pdg::electron()].min_energy = MevEnergy{0.25};
+    auto action
+        = RegionTrackingCutAction::make_and_insert(*this->core(), inp);
+
+    auto const& data = action->host_ref();
+    EXPECT_EQ(1, data.num_regions);
+    EXPECT_EQ(2, data.num_particles);
+    ASSERT_EQ(2, data.region_cuts.size());
+    using CutId = ItemId<TrackingCutLimits>;
+    EXPECT_FALSE(data.region_cuts[CutId{0}].has_cuts());
+    EXPECT_SOFT_EQ(0.25, data.region_cuts[CutId{1}].min_energy.value());
+    EXPECT_TRUE(data.volume_cuts.empty());
+}
+
+TEST_F(RegionTrackingCutTest, after_step_collector)
+{
+    // Step data would miss the cuts if they were applied after gathering
+    auto calo = std::make_shared<SimpleCalo>(
+        std::vector<Label>{Label{"inner"}}, *this->geometry(), 1);
+    StepCollector::make_and_insert(*this->core(), {calo});
+
+    Input inp;
+    inp.regions["calo"][pdg::gamma()].min_energy = MevEnergy{10};
+    EXPECT_THROW(RegionTrackingCutAction::make_and_insert(*this->core(), inp),
+                 RuntimeError);
+}
+
+TEST_F(RegionTrackingCutTest, no_cut)
+{
+    auto result = this->run(128);
+    EXPECT_EQ(128, result.num_gammas);
+    EXPECT_GT(result.num_inner_gammas, 0);
+    EXPECT_LT(result.num_inner_gammas, 128);
+}
+
+TEST_F(RegionTrackingCutTest, cut)
+{
+    Input inp;
+    inp.regions["calo"][pdg::gamma()].min_energy = MevEnergy{10};
+    RegionTrackingCutAction::make_and_insert(*this->core(), inp);
+
+    // Gammas that scattered in the region are killed, and those that escaped
+    // the region survive
+    auto result = this->run(128);
+    EXPECT_EQ(0, result.num_inner_gammas);
+    EXPECT_GT(result.num_gammas, 0);
+    EXPECT_LT(result.num_gammas, 128);
+    EXPECT_GT(result.edep, 0);
+}
+
+TEST_F(RegionTrackingCutTest, volume_cut)
+{
+    // Volume cuts apply to all particle types
+    Input inp;
+    inp.volumes[this->geometry()->volumes().find_unique("inner")].min_energy
+        = MevEnergy{10};
+    RegionTrackingCutAction::make_and_insert(*this->core(), inp);
+
+    auto result = this->run(128);
+    EXPECT_EQ(0, result.num_inner_gammas);
+    EXPECT_GT(result.num_gammas, 0);
+    EXPECT_LT(result.num_gammas, 128);
+}
+
+TEST_F(RegionTrackingCutTest, time_cut)
+{
+    // All tracks are killed after their first step in the region
+    Input inp;
+    inp.regions["calo"][pdg::gamma()].max_time = 1e-15;
+    RegionTrackingCutAction::make_and_insert(*this->core(), inp);
+
+    auto result = this->run(128);
+    EXPECT_EQ(0, result.num_inner_gammas);
+    EXPECT_GT(result.edep, 0);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,232 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/UserLimits.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/phys/UserLimitsParams.hh"
+
+#include <string>
+#include <vector>
+
+#include "corecel/ScopedLogStorer.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/sys/ActionRegistry.hh"
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/UserActionTestBase.hh"
+#include "celeritas/io/ImportData.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class UserLimitsTest : public SimpleTestBase, public UserActionTestBase
+{
+  protected:
+    using Input = UserLimitsParams::Input;
+    using MevEnergy = units::MevEnergy;
+
+    struct RunResult
+    {
+        size_type num_alive{0};  //!< Alive tracks after the step
+        std::vector<real_type> steps;  //!< Step length of alive tracks
+        std::vector<std::string> actions;  //!< Post-step action of alive
+        real_type edep{0};  //!< Energy deposited in the step [MeV]
+    };
+
+    //! Transport 1 MeV electrons from 1 cm inside the box for one step
+    RunResult run(size_type num_primaries, real_type time = 0)
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::electron());
+        p.energy = MevEnergy{1};
+        p.position = {4, 0, 0};
+        p.direction = {1, 0, 0};
+        p.time = time;
+        p.event_id = EventId{0};
+        UserActionTestBase::run(p, num_primaries);
+
+        RunResult result;
+        result.edep = this->calc_edep();
+        auto const& sim = this->state().sim;
+        auto const& actions = *this->action_reg();
+        for (auto tid : this->find_alive())
+        {
+            ++result.num_alive;
+            result.steps.push_back(sim.step_length[tid]);
+            result.actions.emplace_back(
+                actions.id_to_label(sim.post_step_action[tid]));
+        }
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(UserLimitsTest, errors)
+{
+    auto const& core = *this->core();
+    Input inp;
+    EXPECT_THROW(UserLimitsParams::make_and_insert(core, inp), RuntimeError);
+
+    inp.volumes[Label{"inner"}].max_step = 0;
+    EXPECT_THROW(UserLimitsParams::make_and_insert(core, inp), RuntimeError);
+
+    inp.volumes[Label{"inner"}] = {};
+    inp.volumes[Label{"inner"}].min_energy = MevEnergy{-1};
+    EXPECT_THROW(UserLimitsParams::make_and_insert(core, inp), RuntimeError);
+}
+
+TEST_F(UserLimitsTest, data)
+{
+    Input inp;
+    inp.volumes[Label{"inner"}].max_step = 0.25;
+    inp.volumes[Label{"world", "0x1234"}].max_time = 1e-9;
+    inp.volumes[Label{"world", "0x1234"}].min_energy = MevEnergy{0.1};
+    inp.volumes[Label{"nonexistent"}].max_step = 1;
+    auto limits = UserLimitsParams::make_and_insert(*this->core(), inp);
+    ASSERT_TRUE(limits);
+    EXPECT_TRUE(limits->has_step_limit());
+    EXPECT_TRUE(limits->has_cuts());
+
+    auto const& actions = *this->action_reg();
+    EXPECT_TRUE(actions.find_action("user-max-step"));
+    EXPECT_TRUE(actions.find_action("user-step-limit"));
+    EXPECT_TRUE(actions.find_action("region-tracking-cut"));
+
+    auto const& geo = *this->geometry();
+    auto const& data = limits->host_ref();
+    ASSERT_EQ(geo.volumes().size(), data.volumes.size());
+    EXPECT_EQ(actions.find_action("user-max-step"), data.step_limit_action);
+
+    auto const& inner = data.volumes[geo.volumes().find_unique("inner")];
+    EXPECT_SOFT_EQ(0.25, inner.max_step);
+    EXPECT_FALSE(inner.has_cuts());
+    auto const& world = data.volumes[geo.volumes().find_unique("world")];
+    EXPECT_FALSE(world.has_step_limit());
+    EXPECT_SOFT_EQ(1e-9, world.max_time);
+    EXPECT_SOFT_EQ(0.1, world.min_energy.value());
+}
+
+TEST_F(UserLimitsTest, duplicate_names)
+{
+    Input inp;
+    inp.volumes[Label{"inner"}].max_step = 0.25;
+    inp.volumes[Label{"world", "1"}].max_step = 1;
+    inp.volumes[Label{"world", "2"}].max_step = 2;
+
+    auto const& core = *this->core();
+    ScopedLogStorer scoped_log{&celeritas::world_logger()};
+    auto limits = UserLimitsParams::make_and_insert(core, inp);
+    ASSERT_TRUE(limits);
+
+    // The ambiguous name is skipped rather than matching either label
+    auto const& geo = *this->geometry();
+    auto const& data = limits->host_ref();
+    EXPECT_SOFT_EQ(
+        0.25, data.volumes[geo.volumes().find_unique("inner")].max_step);
+    EXPECT_FALSE(
+        data.volumes[geo.volumes().find_unique("world")].has_step_limit());
+
+    static char const* const expected_log_messages[] = {
+        "Ignoring user limits for volume names that occur more than once "
+        "without an exact label match: world",
+        "Ignoring user limits for volumes that are not in the geometry: "
+        "world@1, world@2",
+    };
+    EXPECT_VEC_EQ(expected_log_messages, scoped_log.messages());
+}
+
+TEST_F(UserLimitsTest, from_import)
+{
+    ImportData data;
+    data.volumes.resize(3);
+    data.volumes[0].geo_material_id = 0;
+    data.volumes[0].name = "inner0x1234";
+    data.volumes[0].user_limits.max_step = 0.5;
+    data.volumes[1].geo_material_id = 1;
+    data.volumes[1].name = "world";
+    data.volumes[2].name = "placeholder";
+    data.volumes[2].user_limits.min_energy = 1;
+
+    auto inp = Input::from_import(data);
+    ASSERT_EQ(1, inp.volumes.size());
+    auto iter = inp.volumes.find(Label{"inner", "0x1234"});
+    ASSERT_NE(inp.volumes.end(), iter);
+    EXPECT_SOFT_EQ(0.5, iter->second.max_step);
+    EXPECT_FALSE(iter->second.has_cuts());
+
+    // Imported labels match geometry volumes without extensions
+    auto limits = UserLimitsParams::make_and_insert(*this->core(), inp);
+    EXPECT_TRUE(limits->has_step_limit());
+    EXPECT_FALSE(limits->has_cuts());
+    EXPECT_FALSE(this->action_reg()->find_action("region-tracking-cut"));
+}
+
+TEST_F(UserLimitsTest, no_limits)
+{
+    auto result = this->run(16);
+    EXPECT_EQ(16, result.num_alive);
+    EXPECT_SOFT_EQ(1, result.steps.front());
+    EXPECT_EQ("geo-boundary", result.actions.front());
+    EXPECT_SOFT_EQ(0, result.edep);
+}
+
+TEST_F(UserLimitsTest, max_step)
+{
+    Input inp;
+    inp.volumes[Label{"inner"}].max_step = 0.25;
+    UserLimitsParams::make_and_insert(*this->core(), inp);
+
+    auto result = this->run(16);
+    EXPECT_EQ(16, result.num_alive);
+    EXPECT_SOFT_EQ(0.25, result.steps.front());
+    EXPECT_EQ("user-max-step", result.actions.front());
+    EXPECT_SOFT_EQ(0, result.edep);
+}
+
+TEST_F(UserLimitsTest, min_energy)
+{
+    Input inp;
+    // Limit the step so that the track is still in the box
+    inp.volumes[Label{"inner"}].max_step = 0.25;
+    inp.volumes[Label{"inner"}].min_energy = MevEnergy{2};
+    UserLimitsParams::make_and_insert(*this->core(), inp);
+
+    auto result = this->run(16);
+    EXPECT_EQ(0, result.num_alive);
+    EXPECT_SOFT_EQ(16, result.edep);
+}
+
+TEST_F(UserLimitsTest, max_time)
+{
+    Input inp;
+    inp.volumes[Label{"inner"}].max_step = 0.25;
+    inp.volumes[Label{"inner"}].max_time = 1;
+    UserLimitsParams::make_and_insert(*this->core(), inp);
+    auto result = this->run(16, 0.5);
+    EXPECT_EQ(16, result.num_alive);
+    EXPECT_SOFT_EQ(0, result.edep);
+
+    result = this->run(16, 2);
+    EXPECT_EQ(0, result.num_alive);
+    EXPECT_SOFT_EQ(16, result.edep);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -22,6 +22,7 @@
 #include "celeritas/track/ExtendFromPrimariesAction.hh"
 #include "celeritas/track/ExtendFromSecondariesAction.hh"
 #include "celeritas/track/InitializeTracksAction.hh"
+#include "celeritas/track/TrackInitParams.hh"
 
 #include "MockInteractAction.hh"
 #include "celeritas_test.hh"
@@ -220,6 +221,44 @@ struct MemspaceTypeString
 
 TYPED_TEST_SUITE(TrackInitTest, MemspaceTypes, MemspaceTypeString);
 
+//---------------------------------------------------------------------------//
+
+template<class T>
+class TrackInitParticleTest : public TrackInitTest<T>
+{
+  protected:
+    using SPConstTrackInit = typename TrackInitTest<T>::SPConstTrackInit;
+
+    SPConstTrackInit build_init() override
+    {
+        TrackInitParams::Input input;
+        input.capacity = 4096;
+        input.max_events = 4096;
+        input.track_order = TrackOrder::init_particle;
+        return std::make_shared<TrackInitParams>(input);
+    }
+
+    //! Get the particle ID of each track slot (-1 if inactive)
+    std::vector<int> particle_ids()
+    {
+        HostVal<SimStateData> sim;
+        sim = this->state().ref().sim;
+        HostVal<ParticleStateData> particles;
+        particles = this->state().ref().particles;
+
+        std::vector<int> result;
+        for (auto tid : range(TrackSlotId{sim.size()}))
+        {
+            result.push_back(sim.status[tid] == TrackStatus::inactive
+                                 ? -1
+                                 : id_to_int(particles.particle_id[tid]));
+        }
+        return result;
+    }
+};
+
+TYPED_TEST_SUITE(TrackInitParticleTest, MemspaceTypes, MemspaceTypeString);
+
 //---------------------------------------------------------------------------//
 // TESTS
 //---------------------------------------------------------------------------//
@@ -522,7 +561,46 @@ TYPED_TEST(TrackInitTest, extend_from_secondaries)
                 << "iteration " << i;
         }
     }
-}  // namespace test
+}
+
+TYPED_TEST(TrackInitParticleTest, primaries)
+{
+    this->build_states(8);
+
+    // Alternate gammas and electrons
+    auto primaries = this->make_primaries(6);
+    for (auto i : range(primaries.size()))
+    {
+        primaries[i].particle_id = ParticleId(i % 2);
+    }
+    this->extend_from_primaries(make_span(primaries));
+    this->init_tracks();
+
+    // New tracks are grouped by particle type in the trailing vacancies
+    static int const expected_particle_ids[] = {-1, -1, 0, 0, 0, 1, 1, 1};
+    EXPECT_VEC_EQ(expected_particle_ids, this->particle_ids());
+
+    // Kill the gammas and replace them with electrons from the next batch
+    auto interact = [] {
+        std::vector<size_type> const alloc(8, 0);
+        std::vector<bool> const alive
+            = {false, false, false, false, false, true, true, true};
+        return MockInteractAction{ActionId{1}, alloc, alive};
+    }();
+    interact.step(*this->core(), this->state());
+    ExtendFromSecondariesAction{ActionId{2}}.step(*this->core(), this->state());
+
+    primaries = this->make_primaries(5);
+    for (auto i : range(primaries.size()))
+    {
+        primaries[i].particle_id = ParticleId((i + 1) % 2);
+    }
+    this->extend_from_primaries(make_span(primaries));
+    this->init_tracks();
+
+    static int const expected_next_ids[] = {0, 0, 1, 1, 1, 1, 1, 1};
+    EXPECT_VEC_EQ(expected_next_ids, this->particle_ids());
+}
 
 //---------------------------------------------------------------------------//
 }  // namespace test
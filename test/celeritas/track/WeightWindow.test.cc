@@ -0,0 +1,186 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/WeightWindow.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/track/WeightWindowAction.hh"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/UserActionTestBase.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class WeightWindowTest : public SimpleTestBase, public UserActionTestBase
+{
+  protected:
+    using Input = WeightWindowAction::Input;
+
+    struct RunResult
+    {
+        std::vector<real_type> weights;  //!< Weights of alive tracks
+        size_type num_queued{0};
+    };
+
+    //! Lower bounds for only the "inner" volume, others unbiased
+    std::vector<std::vector<real_type>> make_bounds(real_type lower)
+    {
+        auto const& geo = *this->geometry();
+        VolumeId inner = geo.volumes().find_unique("inner");
+        CELER_ASSERT(inner);
+        std::vector<std::vector<real_type>> result(geo.volumes().size(), {0});
+        result[inner.get()] = {lower};
+        return result;
+    }
+
+    //! Transport gammas of a given weight for a few steps
+    RunResult run(size_type num_primaries, real_type weight, size_type steps)
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        p.energy = units::MevEnergy{1};
+        p.position = {0, 0, 0};
+        p.direction = {1, 0, 0};
+        p.event_id = EventId{0};
+        p.weight = weight;
+        auto count = UserActionTestBase::run(p, num_primaries, steps);
+
+        RunResult result;
+        auto const& sim = this->state().sim;
+        for (auto tid : this->find_alive())
+        {
+            result.weights.push_back(sim.weight[tid]);
+        }
+        result.num_queued = count.queued;
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(WeightWindowTest, errors)
+{
+    Input inp;
+    EXPECT_THROW(WeightWindowAction(ActionId{0}, inp), RuntimeError);
+
+    inp.lower_bounds = {{1, 2}};
+    EXPECT_THROW(WeightWindowAction(ActionId{0}, inp), RuntimeError);
+
+    inp.energy_grid = {1, 1};
+    inp.lower_bounds = {{1, 2, 3}};
+    EXPECT_THROW(WeightWindowAction(ActionId{0}, inp), RuntimeError);
+
+    inp.energy_grid = {1};
+    inp.lower_bounds = {{1, -1}};
+    EXPECT_THROW(WeightWindowAction(ActionId{0}, inp), RuntimeError);
+
+    inp.lower_bounds = {{1, 2}};
+    inp.survival_ratio = 10;
+    EXPECT_THROW(WeightWindowAction(ActionId{0}, inp), RuntimeError);
+
+    inp.survival_ratio = 3;
+    inp.lower_bounds.assign(this->geometry()->volumes().size() + 1, {1, 2});
+    EXPECT_THROW(WeightWindowAction::make_and_insert(*this->core(), inp),
+                 RuntimeError);
+}
+
+TEST_F(WeightWindowTest, data)
+{
+    Input inp;
+    inp.energy_grid = {0.1, 1};
+    inp.lower_bounds = {{0, 0, 0}, {0.5, 1, 2}};
+    WeightWindowAction action(ActionId{0}, inp);
+
+    auto const& data = action.host_ref();
+    EXPECT_EQ(2, data.num_volumes);
+    EXPECT_EQ(5, data.max_split);
+    ASSERT_EQ(6, data.windows.size());
+
+    WeightWindow const& ww = data.windows[ItemId<WeightWindow>{4}];
+    EXPECT_SOFT_EQ(1, ww.lower);
+    EXPECT_SOFT_EQ(5, ww.upper);
+    EXPECT_SOFT_EQ(3, ww.survival);
+    EXPECT_FALSE(data.windows[ItemId<WeightWindow>{0}]);
+}
+
+TEST_F(WeightWindowTest, no_window)
+{
+    auto result = this->run(256, 0.5, 1);
+    EXPECT_EQ(256, result.weights.size());
+    EXPECT_TRUE(std::all_of(result.weights.begin(),
+                            result.weights.end(),
+                            [](real_type w) { return w == real_type{0.5}; }));
+}
+
+TEST_F(WeightWindowTest, roulette)
+{
+    Input inp;
+    inp.lower_bounds = this->make_bounds(1.0);
+    WeightWindowAction::make_and_insert(*this->core(), inp);
+
+    size_type const num_primaries = 256;
+    auto result = this->run(num_primaries, 0.5, 1);
+
+    // Surviving tracks have the survival weight (unless they created a
+    // secondary on the first step)
+    size_type num_survived = std::count(
+        result.weights.begin(), result.weights.end(), real_type{3});
+    size_type num_skipped = std::count(
+        result.weights.begin(), result.weights.end(), real_type{0.5});
+    EXPECT_EQ(result.weights.size(), num_survived + num_skipped);
+    EXPECT_LT(result.weights.size(), num_primaries / 2);
+
+    // Total weight is preserved on average
+    real_type total = std::accumulate(
+        result.weights.begin(), result.weights.end(), real_type{0});
+    EXPECT_SOFT_NEAR(0.5 * num_primaries, total, 0.3);
+}
+
+TEST_F(WeightWindowTest, split)
+{
+    Input inp;
+    inp.lower_bounds = this->make_bounds(1.0);
+    inp.max_split = 3;
+    WeightWindowAction::make_and_insert(*this->core(), inp);
+
+    size_type const num_primaries = 16;
+    auto result = this->run(num_primaries, 20.0, 1);
+
+    // Split tracks are limited by the maximum split, and the copies are
+    // queued for initialization
+    real_type const split_weight = real_type{20} / 3;
+    size_type num_split = std::count_if(
+        result.weights.begin(), result.weights.end(), [&](real_type w) {
+            return soft_equal(split_weight, w);
+        });
+    EXPECT_GT(num_split, 0);
+    EXPECT_GE(result.num_queued, 2 * num_split);
+    for (real_type w : result.weights)
+    {
+        EXPECT_TRUE(soft_equal(split_weight, w) || w == real_type{20}) << w;
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
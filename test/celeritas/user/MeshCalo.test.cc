@@ -0,0 +1,245 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/MeshCalo.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/user/MeshCalo.hh"
+
+#include <numeric>
+#include <vector>
+
+#include "corecel/Constants.hh"
+#include "corecel/math/Algorithms.hh"
+#include "celeritas/user/MeshCaloDepositor.hh"
+#include "celeritas/user/detail/MeshSegmentTraverser.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class MeshSegmentTraverserTest : public ::celeritas::test::Test
+{
+  protected:
+    void build(MeshType type, Real3 lower, Real3 upper, Array<size_type, 3> n)
+    {
+        host_.type = type;
+        host_.origin = {0, 0, 0};
+        for (auto ax : range(3))
+        {
+            host_.axes[ax]
+                = UniformGridData::from_bounds(lower[ax], upper[ax], n[ax] + 1);
+        }
+        ref_ = host_;
+    }
+
+    //! Return (bin, fraction) pairs along a segment
+    std::pair<std::vector<int>, std::vector<real_type>>
+    traverse(Real3 const& start, Real3 const& stop) const
+    {
+        std::pair<std::vector<int>, std::vector<real_type>> result;
+        detail::MeshSegmentTraverser traverse{ref_, start, stop};
+        traverse([&result](size_type bin, real_type frac) {
+            result.first.push_back(static_cast<int>(bin));
+            result.second.push_back(frac);
+        });
+        return result;
+    }
+
+    static real_type sum(std::vector<real_type> const& v)
+    {
+        return std::accumulate(v.begin(), v.end(), real_type{0});
+    }
+
+    HostVal<MeshCaloParamsData> host_;
+    HostCRef<MeshCaloParamsData> ref_;
+};
+
+TEST_F(MeshSegmentTraverserTest, cartesian)
+{
+    this->build(MeshType::cartesian, {0, 0, 0}, {4, 2, 1}, {4, 2, 1});
+
+    {
+        // Along x through all four bins
+        auto [bins, frac] = this->traverse({0, 0.5, 0.5}, {4, 0.5, 0.5});
+        static int const expected_bins[] = {0, 2, 4, 6};
+        static real_type const expected_frac[] = {0.25, 0.25, 0.25, 0.25};
+        EXPECT_VEC_EQ(expected_bins, bins);
+        EXPECT_VEC_SOFT_EQ(expected_frac, frac);
+    }
+    {
+        // Backward, starting and ending outside the mesh
+        auto [bins, frac] = this->traverse({6, 1.5, 0.5}, {-2, 1.5, 0.5});
+        static int const expected_bins[] = {7, 5, 3, 1};
+        static real_type const expected_frac[] = {0.125, 0.125, 0.125, 0.125};
+        EXPECT_VEC_EQ(expected_bins, bins);
+        EXPECT_VEC_SOFT_EQ(expected_frac, frac);
+    }
+    {
+        // Diagonal through an edge
+        auto [bins, frac] = this->traverse({0.5, 0.5, 0.5}, {1.5, 1.5, 0.5});
+        static int const expected_bins[] = {0, 3};
+        static real_type const expected_frac[] = {0.5, 0.5};
+        EXPECT_VEC_EQ(expected_bins, bins);
+        EXPECT_VEC_SOFT_EQ(expected_frac, frac);
+    }
+    {
+        // Starting on an edge and moving downward
+        auto [bins, frac] = this->traverse({2, 0.5, 0.5}, {1.5, 0.5, 0.5});
+        static int const expected_bins[] = {2};
+        EXPECT_VEC_EQ(expected_bins, bins);
+        EXPECT_SOFT_EQ(1.0, this->sum(frac));
+    }
+    {
+        // Zero-length segment deposits in the containing bin
+        auto [bins, frac] = this->traverse({3.5, 1.5, 0.5}, {3.5, 1.5, 0.5});
+        static int const expected_bins[] = {7};
+        static real_type const expected_frac[] = {1.0};
+        EXPECT_VEC_EQ(expected_bins, bins);
+        EXPECT_VEC_SOFT_EQ(expected_frac, frac);
+    }
+    {
+        // Entirely outside
+        auto [bins, frac] = this->traverse({0, 0, 2}, {4, 2, 3});
+        EXPECT_EQ(0, bins.size());
+    }
+}
+
+TEST_F(MeshSegmentTraverserTest, cylindrical)
+{
+    real_type const pi = m_pi;
+    this->build(MeshType::cylindrical, {0, -pi, -1}, {2, pi, 1}, {2, 4, 1});
+
+    {
+        // Radially outward along +x: phi bin 2 ([0, pi/2))
+        auto [bins, frac] = this->traverse({0.5, 0, 0}, {3, 0, 0});
+        static int const expected_bins[] = {2, 6};
+        static real_type const expected_frac[] = {0.2, 0.4};
+        EXPECT_VEC_EQ(expected_bins, bins);
+        EXPECT_VEC_SOFT_EQ(expected_frac, frac);
+    }
+    {
+        // Chord at y = 0.5 from -x to +x: crosses the inner radius twice and
+        // from phi bin 3 to 2 through the +y half-plane
+        auto [bins, frac] = this->traverse({-3, 0.5, 0}, {3, 0.5, 0});
+        static int const expected_bins[] = {7, 3, 2, 6};
+        EXPECT_VEC_EQ(expected_bins, bins);
+        real_type outer = std::sqrt(real_type(4) - real_type(0.25));
+        real_type inner = std::sqrt(real_type(1) - real_type(0.25));
+        EXPECT_SOFT_EQ(2 * outer / 6, this->sum(frac));
+        EXPECT_SOFT_EQ(inner / 6, frac[1]);
+        EXPECT_SOFT_EQ((outer - inner) / 6, frac[0]);
+    }
+    {
+        // Crossing the phi = pi seam at x < 0
+        auto [bins, frac] = this->traverse({-1.5, -0.5, 0}, {-1.5, 0.5, 0});
+        static int const expected_bins[] = {4, 7};
+        static real_type const expected_frac[] = {0.5, 0.5};
+        EXPECT_VEC_EQ(expected_bins, bins);
+        EXPECT_VEC_SOFT_EQ(expected_frac, frac);
+    }
+}
+
+TEST_F(MeshSegmentTraverserTest, partial_azimuth)
+{
+    real_type const pi = m_pi;
+    this->build(MeshType::cylindrical, {0, 0, -1}, {1, pi / 2, 1}, {1, 2, 1});
+
+    // Line at y = 0.5 from -x to +x, entering the first quadrant at x = 0
+    auto [bins, frac] = this->traverse({-1, 0.5, 0}, {1, 0.5, 0});
+    static int const expected_bins[] = {1, 0};
+    EXPECT_VEC_EQ(expected_bins, bins);
+    // Crosses phi = pi/4 at x = 0.5 and exits r = 1 at sqrt(0.75)
+    EXPECT_SOFT_EQ(0.25, frac[0]);
+    EXPECT_SOFT_EQ((std::sqrt(real_type(0.75)) - 0.5) / 2, frac[1]);
+}
+
+TEST(MeshCaloTest, construct)
+{
+    MeshCaloInput inp;
+    inp.type = MeshType::cartesian;
+    inp.lower = {-1, -1, -1};
+    inp.upper = {1, 1, 1};
+    inp.num_bins = {2, 3, 4};
+    MeshCalo calo{inp, 2};
+    EXPECT_EQ(24, calo.num_bins());
+    EXPECT_EQ("mesh_calo", calo.label());
+    auto edep = calo.calc_total_energy_deposition();
+    EXPECT_EQ(24, edep.size());
+
+    // Invalid bounds
+    inp.upper[2] = -2;
+    EXPECT_THROW(MeshCalo(inp, 1), RuntimeError);
+
+    // Negative radius
+    inp.type = MeshType::cylindrical;
+    inp.lower = {-1, 0, 0};
+    inp.upper = {1, 1, 1};
+    EXPECT_THROW(MeshCalo(inp, 1), RuntimeError);
+}
+
+TEST(MeshCaloTest, depositor)
+{
+    MeshCaloInput inp;
+    inp.type = MeshType::cylindrical;
+    inp.origin = {0, 0, 10};
+    inp.lower = {0, -real_type(constants::pi), -1};
+    inp.upper = {2, real_type(constants::pi), 1};
+    inp.num_bins = {2, 4, 1};
+    MeshCalo calo{inp, 1};
+
+    auto& state = calo.state_ref<MemSpace::host>(StreamId{0}, 1);
+    MeshCaloDepositor deposit{calo.params_ref<MemSpace::host>(), state};
+    EXPECT_TRUE(deposit({0.5, 0.5, 10}, 1));
+    EXPECT_TRUE(deposit({-1.5, 0.1, 10.5}, 2));
+    EXPECT_TRUE(deposit({0.1, -0.5, 9.5}, 4));
+    EXPECT_FALSE(deposit({0.5, 0.5, 0}, 8));
+    EXPECT_FALSE(deposit({2.5, 0, 10}, 16));
+
+    static real_type const expected_edep[] = {0, 4, 1, 0, 0, 0, 0, 2};
+    // Total includes thread-private tallies before reduction
+    EXPECT_VEC_SOFT_EQ(expected_edep, calo.calc_total_energy_deposition());
+
+    calo.reduce();
+    auto const& stream_edep
+        = calo.energy_deposition<MemSpace::host>(StreamId{0});
+    std::vector<real_type> edep(stream_edep[AllItems<real_type>{}].begin(),
+                                stream_edep[AllItems<real_type>{}].end());
+    EXPECT_VEC_SOFT_EQ(expected_edep, edep);
+    EXPECT_VEC_SOFT_EQ(expected_edep, calo.calc_total_energy_deposition());
+
+    calo.clear();
+    EXPECT_VEC_SOFT_EQ(std::vector<real_type>(8, 0),
+                       calo.calc_total_energy_deposition());
+}
+
+TEST(MeshCaloTest, large_mesh)
+{
+    MeshCaloInput inp;
+    inp.type = MeshType::cartesian;
+    inp.lower = {0, 0, 0};
+    inp.upper = {4, 4, 4};
+    inp.num_bins = {4, 4, 4};
+    inp.max_private_bins = 16;
+    MeshCalo calo{inp, 1};
+
+    // Large meshes are never privatized
+    auto& state = calo.state_ref<MemSpace::host>(StreamId{0}, 1);
+    EXPECT_FALSE(state.private_edep);
+
+    MeshCaloDepositor deposit{calo.params_ref<MemSpace::host>(), state};
+    EXPECT_TRUE(deposit({0.5, 0.5, 0.5}, 1));
+    EXPECT_TRUE(deposit({3.5, 3.5, 3.5}, 2));
+    auto edep = calo.calc_total_energy_deposition();
+    EXPECT_SOFT_EQ(1, edep.front());
+    EXPECT_SOFT_EQ(2, edep.back());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -10,6 +10,7 @@
 #include <algorithm>
 
 #include "corecel/cont/Span.hh"
+#include "corecel/data/AuxParamsRegistry.hh"
 #include "corecel/io/LogContextException.hh"
 #include "corecel/sys/ActionRegistry.hh"
 #include "geocel/UnitUtils.hh"
@@ -20,6 +21,7 @@
 #include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"
 #include "celeritas/phys/Primary.hh"
+#include "celeritas/user/MeshCalo.hh"
 #include "celeritas/user/SimpleCalo.hh"
 
 #include "CaloTestBase.hh"
@@ -54,6 +56,7 @@ class KnSimpleLoopTestBase : public SimpleTestBase,
         p.position = {0, 0, 0};
         p.direction = {1, 0, 0};
         p.time = 0;
+        p.weight = weight;
 
         std::vector<Primary> result(count, p);
         for (auto i : range(count))
@@ -62,6 +65,8 @@ class KnSimpleLoopTestBase : public SimpleTestBase,
         }
         return result;
     }
+
+    real_type weight{1};
 };
 
 class KnMctruthTest : public KnSimpleLoopTestBase, public MctruthTestBase
@@ -215,6 +220,40 @@ TEST_F(KnSimpleLoopTestBase, multiple_interfaces)
     EXPECT_EQ(4, mctruth->steps().size());
 }
 
+TEST_F(KnSimpleLoopTestBase, separate_collectors)
+{
+    // Detector-filtered and unfiltered interfaces need separate collectors
+    auto calo = std::make_shared<SimpleCalo>(
+        std::vector<Label>{"inner"}, *this->geometry(), 1);
+    StepCollector::make_and_insert(*this->core(), {calo});
+
+    MeshCaloInput mesh_inp;
+    mesh_inp.lower = {-1000, -1000, -1000};
+    mesh_inp.upper = {1000, 1000, 1000};
+    mesh_inp.num_bins = {1, 1, 1};
+    auto mesh = std::make_shared<MeshCalo>(mesh_inp, 1);
+    StepCollector::make_and_insert(*this->core(), {mesh});
+
+    auto const& actions = *this->action_reg();
+    EXPECT_TRUE(actions.find_action("step-gather-post"));
+    EXPECT_TRUE(actions.find_action("step-gather-post-1"));
+    EXPECT_TRUE(this->aux_reg()->find("detector-step-1"));
+
+    // Transport a single gamma as in the calorimeter test
+    this->run_impl<MemSpace::host>(1, 64);
+
+    // The mesh encloses the detector and scores all steps
+    auto calo_edep = calo->calc_total_energy_deposition();
+    auto mesh_edep = mesh->calc_total_energy_deposition();
+    ASSERT_EQ(1, calo_edep.size());
+    ASSERT_EQ(1, mesh_edep.size());
+    EXPECT_GE(mesh_edep.front(), calo_edep.front());
+    if (CELERITAS_CORE_RNG == CELERITAS_CORE_RNG_XORWOW)
+    {
+        EXPECT_SOFT_EQ(0.00043564799352598, calo_edep.front());
+    }
+}
+
 //---------------------------------------------------------------------------//
 // KLEIN-NISHINA
 //---------------------------------------------------------------------------//
@@ -285,6 +324,18 @@ TEST_F(KnCaloTest, single_track)
     }
 }
 
+TEST_F(KnCaloTest, weighted)
+{
+    this->weight = 0.25;
+    auto result = this->run<MemSpace::host>(1, 64);
+
+    if (CELERITAS_CORE_RNG == CELERITAS_CORE_RNG_XORWOW)
+    {
+        static double const expected_edep[] = {0.25 * 0.00043564799352598};
+        EXPECT_VEC_SOFT_EQ(expected_edep, result.edep);
+    }
+}
+
 //---------------------------------------------------------------------------//
 // TESTEM3
 //---------------------------------------------------------------------------//
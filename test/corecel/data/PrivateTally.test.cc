@@ -0,0 +1,76 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/PrivateTally.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/data/PrivateTally.hh"
+
+#include <vector>
+
+#include "corecel/data/PrivateTallyData.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+TEST(PrivateTallyTest, privatized)
+{
+    PrivateTallyData<double, Ownership::value, MemSpace::host> storage;
+    resize(&storage, 5, 3);
+    EXPECT_EQ(3, storage.num_threads);
+    EXPECT_EQ(8, storage.stride);
+    EXPECT_EQ(24, storage.values.size());
+
+    PrivateTallyData<double, Ownership::reference, MemSpace::host> data;
+    data = storage;
+
+    std::vector<double> shared(5, 0.0);
+    PrivateTally<double> add{data, make_span(shared)};
+    add(1, 2.0);
+    add(4, 0.5);
+    add(1, 1.0);
+
+    // Shared values are untouched until reduction
+    EXPECT_VEC_SOFT_EQ((std::vector<double>{0, 0, 0, 0, 0}), shared);
+
+    reduce_private_tally(data, make_span(shared));
+    EXPECT_VEC_SOFT_EQ((std::vector<double>{0, 3, 0, 0, 0.5}), shared);
+    for (auto v : storage.values[AllItems<double, MemSpace::host>{}])
+    {
+        EXPECT_EQ(0, v);
+    }
+
+    // Reducing again is a null-op
+    reduce_private_tally(data, make_span(shared));
+    EXPECT_VEC_SOFT_EQ((std::vector<double>{0, 3, 0, 0, 0.5}), shared);
+}
+
+TEST(PrivateTallyTest, shared)
+{
+    // A single thread doesn't need privatization
+    PrivateTallyData<size_type, Ownership::value, MemSpace::host> storage;
+    resize(&storage, 5, 1);
+    EXPECT_FALSE(storage);
+
+    PrivateTallyData<size_type, Ownership::reference, MemSpace::host> data;
+    data = storage;
+
+    std::vector<size_type> shared(3, 0);
+    PrivateTally<size_type> add{data, make_span(shared)};
+    add(0, 1);
+    add(2, 4);
+    EXPECT_VEC_EQ((std::vector<size_type>{1, 0, 4}), shared);
+
+    reduce_private_tally(data, make_span(shared));
+    EXPECT_VEC_EQ((std::vector<size_type>{1, 0, 4}), shared);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -9,7 +9,11 @@
 
 #include <cstdint>
 
+#include "corecel/Config.hh"
+
 #include "corecel/data/CollectionStateStore.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/sys/Stopwatch.hh"
 
 #include "StackAllocator.test.hh"
 #include "celeritas_test.hh"
@@ -31,6 +35,8 @@ class StackAllocatorTest : public Test
 {
   protected:
     using Allocator = StackAllocator<MockSecondary>;
+    using HostValue = MockAllocatorData<Ownership::value, MemSpace::host>;
+    using HostRef = MockAllocatorData<Ownership::reference, MemSpace::host>;
 
     // Get the actual number of allocated secondaries
     int actual_allocations(SATestInput const& in, SATestOutput const& out) const
@@ -85,6 +91,177 @@ TEST_F(StackAllocatorTest, host)
 
 //---------------------------------------------------------------------------//
 
+TEST_F(StackAllocatorTest, host_chunked)
+{
+    HostValue host_data;
+    resize(&host_data, 256, 4);
+    HostRef data;
+    data = host_data;
+    EXPECT_EQ(16, data.chunk_size);
+    Allocator alloc(data);
+    MockSecondary* const begin = &data.storage[ItemId<MockSecondary>{0}];
+
+    // First allocation reserves a chunk
+    MockSecondary* ptr = alloc(3);
+    ASSERT_EQ(begin, ptr);
+    EXPECT_EQ(16, alloc.size());
+    for (MockSecondary& p : alloc.get())
+    {
+        EXPECT_EQ(-1, p.mock_id);
+    }
+    ptr[0].mock_id = 0;
+
+    // Next allocation comes from the same chunk
+    ptr = alloc(2);
+    EXPECT_EQ(begin + 3, ptr);
+    EXPECT_EQ(16, alloc.size());
+
+    // Requests larger than a chunk use the shared stack
+    ptr = alloc(20);
+    EXPECT_EQ(begin + 16, ptr);
+    EXPECT_EQ(36, alloc.size());
+
+    // Request that doesn't fit the remaining chunk leaves a gap
+    ptr = alloc(12);
+    EXPECT_EQ(begin + 36, ptr);
+    EXPECT_EQ(52, alloc.size());
+
+    // Clearing resets the chunks
+    alloc.clear();
+    EXPECT_EQ(0, alloc.size());
+    ptr = alloc(1);
+    EXPECT_EQ(begin, ptr);
+    EXPECT_EQ(-1, ptr->mock_id);
+}
+
+TEST_F(StackAllocatorTest, host_chunked_full)
+{
+    HostValue host_data;
+    resize(&host_data, 64, 2);
+    HostRef data;
+    data = host_data;
+    EXPECT_EQ(8, data.chunk_size);
+    Allocator alloc(data);
+
+    // Fill with a mix of chunked and shared allocations
+    int num_allocated = 0;
+    while (MockSecondary* ptr = alloc(num_allocated % 3 == 0 ? 3 : 1))
+    {
+        ptr->mock_id = num_allocated++;
+    }
+    EXPECT_EQ(64, alloc.size());
+
+    // Remaining space is still usable by single allocations
+    int num_single = 0;
+    while (alloc(1))
+    {
+        ++num_single;
+    }
+    EXPECT_EQ(64, alloc.size());
+    EXPECT_LE(num_single, 2);
+}
+
+TEST_F(StackAllocatorTest, host_threads)
+{
+    constexpr int num_tracks = 4096;
+    HostValue host_data;
+    resize(&host_data, 4 * num_tracks, num_stack_allocator_threads());
+    HostRef data;
+    data = host_data;
+    Allocator alloc(data);
+
+    // Allocate between one and three items per "track"
+    int num_failed = 0;
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel for reduction(+ : num_failed)
+#endif
+    for (int i = 0; i < num_tracks; ++i)
+    {
+        int count = 1 + i % 3;
+        MockSecondary* ptr = alloc(count);
+        if (!ptr)
+        {
+            ++num_failed;
+            continue;
+        }
+        for (int j = 0; j < count; ++j)
+        {
+            ptr[j].mock_id = i;
+        }
+    }
+    EXPECT_EQ(0, num_failed);
+
+    // Every allocated item is assigned exactly once, with null gaps
+    std::vector<int> counts(num_tracks, 0);
+    for (MockSecondary const& p : alloc.get())
+    {
+        if (p.mock_id >= 0)
+        {
+            ++counts[p.mock_id];
+        }
+    }
+    for (int i = 0; i < num_tracks; ++i)
+    {
+        EXPECT_EQ(1 + i % 3, counts[i]) << "for track " << i;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate repeatedly with shared and chunked storage under contention.
+ *
+ * The elapsed times are logged for comparison: run with track-level OpenMP
+ * and many threads (e.g., \c OMP_NUM_THREADS=64 on a many-core node) to see
+ * the effect of contention on the shared size counter.
+ */
+TEST_F(StackAllocatorTest, host_contention)
+{
+    size_type const num_threads = num_stack_allocator_threads();
+    constexpr int num_tracks = 1 << 16;
+    constexpr int num_repeats = 8;
+
+    // Time repeated allocation of one to three items per "track"
+    auto time_allocations = [](size_type num_alloc_threads) {
+        HostValue host_data;
+        resize(&host_data, 4 * num_tracks, num_alloc_threads);
+        HostRef data;
+        data = host_data;
+        Allocator alloc(data);
+
+        int num_failed = 0;
+        Stopwatch get_time;
+        for (int r = 0; r < num_repeats; ++r)
+        {
+            alloc.clear();
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel for reduction(+ : num_failed)
+#endif
+            for (int i = 0; i < num_tracks; ++i)
+            {
+                if (!alloc(1 + i % 3))
+                {
+                    ++num_failed;
+                }
+            }
+        }
+        double elapsed = get_time();
+        EXPECT_EQ(0, num_failed);
+        return elapsed;
+    };
+
+    // A single "thread" in the data disables chunking
+    double shared_time = time_allocations(1);
+    double chunked_time = time_allocations(num_threads);
+
+    double const num_allocs = double(num_tracks) * num_repeats;
+    CELER_LOG(info) << "Stack allocation with " << num_threads
+                    << " threads: shared " << 1e9 * shared_time / num_allocs
+                    << " ns, chunked " << 1e9 * chunked_time / num_allocs
+                    << " ns per allocation";
+}
+
+//---------------------------------------------------------------------------//
+
 TEST_F(StackAllocatorTest, TEST_IF_CELER_DEVICE(device))
 {
     using StateStore
@@ -0,0 +1,52 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/PerfEventCounters.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/sys/PerfEventCounters.hh"
+
+#include <vector>
+
+#include "corecel/ScopedLogStorer.hh"
+#include "corecel/io/Logger.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+TEST(PerfEventCountersTest, all)
+{
+    ScopedLogStorer scoped_log_{&world_logger(), LogLevel::warning};
+    PerfEventCounters counters;
+    if (!counters)
+    {
+        EXPECT_FALSE(scoped_log_.empty()) << scoped_log_;
+        auto result = counters.stop();
+        EXPECT_EQ(0, result.cycles);
+        EXPECT_EQ(0, result.cache_misses);
+        GTEST_SKIP() << "Hardware counters are unavailable";
+    }
+
+    EXPECT_GE(counters.num_threads(), 1);
+
+    counters.start();
+    std::vector<double> values(1 << 16, 1.0);
+    double total = 0;
+    for (double v : values)
+    {
+        total += v;
+    }
+    auto result = counters.stop();
+    EXPECT_EQ(values.size(), total);
+    EXPECT_GT(result.cycles, 0);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
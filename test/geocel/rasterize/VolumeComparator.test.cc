@@ -0,0 +1,159 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file geocel/rasterize/VolumeComparator.test.cc
+//---------------------------------------------------------------------------//
+#include "geocel/rasterize/VolumeComparator.hh"
+
+#include <string>
+#include <vector>
+
+#include "geocel/rasterize/Image.hh"
+#include "geocel/rasterize/ImageLineView.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class VolumeComparatorTest : public ::celeritas::test::Test
+{
+  protected:
+    using VecLabel = std::vector<Label>;
+
+    void SetUp() override {}
+
+    // Reference and tested geometries have different volume orderings
+    VolumeComparator make_comparator(size_type max_mismatches) const
+    {
+        return VolumeComparator{VecLabel{"world", "box", "sphere"},
+                                VecLabel{"sphere", "world", "box"},
+                                max_mismatches};
+    }
+};
+
+TEST_F(VolumeComparatorTest, points)
+{
+    auto compare = this->make_comparator(1);
+
+    std::vector<Real3> pos{{0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {3, 0, 0}};
+    std::vector<int> expected{0, 1, 2, -1};
+    std::vector<int> actual{1, 2, 0, -1};
+
+    VolumeComparison result;
+    compare(make_span(pos), make_span(expected), make_span(actual), &result);
+    EXPECT_EQ(4, result.num_samples);
+    EXPECT_EQ(0, result.num_mismatched);
+    EXPECT_TRUE(result);
+
+    // Swap box and world, and put the sphere outside
+    actual = {2, 1, -1, -1};
+    compare(make_span(pos), make_span(expected), make_span(actual), &result);
+    EXPECT_EQ(8, result.num_samples);
+    EXPECT_EQ(3, result.num_mismatched);
+    EXPECT_FALSE(result);
+    ASSERT_EQ(1, result.mismatches.size());
+    EXPECT_VEC_SOFT_EQ((Real3{0, 0, 0}), result.mismatches[0].pos);
+    EXPECT_EQ("world", result.mismatches[0].expected);
+    EXPECT_EQ("box", result.mismatches[0].actual);
+}
+
+TEST_F(VolumeComparatorTest, missing)
+{
+    VolumeComparator compare{
+        VecLabel{"world", "detector"}, VecLabel{"world", "det"}, 10};
+
+    std::vector<Real3> pos{{0, 0, 0}, {1, 0, 0}};
+    std::vector<int> expected{0, 1};
+    std::vector<int> actual{0, 1};
+
+    VolumeComparison result;
+    compare(make_span(pos), make_span(expected), make_span(actual), &result);
+    EXPECT_EQ(1, result.num_mismatched);
+    ASSERT_EQ(1, result.mismatches.size());
+    EXPECT_EQ("detector", result.mismatches[0].expected);
+    EXPECT_EQ("det", result.mismatches[0].actual);
+}
+
+TEST_F(VolumeComparatorTest, labels)
+{
+    // Reflected volumes share a name but not an extension; replicas share
+    // both, and the tested geometry drops the extension of "box"
+    VolumeComparator compare{VecLabel{{"world", ""},
+                                      {"arm", "0"},
+                                      {"arm", "refl"},
+                                      {"rep", ""},
+                                      {"rep", ""},
+                                      {"box", "1"}},
+                             VecLabel{{"box", ""},
+                                      {"arm", "refl"},
+                                      {"arm", "0"},
+                                      {"rep", ""},
+                                      {"world", ""}},
+                             10};
+    std::vector<std::string> unmatched;
+    for (auto const& label : compare.unmatched())
+    {
+        unmatched.push_back(to_string(label));
+    }
+    static char const* const expected_unmatched[] = {"rep", "rep"};
+    EXPECT_VEC_EQ(expected_unmatched, unmatched);
+
+    std::vector<Real3> pos(5, Real3{0, 0, 0});
+    std::vector<int> expected{0, 1, 2, 3, 5};
+    std::vector<int> actual{4, 2, 1, 3, 0};
+
+    VolumeComparison result;
+    compare(make_span(pos), make_span(expected), make_span(actual), &result);
+    EXPECT_EQ(1, result.num_mismatched);
+    ASSERT_EQ(1, result.mismatches.size());
+    EXPECT_EQ("rep", result.mismatches[0].expected);
+    EXPECT_EQ("rep", result.mismatches[0].actual);
+}
+
+TEST_F(VolumeComparatorTest, images)
+{
+    ImageInput inp;
+    inp.upper_right = {4, 2, 0};
+    inp.vertical_pixels = 2;
+
+    auto params = std::make_shared<ImageParams>(inp);
+    ASSERT_EQ(8, params->num_pixels());
+
+    Image<MemSpace::host> expected(params);
+    Image<MemSpace::host> actual(params);
+    for (auto row : range(2u))
+    {
+        ImageLineView exp_line{params->host_ref(), expected.ref(), row};
+        ImageLineView act_line{params->host_ref(), actual.ref(), row};
+        for (auto col : range(4u))
+        {
+            exp_line.set_pixel(col, col < 3 ? 0 : 2);
+            act_line.set_pixel(col, col < 3 ? 1 : 0);
+        }
+    }
+    {
+        // Bottom right pixel is in the box instead of the sphere
+        ImageLineView act_line{params->host_ref(), actual.ref(), 1};
+        act_line.set_pixel(3, 2);
+    }
+
+    auto compare = this->make_comparator(10);
+    VolumeComparison result;
+    compare(expected, actual, &result);
+    EXPECT_EQ(8, result.num_samples);
+    EXPECT_EQ(1, result.num_mismatched);
+    ASSERT_EQ(1, result.mismatches.size());
+    EXPECT_VEC_SOFT_EQ((Real3{3.5, 0.5, 0}), result.mismatches[0].pos);
+    EXPECT_EQ("sphere", result.mismatches[0].expected);
+    EXPECT_EQ("box", result.mismatches[0].actual);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -5,6 +5,7 @@
 //---------------------------------------------------------------------------//
 //! \file orange/Orange.test.cc
 //---------------------------------------------------------------------------//
+#include <cmath>
 #include <string>
 
 #include "corecel/Config.hh"
@@ -144,6 +145,7 @@ class TwoVolumeTest : public OrangeTest
 TEST_F(TwoVolumeTest, params)
 {
     OrangeParams const& geo = this->params();
+    EXPECT_FALSE(this->host_params().scalars.cache_navigation);
 
     EXPECT_EQ(2, geo.volumes().size());
     EXPECT_EQ(1, geo.surfaces().size());
@@ -511,6 +513,66 @@ TEST_F(TwoVolumeTest, intersect_limited)
     EXPECT_FALSE(next.boundary);
 }
 
+//---------------------------------------------------------------------------//
+class CachedTwoVolumeTest : public OrangeTest
+{
+    void SetUp() override
+    {
+        TwoVolInput geo_inp;
+        geo_inp.radius = 1.5;
+        geo_inp.cache_navigation = true;
+        this->build_geometry(geo_inp);
+    }
+};
+
+TEST_F(CachedTwoVolumeTest, navigation)
+{
+    EXPECT_TRUE(this->host_params().scalars.cache_navigation);
+    auto geo = this->make_geo_track_view();
+
+    geo = Initializer_t{{0.5, 0, 0}, {0, 0, 1}};
+    EXPECT_SOFT_EQ(1.0, geo.find_safety(0.5));
+
+    auto next = geo.find_next_step();
+    EXPECT_SOFT_EQ(sqrt_two, next.distance);
+    EXPECT_TRUE(next.boundary);
+
+    // Short physics-limited steps reuse the distance to boundary
+    geo.move_internal(0.25);
+    next = geo.find_next_step(0.5);
+    EXPECT_SOFT_EQ(0.5, next.distance);
+    EXPECT_FALSE(next.boundary);
+    next = geo.find_next_step(2.0);
+    EXPECT_SOFT_EQ(sqrt_two - 0.25, next.distance);
+    EXPECT_TRUE(next.boundary);
+    next = geo.find_next_step();
+    EXPECT_SOFT_EQ(sqrt_two - 0.25, next.distance);
+    EXPECT_TRUE(next.boundary);
+
+    // Cached safety sphere is conservative but sufficient
+    EXPECT_SOFT_EQ(0.75, geo.find_safety(0.5));
+    // Requested radius is larger than the cached sphere: recalculate
+    real_type const safety = 1.5 - std::hypot(real_type{0.5}, real_type{0.25});
+    EXPECT_SOFT_EQ(safety, geo.find_safety(0.8));
+    EXPECT_SOFT_EQ(safety, geo.find_safety(0.5));
+    // Unlimited safety is always recalculated
+    EXPECT_SOFT_EQ(safety, geo.find_safety());
+
+    // Changing direction invalidates the distance
+    geo.set_dir({1, 0, 0});
+    next = geo.find_next_step();
+    EXPECT_SOFT_EQ(std::sqrt(ipow<2>(1.5) - ipow<2>(0.25)) - 0.5,
+                   next.distance);
+    EXPECT_TRUE(next.boundary);
+
+    // Crossing the boundary invalidates the safety
+    geo.move_to_boundary();
+    geo.cross_boundary();
+    EXPECT_EQ(VolumeId{0}, geo.volume_id());
+    geo.move_internal({2, 0, 0});
+    EXPECT_SOFT_EQ(0.5, geo.find_safety(0.1));
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
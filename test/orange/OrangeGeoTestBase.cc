@@ -178,7 +178,10 @@ void OrangeGeoTestBase::build_geometry(TwoVolInput inp)
         return result;
     }();
 
-    return this->build_geometry(std::move(input));
+    auto orange_input = to_input(std::move(input));
+    orange_input.cache_navigation = inp.cache_navigation;
+    params_ = std::make_unique<Params>(std::move(orange_input));
+    ASSERT_TRUE(this->geometry());
 }
 
 //---------------------------------------------------------------------------//
@@ -56,6 +56,7 @@ class OrangeGeoTestBase : public OrangeTestBase
     struct TwoVolInput
     {
         real_type radius = 1;
+        bool cache_navigation = false;
     };
     //!@}
 
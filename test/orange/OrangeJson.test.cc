@@ -158,7 +158,7 @@ TEST_F(UniversesTest, TEST_IF_CELERITAS_DOUBLE(output))
     EXPECT_EQ("orange", out.label());
 
     EXPECT_JSON_EQ(
-        R"json({"_category":"internal","_label":"orange","scalars":{"max_depth":3,"max_faces":14,"max_intersections":14,"max_logic_depth":3,"tol":{"abs":1.5e-08,"rel":1.5e-08}},"sizes":{"bih":{"bboxes":12,"inner_nodes":6,"leaf_nodes":9,"local_volume_ids":12},"connectivity_records":25,"daughters":3,"local_surface_ids":55,"local_volume_ids":21,"logic_ints":171,"real_ids":25,"reals":24,"rect_arrays":0,"simple_units":3,"surface_types":25,"transforms":3,"universe_indices":3,"universe_types":3,"volume_records":12}})json",
+        R"json({"_category":"internal","_label":"orange","scalars":{"max_depth":3,"max_faces":14,"max_intersections":14,"max_logic_depth":3,"tol":{"abs":1.5e-08,"rel":1.5e-08}},"sizes":{"bih":{"bboxes":12,"inner_nodes":6,"leaf_nodes":9,"local_volume_ids":12},"connectivity_records":25,"daughters":3,"local_surface_ids":55,"local_volume_ids":21,"logic_ints":162,"real_ids":25,"reals":24,"rect_arrays":0,"simple_units":3,"surface_types":25,"transforms":3,"universe_indices":3,"universe_types":3,"volume_records":12,"voxel_grids":0,"voxels":0}})json",
         to_string(out));
 }
 
@@ -502,6 +502,92 @@ TEST_F(RectArrayTest, tracking)
 
 //---------------------------------------------------------------------------//
 
+class VoxelGridTest : public JsonOrangeTest
+{
+    std::string geometry_basename() const final { return "voxel-grid"; }
+};
+
+TEST_F(VoxelGridTest, params)
+{
+    OrangeParams const& geo = this->params();
+    EXPECT_EQ(6, geo.volumes().size());
+    EXPECT_EQ(25, geo.surfaces().size());
+    EXPECT_EQ(2, geo.max_depth());
+
+    EXPECT_EQ(VolumeId{3}, geo.volumes().find_unique("water"));
+    EXPECT_EQ(SurfaceId{13}, geo.surfaces().find_unique("{x,1}"));
+}
+
+TEST_F(VoxelGridTest, tracking)
+{
+    {
+        SCOPED_TRACE("along x");
+        auto result = this->track({-9, -3, -1}, {1, 0, 0});
+        static char const* const expected_volumes[]
+            = {"world", "water", "bone", "lung", "world"};
+        EXPECT_VEC_EQ(expected_volumes, result.volumes);
+        static real_type const expected_distances[] = {5, 4, 2, 2, 6};
+        EXPECT_VEC_SOFT_EQ(expected_distances, result.distances);
+        static real_type const expected_hw_safety[] = {1, 0, 1, 1, 1};
+        EXPECT_VEC_SOFT_EQ(expected_hw_safety, result.halfway_safeties);
+    }
+    {
+        SCOPED_TRACE("along y");
+        auto result = this->track({-3, -9, 1}, {0, 1, 0});
+        static char const* const expected_volumes[]
+            = {"world", "water", "bone", "world"};
+        EXPECT_VEC_EQ(expected_volumes, result.volumes);
+        static real_type const expected_distances[] = {5, 6, 2, 6};
+        EXPECT_VEC_SOFT_EQ(expected_distances, result.distances);
+    }
+    {
+        SCOPED_TRACE("diagonal");
+        auto result = this->track({-9, -8, -0.5}, {1, 1, 0.125});
+        static char const* const expected_volumes[]
+            = {"world", "water", "bone", "lung", "world"};
+        EXPECT_VEC_EQ(expected_volumes, result.volumes);
+        static real_type const expected_distances[] = {7.0986354322503,
+                                                       5.6789083458003,
+                                                       2.8394541729001,
+                                                       1.4197270864501,
+                                                       8.5183625187004};
+        EXPECT_VEC_SOFT_EQ(expected_distances, result.distances);
+        static real_type const expected_hw_safety[]
+            = {1.5, 0, 0, 0.5, 0.625};
+        EXPECT_VEC_SOFT_EQ(expected_hw_safety, result.halfway_safeties);
+    }
+}
+
+TEST_F(VoxelGridTest, crossing)
+{
+    auto geo = this->make_geo_track_view();
+    geo = Initializer_t{{-3, -3, -1}, {1, 0, 0}};
+    EXPECT_EQ("water", this->volume_name(geo));
+
+    // Skip the second water voxel
+    auto next = geo.find_next_step();
+    EXPECT_SOFT_EQ(3, next.distance);
+    geo.move_to_boundary();
+    EXPECT_EQ("{x,2}", this->surface_name(geo));
+    geo.cross_boundary();
+    EXPECT_EQ("bone", this->volume_name(geo));
+    EXPECT_VEC_SOFT_EQ(Real3({0, -3, -1}), geo.pos());
+
+    // Reverse direction on the boundary
+    geo.set_dir({-1, 0, 0});
+    next = geo.find_next_step();
+    EXPECT_SOFT_EQ(0, next.distance);
+
+    // Limited step inside a run of identical voxels
+    geo = Initializer_t{{-3, -3, -1}, {1, 0, 0}};
+    next = geo.find_next_step(real_type{1.5});
+    EXPECT_SOFT_EQ(1.5, next.distance);
+    EXPECT_FALSE(next.boundary);
+    EXPECT_SOFT_EQ(1, geo.find_safety());
+}
+
+//---------------------------------------------------------------------------//
+
 class NestedRectArraysTest : public JsonOrangeTest
 {
     std::string geometry_basename() const final
@@ -615,7 +701,7 @@ TEST_F(HexArrayTest, TEST_IF_CELERITAS_DOUBLE(output))
     EXPECT_EQ("orange", out.label());
 
     EXPECT_JSON_EQ(
-        R"json({"_category":"internal","_label":"orange","scalars":{"max_depth":3,"max_faces":9,"max_intersections":10,"max_logic_depth":3,"tol":{"abs":1.5e-08,"rel":1.5e-08}},"sizes":{"bih":{"bboxes":58,"inner_nodes":49,"leaf_nodes":53,"local_volume_ids":58},"connectivity_records":53,"daughters":51,"local_surface_ids":191,"local_volume_ids":348,"logic_ints":585,"real_ids":53,"reals":272,"rect_arrays":0,"simple_units":4,"surface_types":53,"transforms":51,"universe_indices":4,"universe_types":4,"volume_records":58}})json",
+        R"json({"_category":"internal","_label":"orange","scalars":{"max_depth":3,"max_faces":9,"max_intersections":10,"max_logic_depth":3,"tol":{"abs":1.5e-08,"rel":1.5e-08}},"sizes":{"bih":{"bboxes":58,"inner_nodes":49,"leaf_nodes":53,"local_volume_ids":58},"connectivity_records":53,"daughters":51,"local_surface_ids":191,"local_volume_ids":348,"logic_ints":761,"real_ids":53,"reals":272,"rect_arrays":0,"simple_units":4,"surface_types":53,"transforms":51,"universe_indices":4,"universe_types":4,"volume_records":58,"voxel_grids":0,"voxels":0}})json",
         to_string(out));
 }
 
@@ -660,6 +746,18 @@ TEST_F(TestEM3Test, safety)
     EXPECT_SOFT_EQ(0.01, geo.find_safety());
 }
 
+// All units are built from axis-aligned planes
+TEST_F(TestEM3Test, surface_type_set)
+{
+    auto const& units = this->host_params().simple_units;
+    ASSERT_FALSE(units.empty());
+    for (auto su_id : range(SimpleUnitId{units.size()}))
+    {
+        EXPECT_EQ(SurfaceTypeSet::plane_aligned, units[su_id].surfaces.type_set)
+            << "unit " << su_id.get();
+    }
+}
+
 //---------------------------------------------------------------------------//
 
 TEST_F(InputBuilderTest, globalspheres)
@@ -677,7 +775,7 @@ TEST_F(InputBuilderTest, globalspheres)
 
     OrangeParamsOutput out(this->geometry());
     EXPECT_JSON_EQ(
-        R"json({"_category":"internal","_label":"orange","scalars":{"max_depth":1,"max_faces":2,"max_intersections":4,"max_logic_depth":2,"tol":{"abs":1e-05,"rel":1e-05}},"sizes":{"bih":{"bboxes":3,"inner_nodes":0,"leaf_nodes":1,"local_volume_ids":3},"connectivity_records":2,"daughters":0,"local_surface_ids":4,"local_volume_ids":4,"logic_ints":7,"real_ids":2,"reals":2,"rect_arrays":0,"simple_units":1,"surface_types":2,"transforms":0,"universe_indices":1,"universe_types":1,"volume_records":3}})json",
+        R"json({"_category":"internal","_label":"orange","scalars":{"max_depth":1,"max_faces":2,"max_intersections":4,"max_logic_depth":2,"tol":{"abs":1e-05,"rel":1e-05}},"sizes":{"bih":{"bboxes":3,"inner_nodes":0,"leaf_nodes":1,"local_volume_ids":3},"connectivity_records":2,"daughters":0,"local_surface_ids":4,"local_volume_ids":4,"logic_ints":7,"real_ids":2,"reals":2,"rect_arrays":0,"simple_units":1,"surface_types":2,"transforms":0,"universe_indices":1,"universe_types":1,"volume_records":3,"voxel_grids":0,"voxels":0}})json",
         to_string(out));
 }
 
@@ -707,7 +805,7 @@ TEST_F(InputBuilderTest, bgspheres)
 
     OrangeParamsOutput out(this->geometry());
     EXPECT_JSON_EQ(
-        R"json({"_category":"internal","_label":"orange","scalars":{"max_depth":1,"max_faces":3,"max_intersections":6,"max_logic_depth":1,"tol":{"abs":1e-05,"rel":1e-05}},"sizes":{"bih":{"bboxes":4,"inner_nodes":1,"leaf_nodes":2,"local_volume_ids":4},"connectivity_records":3,"daughters":0,"local_surface_ids":6,"local_volume_ids":3,"logic_ints":5,"real_ids":3,"reals":9,"rect_arrays":0,"simple_units":1,"surface_types":3,"transforms":0,"universe_indices":1,"universe_types":1,"volume_records":4}})json",
+        R"json({"_category":"internal","_label":"orange","scalars":{"max_depth":1,"max_faces":3,"max_intersections":6,"max_logic_depth":1,"tol":{"abs":1e-05,"rel":1e-05}},"sizes":{"bih":{"bboxes":4,"inner_nodes":1,"leaf_nodes":2,"local_volume_ids":4},"connectivity_records":3,"daughters":0,"local_surface_ids":6,"local_volume_ids":3,"logic_ints":3,"real_ids":3,"reals":9,"rect_arrays":0,"simple_units":1,"surface_types":3,"transforms":0,"universe_indices":1,"universe_types":1,"volume_records":4,"voxel_grids":0,"voxels":0}})json",
         to_string(out));
 }
 
@@ -814,7 +912,7 @@ TEST_F(InputBuilderTest, hierarchy)
 
     OrangeParamsOutput out(this->geometry());
     EXPECT_JSON_EQ(
-        R"json({"_category":"internal","_label":"orange","scalars":{"max_depth":3,"max_faces":8,"max_intersections":14,"max_logic_depth":3,"tol":{"abs":1e-05,"rel":1e-05}},"sizes":{"bih":{"bboxes":24,"inner_nodes":9,"leaf_nodes":16,"local_volume_ids":24},"connectivity_records":13,"daughters":6,"local_surface_ids":20,"local_volume_ids":18,"logic_ints":31,"real_ids":13,"reals":46,"rect_arrays":0,"simple_units":7,"surface_types":13,"transforms":6,"universe_indices":7,"universe_types":7,"volume_records":24}})json",
+        R"json({"_category":"internal","_label":"orange","scalars":{"max_depth":3,"max_faces":8,"max_intersections":14,"max_logic_depth":3,"tol":{"abs":1e-05,"rel":1e-05}},"sizes":{"bih":{"bboxes":24,"inner_nodes":9,"leaf_nodes":16,"local_volume_ids":24},"connectivity_records":13,"daughters":6,"local_surface_ids":20,"local_volume_ids":18,"logic_ints":29,"real_ids":13,"reals":46,"rect_arrays":0,"simple_units":7,"surface_types":13,"transforms":4,"universe_indices":7,"universe_types":7,"volume_records":24,"voxel_grids":0,"voxels":0}})json",
         to_string(out));
 }
 
@@ -823,7 +921,7 @@ TEST_F(InputBuilderTest, incomplete_bb)
 {
     OrangeParamsOutput out(this->geometry());
     EXPECT_JSON_EQ(
-        R"json({"_category":"internal","_label":"orange","scalars":{"max_depth":2,"max_faces":6,"max_intersections":6,"max_logic_depth":2,"tol":{"abs":1e-05,"rel":1e-05}},"sizes":{"bih":{"bboxes":6,"inner_nodes":1,"leaf_nodes":3,"local_volume_ids":6},"connectivity_records":8,"daughters":1,"local_surface_ids":10,"local_volume_ids":4,"logic_ints":38,"real_ids":8,"reals":26,"rect_arrays":0,"simple_units":2,"surface_types":8,"transforms":1,"universe_indices":2,"universe_types":2,"volume_records":6}})json",
+        R"json({"_category":"internal","_label":"orange","scalars":{"max_depth":2,"max_faces":6,"max_intersections":6,"max_logic_depth":2,"tol":{"abs":1e-05,"rel":1e-05}},"sizes":{"bih":{"bboxes":6,"inner_nodes":1,"leaf_nodes":3,"local_volume_ids":6},"connectivity_records":8,"daughters":1,"local_surface_ids":10,"local_volume_ids":4,"logic_ints":35,"real_ids":8,"reals":26,"rect_arrays":0,"simple_units":2,"surface_types":8,"transforms":1,"universe_indices":2,"universe_types":2,"volume_records":6,"voxel_grids":0,"voxels":0}})json",
         to_string(out));
 }
 
@@ -0,0 +1,71 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/VoxelGridIO.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/VoxelGridIO.hh"
+
+#include <sstream>
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class VoxelGridIOTest : public ::celeritas::test::Test
+{
+  protected:
+    void SetUp() override
+    {
+        inp_.dims = {3, 2, 2};
+        inp_.origin = {-1.5, -1, 0};
+        inp_.width = {1, 1, 0.5};
+        inp_.voxels = {0, 0, 0, 0, 1, 1, 1, 1, 2, 0, 0, 0};
+        inp_.volume_labels = {Label{"air"}, Label{"water"}, Label{"bone"}};
+        inp_.label = Label{"phantom"};
+        ASSERT_TRUE(inp_);
+    }
+
+    VoxelGridInput inp_;
+};
+
+TEST_F(VoxelGridIOTest, round_trip)
+{
+    std::stringstream ss;
+    write_voxel_grid(ss, inp_);
+
+    // Runs of identical voxels are compressed
+    EXPECT_EQ(143, ss.str().size());
+
+    auto result = read_voxel_grid(ss);
+    EXPECT_EQ(inp_.dims, result.dims);
+    EXPECT_VEC_SOFT_EQ(inp_.origin, result.origin);
+    EXPECT_VEC_SOFT_EQ(inp_.width, result.width);
+    EXPECT_VEC_EQ(inp_.voxels, result.voxels);
+    EXPECT_EQ(inp_.volume_labels, result.volume_labels);
+    EXPECT_EQ(inp_.label, result.label);
+}
+
+TEST_F(VoxelGridIOTest, errors)
+{
+    std::stringstream ss;
+    write_voxel_grid(ss, inp_);
+    std::string const data = ss.str();
+
+    // Truncated file
+    std::istringstream truncated(data.substr(0, data.size() - 3));
+    EXPECT_THROW(read_voxel_grid(truncated), RuntimeError);
+
+    // Not a voxel file
+    std::istringstream garbage("ORANGE is a geometry");
+    EXPECT_THROW(read_voxel_grid(garbage), RuntimeError);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,139 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/InfixLogicBuilder.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/detail/InfixLogicBuilder.hh"
+
+#include "corecel/cont/Range.hh"
+#include "orange/detail/OrangeInputIOImpl.json.hh"
+#include "orange/univ/detail/InfixEvaluator.hh"
+#include "orange/univ/detail/LogicEvaluator.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class InfixLogicBuilderTest : public ::celeritas::test::Test
+{
+  protected:
+    using VecLogic = std::vector<logic_int>;
+    using VecSize = std::vector<size_type>;
+
+    //! Compile a postfix string and return the infix string
+    std::string compile(std::string const& postfix) const
+    {
+        InfixLogicBuilder build{make_span(costs)};
+        return logic_to_string(build(make_span(string_to_logic(postfix))));
+    }
+
+    //! Check that the infix logic matches the postfix for all senses
+    void check_equivalent(std::string const& postfix) const
+    {
+        auto post_logic = string_to_logic(postfix);
+        auto in_logic = InfixLogicBuilder{make_span(costs)}(
+            make_span(post_logic));
+
+        LogicEvaluator eval_postfix(make_span(post_logic));
+        std::vector<Sense> senses(costs.size());
+        for (auto mask : range(1u << costs.size()))
+        {
+            for (auto i : range(senses.size()))
+            {
+                senses[i] = static_cast<Sense>((mask >> i) & 1u);
+            }
+            bool expected = eval_postfix(make_span(senses));
+            bool actual = false;
+            if (!in_logic.empty())
+            {
+                actual = InfixEvaluator(make_span(in_logic))([&](FaceId f) {
+                    CELER_EXPECT(f < senses.size());
+                    return static_cast<bool>(senses[f.unchecked_get()]);
+                });
+            }
+            EXPECT_EQ(expected, actual)
+                << "for senses " << mask << " with logic '" << postfix
+                << "' -> '" << logic_to_string(in_logic) << "'";
+        }
+    }
+
+    VecSize costs;
+};
+
+TEST_F(InfixLogicBuilderTest, reorder)
+{
+    costs = {6, 1, 3, 1};
+
+    EXPECT_EQ("1 & 2 & 0", this->compile("0 1 & 2 &"));
+    EXPECT_EQ("1 | 0", this->compile("0 1 |"));
+    EXPECT_EQ("3 & ( 1 | 2 ) & 0", this->compile("0 1 2 | & 3 &"));
+    EXPECT_EQ("1 | ( 3 & 2 ) | ( 2 & 0 )",
+              this->compile("0 2 & 1 | 2 3 & |"));
+}
+
+TEST_F(InfixLogicBuilderTest, demorgan)
+{
+    costs = {6, 1, 3};
+
+    EXPECT_EQ("~ 1 | ~ 0", this->compile("0 1 & ~"));
+    EXPECT_EQ("~ 1 & ( ~ 2 | 0 )", this->compile("1 2 0 ~ & | ~"));
+    EXPECT_EQ("1 & 0", this->compile("0 ~ 1 ~ | ~"));
+}
+
+TEST_F(InfixLogicBuilderTest, simplify)
+{
+    costs = {1, 2};
+
+    EXPECT_EQ("0", this->compile("0 0 &"));
+    EXPECT_EQ("0", this->compile("0 ~ ~"));
+    EXPECT_EQ("0", this->compile("0 * &"));
+    EXPECT_EQ("*", this->compile("*"));
+    EXPECT_EQ("*", this->compile("0 0 ~ |"));
+    EXPECT_EQ("*", this->compile("1 * |"));
+    EXPECT_EQ("0 & 1", this->compile("0 1 & 1 &"));
+
+    // Unsatisfiable logic
+    EXPECT_EQ("", this->compile("* ~"));
+    EXPECT_EQ("", this->compile("0 0 ~ &"));
+    EXPECT_EQ("", this->compile("1 * ~ &"));
+}
+
+TEST_F(InfixLogicBuilderTest, equivalence)
+{
+    costs = {5, 1, 3, 1, 8};
+
+    for (char const* postfix : {
+             "0 1 & 2 ~ & 3 &",
+             "0 1 | 2 & ~ 3 4 ~ | &",
+             "0 ~ 1 2 & | 3 4 | ~ &",
+             "0 1 ~ & 2 3 & | 4 ~ | ~",
+             "* 0 & 1 2 ~ | 3 ~ & 4 | &",
+             "0 1 2 & & 3 4 & & 0 | ~",
+         })
+    {
+        this->check_equivalent(postfix);
+    }
+}
+
+TEST_F(InfixLogicBuilderTest, sense_cost)
+{
+    EXPECT_LT(calc_sense_cost(SurfaceType::px),
+              calc_sense_cost(SurfaceType::czc));
+    EXPECT_LT(calc_sense_cost(SurfaceType::czc),
+              calc_sense_cost(SurfaceType::s));
+    EXPECT_LT(calc_sense_cost(SurfaceType::s),
+              calc_sense_cost(SurfaceType::gq));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
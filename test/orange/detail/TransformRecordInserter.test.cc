@@ -0,0 +1,111 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/TransformRecordInserter.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/detail/TransformRecordInserter.hh"
+
+#include <cmath>
+
+#include "corecel/data/Ref.hh"
+#include "orange/MatrixUtils.hh"
+#include "orange/transform/TransformVisitor.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+class TransformRecordInserterTest : public ::celeritas::test::Test
+{
+  protected:
+    template<class T>
+    using Items = Collection<T, Ownership::value, MemSpace::host>;
+
+    TransformType type(TransformId id) const
+    {
+        CELER_EXPECT(id < transforms_.size());
+        return transforms_[id].type;
+    }
+
+    Items<TransformRecord> transforms_;
+    Items<real_type> reals_;
+};
+
+TEST_F(TransformRecordInserterTest, compress)
+{
+    TransformRecordInserter insert(&transforms_, &reals_);
+
+    auto quarter_r = make_rotation(Axis::z, Turn{0.25});
+    // Make sure the rotation is exact
+    for (auto& row : quarter_r)
+    {
+        for (auto& v : row)
+        {
+            v = std::round(v);
+        }
+    }
+
+    auto id = insert(NoTransformation{});
+    EXPECT_EQ(TransformType::no_transformation, this->type(id));
+    id = insert(Translation{{0, 0, 0}});
+    EXPECT_EQ(TransformType::no_transformation, this->type(id));
+    id = insert(Transformation{});
+    EXPECT_EQ(TransformType::no_transformation, this->type(id));
+    id = insert(Transformation{Transformation{}.rotation(), {1, 2, 3}});
+    EXPECT_EQ(TransformType::translation, this->type(id));
+    id = insert(Transformation{quarter_r, {0, 0, 0}});
+    EXPECT_EQ(TransformType::signed_permutation, this->type(id));
+    id = insert(Transformation{quarter_r, {1, 0, 0}});
+    EXPECT_EQ(TransformType::transformation, this->type(id));
+    id = insert(Transformation{make_rotation(Axis::z, Turn{0.1}), {0, 0, 0}});
+    EXPECT_EQ(TransformType::transformation, this->type(id));
+
+    // Check that the compressed permutation is correct
+    Collection<TransformRecord, Ownership::const_reference, MemSpace::host>
+        transforms_ref{transforms_};
+    Collection<real_type, Ownership::const_reference, MemSpace::host>
+        reals_ref{reals_};
+    TransformVisitor visit_transform{transforms_ref, reals_ref};
+    Real3 const pos{1, 2, 3};
+    auto perm_id = insert(Transformation{quarter_r, {0, 0, 0}});
+    EXPECT_VEC_SOFT_EQ(
+        Transformation(quarter_r, {0, 0, 0}).transform_up(pos),
+        visit_transform([&pos](auto&& t) { return t.transform_up(pos); },
+                        perm_id));
+}
+
+TEST_F(TransformRecordInserterTest, dedupe)
+{
+    TransformRecordInserter insert(&transforms_, &reals_);
+
+    auto rot = make_rotation(Axis::x, Turn{0.125});
+
+    auto null_id = insert(NoTransformation{});
+    auto tl_a = insert(Translation{{1, 2, 3}});
+    auto tl_b = insert(Translation{{1, 2, 4}});
+    auto tf_a = insert(Transformation{rot, {1, 2, 3}});
+    EXPECT_EQ(4, transforms_.size());
+
+    EXPECT_EQ(null_id, insert(NoTransformation{}));
+    EXPECT_EQ(null_id, insert(Translation{{0, 0, 0}}));
+    EXPECT_EQ(tl_a, insert(Translation{{1, 2, 3}}));
+    EXPECT_EQ(tl_b, insert(Translation{{1, 2, 4}}));
+    EXPECT_EQ(tl_a, insert(Transformation{Translation{{1, 2, 3}}}));
+    EXPECT_EQ(tf_a, insert(Transformation{rot, {1, 2, 3}}));
+    EXPECT_EQ(4, transforms_.size());
+
+    EXPECT_NE(tf_a, insert(Transformation{rot, {1, 2, 4}}));
+    EXPECT_EQ(5, transforms_.size());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
@@ -189,6 +189,49 @@ TEST_F(SurfaceActionTest, surface_traits_visitor)
     }
 }
 
+TEST_F(SurfaceActionTest, surface_type_set)
+{
+    auto get_surface_type = [](auto surf_traits) -> SurfaceType {
+        using Surface = typename decltype(surf_traits)::type;
+        return Surface::surface_type();
+    };
+
+    // Check that restricted lists dispatch correctly
+    for (auto st : range(SurfaceType::size_))
+    {
+        if (st == SurfaceType::inv)
+        {
+            continue;
+        }
+        auto sts = to_surface_type_set(st);
+        SurfaceType actual_st = visit_surface_type_set(
+            [&](auto sts_traits) {
+                using Types = typename decltype(sts_traits)::types;
+                return visit_surface_type(get_surface_type, st, Types{});
+            },
+            sts);
+        EXPECT_EQ(st, actual_st) << to_cstring(sts);
+    }
+    EXPECT_EQ(SurfaceTypeSet::plane_aligned,
+              to_surface_type_set(SurfaceType::py));
+    EXPECT_EQ(SurfaceTypeSet::cyl_centered,
+              to_surface_type_set(SurfaceType::czc));
+    EXPECT_EQ(SurfaceTypeSet::all, to_surface_type_set(SurfaceType::cz));
+
+    // This unit has all surface types
+    auto const& surfaces
+        = this->host_params().simple_units[SimpleUnitId{0}].surfaces;
+    EXPECT_EQ(SurfaceTypeSet::all, surfaces.type_set);
+
+    // Visiting with a restricted list gives the same result
+    LocalSurfaceVisitor visit(this->host_params(), SimpleUnitId{0});
+    using PlaneTypes
+        = SurfaceTypeSetTraits<SurfaceTypeSet::plane_aligned>::types;
+    using CylTypes = SurfaceTypeSetTraits<SurfaceTypeSet::cyl_centered>::types;
+    EXPECT_EQ("Plane: y=2", visit(ToString{}, LocalSurfaceId{1}, PlaneTypes{}));
+    EXPECT_EQ("Cyl z: r=7", visit(ToString{}, LocalSurfaceId{5}, CylTypes{}));
+}
+
 TEST_F(SurfaceActionTest, string)
 {
     // Create functor to visit the local surface
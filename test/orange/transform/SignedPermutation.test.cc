@@ -7,6 +7,9 @@
 //---------------------------------------------------------------------------//
 #include "orange/transform/SignedPermutation.hh"
 
+#include "orange/MatrixUtils.hh"
+#include "orange/transform/Transformation.hh"
+
 #include "celeritas_test.hh"
 
 namespace celeritas
@@ -122,6 +125,47 @@ TEST_F(SignedPermutationTest, rotate)
     }
 }
 
+TEST_F(SignedPermutationTest, inverse)
+{
+    auto inv = sp_zx.calc_inverse();
+    EXPECT_EQ("+z,-x,-y", to_string(inv.permutation()));
+    Real3 const daughter{1, 2, 3};
+    EXPECT_VEC_EQ(sp_zx.rotate_down(daughter), inv.rotate_up(daughter));
+    EXPECT_VEC_EQ(daughter, inv.transform_up(sp_zx.transform_up(daughter)));
+}
+
+TEST_F(SignedPermutationTest, from_matrix)
+{
+    {
+        SCOPED_TRACE("exact");
+        auto sp = try_make_permutation(Transformation{sp_zx}.rotation());
+        ASSERT_TRUE(sp);
+        EXPECT_EQ(sp_zx, *sp);
+    }
+    {
+        SCOPED_TRACE("identity");
+        auto sp = try_make_permutation(Transformation{}.rotation());
+        ASSERT_TRUE(sp);
+        EXPECT_EQ(SignedPermutation{}, *sp);
+    }
+    {
+        SCOPED_TRACE("inexact");
+        auto r = make_rotation(Axis::x, Turn{0.25});
+        r[1][1] = 1e-16;
+        EXPECT_FALSE(try_make_permutation(r));
+    }
+    {
+        SCOPED_TRACE("general rotation");
+        EXPECT_FALSE(try_make_permutation(make_rotation(Axis::z, Turn{0.1})));
+    }
+    {
+        SCOPED_TRACE("reflection");
+        auto r = Transformation{}.rotation();
+        r[2][2] = -1;
+        EXPECT_FALSE(try_make_permutation(r));
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
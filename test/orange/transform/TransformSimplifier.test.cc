@@ -8,6 +8,7 @@
 #include "orange/transform/TransformSimplifier.hh"
 
 #include <cmath>
+#include <vector>
 
 #include "corecel/math/ArrayUtils.hh"
 #include "orange/MatrixUtils.hh"
@@ -22,9 +23,10 @@ namespace test
 struct DataGetter
 {
     template<class T>
-    Span<real_type const> operator()(T const& tf) const
+    std::vector<real_type> operator()(T const& tf) const
     {
-        return tf.data();
+        auto data = tf.data();
+        return {data.begin(), data.end()};
     }
 };
 
@@ -122,6 +124,34 @@ TEST_F(TransformSimplifierTest, transform)
     }
 }
 
+TEST_F(TransformSimplifierTest, permutation)
+{
+    TransformSimplifier simplify{tol_};
+
+    auto quarter_r = make_rotation(Axis::x,
+                                   Turn{0.25},
+                                   make_rotation(Axis::z, Turn{0.25}));
+    {
+        SCOPED_TRACE("simplify to permutation");
+        auto actual = simplify(Transformation(quarter_r, Real3{0, 1e-5, 0}));
+        ASSERT_TRUE(std::holds_alternative<SignedPermutation>(actual));
+        EXPECT_TR_SOFT_EQ(
+            SignedPermutation(SignedPermutation::SignedAxes{
+                {{'-', Axis::y}, {'-', Axis::z}, {'+', Axis::x}}}),
+            actual);
+    }
+    {
+        SCOPED_TRACE("translation prevents permutation");
+        Transformation const orig(quarter_r, Real3{0, 1, 0});
+        auto actual = simplify(orig);
+        EXPECT_TR_SOFT_EQ(orig, actual);
+    }
+    {
+        SCOPED_TRACE("identity permutation");
+        EXPECT_TR_SOFT_EQ(NoTransformation{}, simplify(SignedPermutation{}));
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas